@@ -19,17 +19,86 @@
 namespace mfem
 {
 
+#if defined(MFEM_USE_LEGACY_OPENMP) || \
+    (defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE))
+#define MFEM_THREADED_ELEMENT_ASSEMBLY
+#endif
+
+#ifdef MFEM_THREADED_ELEMENT_ASSEMBLY
+// Greedy coloring of the elements such that no two elements with the same color
+// share a degree of freedom. The result is returned as a color-to-element
+// table.
+static void ColorElementsByDofs(const Table &elem_dof, const int ndofs,
+                                Table &color_elem)
+{
+   const int ne = elem_dof.Size();
+   const auto decode = [](int d) { return (d >= 0) ? d : -1-d; };
+
+   Table dof_elem;
+   dof_elem.MakeI(ndofs);
+   for (int e = 0; e < ne; e++)
+   {
+      const int *dofs = elem_dof.GetRow(e);
+      for (int k = 0; k < elem_dof.RowSize(e); k++)
+      {
+         dof_elem.AddAColumnInRow(decode(dofs[k]));
+      }
+   }
+   dof_elem.MakeJ();
+   for (int e = 0; e < ne; e++)
+   {
+      const int *dofs = elem_dof.GetRow(e);
+      for (int k = 0; k < elem_dof.RowSize(e); k++)
+      {
+         dof_elem.AddConnection(decode(dofs[k]), e);
+      }
+   }
+   dof_elem.ShiftUpI();
+
+   Array<int> color(ne), used_by;
+   color = -1;
+   for (int e = 0; e < ne; e++)
+   {
+      // Mark the colors of the already colored neighbors of e
+      const int *dofs = elem_dof.GetRow(e);
+      for (int k = 0; k < elem_dof.RowSize(e); k++)
+      {
+         const int d = decode(dofs[k]);
+         const int *elems = dof_elem.GetRow(d);
+         for (int l = 0; l < dof_elem.RowSize(d); l++)
+         {
+            const int c = color[elems[l]];
+            if (c >= 0) { used_by[c] = e; }
+         }
+      }
+      int c = 0;
+      while (c < used_by.Size() && used_by[c] == e) { c++; }
+      if (c == used_by.Size()) { used_by.Append(-1); }
+      color[e] = c;
+   }
+   Transpose(color, color_elem, used_by.Size());
+}
+#endif
+
 void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
 
-   if (precompute_sparsity == 0 || fes->GetVDim() > 1)
+   if (precompute_sparsity == 0)
    {
       mat = new SparseMatrix(height);
       return;
    }
 
-   const Table &elem_dof = fes->GetElementToDofTable();
+   // The element-to-dof table may contain encoded negative dofs, e.g. for
+   // ND spaces, so use a decoded copy to build the sparsity pattern
+   Table elem_dof(fes->GetElementToDofTable());
+   for (int k = 0; k < elem_dof.Size_of_connections(); k++)
+   {
+      int &d = elem_dof.GetJ()[k];
+      if (d < 0) { d = -1-d; }
+   }
+   const int ndofs = fes->GetNDofs();
    Table dof_dof;
 
    if (interior_face_integs.Size() > 0)
@@ -41,19 +110,63 @@ void BilinearForm::AllocMat()
          mfem::Mult(*face_elem, elem_dof, face_dof);
          delete face_elem;
       }
-      Transpose(face_dof, dof_face, height);
+      Transpose(face_dof, dof_face, ndofs);
       mfem::Mult(dof_face, face_dof, dof_dof);
    }
    else
    {
       // the sparsity pattern is defined from the map: element->dof
       Table dof_elem;
-      Transpose(elem_dof, dof_elem, height);
+      Transpose(elem_dof, dof_elem, ndofs);
       mfem::Mult(dof_elem, elem_dof, dof_dof);
    }
 
    dof_dof.SortRows();
 
+   const int vdim = fes->GetVDim();
+   if (vdim > 1)
+   {
+      // Expand every entry (i,j) of the scalar pattern into a vdim x vdim
+      // block, keeping the column indices in each row sorted
+      const bool by_vdim = (fes->GetOrdering() == Ordering::byVDIM);
+      const int *dI = dof_dof.GetI(), *dJ = dof_dof.GetJ();
+      int *I = Memory<int>(height+1);
+      I[0] = 0;
+      for (int r = 0; r < height; r++)
+      {
+         const int d = by_vdim ? r / vdim : r % ndofs;
+         I[r+1] = I[r] + vdim*(dI[d+1] - dI[d]);
+      }
+      int *J = Memory<int>(I[height]);
+      for (int r = 0; r < height; r++)
+      {
+         const int d = by_vdim ? r / vdim : r % ndofs;
+         int *row = J + I[r];
+         if (by_vdim)
+         {
+            for (int k = dI[d]; k < dI[d+1]; k++)
+            {
+               for (int c = 0; c < vdim; c++) { *row++ = dJ[k]*vdim + c; }
+            }
+         }
+         else
+         {
+            for (int c = 0; c < vdim; c++)
+            {
+               for (int k = dI[d]; k < dI[d+1]; k++)
+               {
+                  *row++ = dJ[k] + c*ndofs;
+               }
+            }
+         }
+      }
+      real_t *data = Memory<real_t>(I[height]);
+
+      mat = new SparseMatrix(I, J, data, height, height, true, true, true);
+      *mat = 0.0;
+      return;
+   }
+
    int *I = dof_dof.GetI();
    int *J = dof_dof.GetJ();
    real_t *data = Memory<real_t>(I[height]);
@@ -453,6 +566,98 @@ void BilinearForm::AssembleBdrElementMatrix(
    }
 }
 
+void BilinearForm::AssembleElementMatricesColored()
+{
+   MFEM_ASSERT(mat && mat->Finalized(), "the matrix must be finalized");
+
+#ifdef MFEM_THREADED_ELEMENT_ASSEMBLY
+   if (!element_colors)
+   {
+      element_colors.reset(new Table);
+      ColorElementsByDofs(fes->GetElementToDofTable(), fes->GetNDofs(),
+                          *element_colors);
+   }
+   const Table *colors = element_colors.get();
+   const int num_colors = colors->Size();
+#else
+   // Without threads, all elements are added in order as a single "color"
+   const Table *colors = NULL;
+   const int num_colors = 1;
+#endif
+   if (!mat->ColumnsAreSorted()) { mat->SortColumnIndices(); }
+
+   // Make sure all host data is valid before the threaded loops
+   mat->HostReadI();
+   mat->HostReadJ();
+   mat->HostReadWriteData();
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      if (domain_integs_marker[k]) { domain_integs_marker[k]->HostRead(); }
+   }
+   if (element_matrices) { element_matrices->HostRead(); }
+
+#ifdef MFEM_THREADED_ELEMENT_ASSEMBLY
+   #pragma omp parallel
+#endif
+   {
+      Array<int> el_vdofs;
+      DofTransformation el_doftrans;
+      DenseMatrix elmat, el_tmp;
+      IsoparametricTransformation eltrans;
+
+      // Elements with the same color do not share dofs, so they can update
+      // the matrix concurrently
+      for (int c = 0; c < num_colors; c++)
+      {
+         const int *elems = colors ? colors->GetRow(c) : NULL;
+         const int num_elems = colors ? colors->RowSize(c) : fes->GetNE();
+#ifdef MFEM_THREADED_ELEMENT_ASSEMBLY
+         #pragma omp for
+#endif
+         for (int ie = 0; ie < num_elems; ie++)
+         {
+            const int i = elems ? elems[ie] : ie;
+            fes->GetElementVDofs(i, el_vdofs, el_doftrans);
+            if (element_matrices)
+            {
+               elmat.UseExternalData(element_matrices->GetData(i),
+                                     element_matrices->SizeI(),
+                                     element_matrices->SizeJ());
+            }
+            else
+            {
+               const int elem_attr = fes->GetMesh()->GetAttribute(i);
+               fes->GetElementTransformation(i, &eltrans);
+
+               elmat.SetSize(0);
+               for (int k = 0; k < domain_integs.Size(); k++)
+               {
+                  if ((domain_integs_marker[k] == NULL ||
+                       (*(domain_integs_marker[k]))[elem_attr-1] == 1)
+                      && !domain_integs[k]->Patchwise())
+                  {
+                     domain_integs[k]->AssembleElementMatrix(*fes->GetFE(i),
+                                                             eltrans, el_tmp);
+                     if (elmat.Size() == 0)
+                     {
+                        elmat = el_tmp;
+                     }
+                     else
+                     {
+                        elmat += el_tmp;
+                     }
+                  }
+               }
+               if (elmat.Size() == 0) { continue; }
+               el_doftrans.TransformDual(elmat);
+            }
+            mat->AddSubMatrixThreadSafe(el_vdofs, el_vdofs, elmat);
+            if (element_matrices) { elmat.ClearExternalData(); }
+         }
+      }
+   }
+}
+
 void BilinearForm::Assemble(int skip_zeros)
 {
    if (ext)
@@ -502,64 +707,76 @@ void BilinearForm::Assemble(int skip_zeros)
          }
       }
 
-      DofTransformation doftrans;
       // Element-wise integration
-      for (int i = 0; i < fes -> GetNE(); i++)
+      if (mat && mat->Finalized() && !static_cond && !hybridization)
       {
-         // Set both doftrans (potentially needed to assemble the element
-         // matrix) and vdofs, which is also needed when the element matrices
-         // are pre-assembled.
-         fes->GetElementVDofs(i, vdofs, doftrans);
-         if (element_matrices)
-         {
-            elmat_p = &(*element_matrices)(i);
-         }
-         else
+         // The sparsity pattern is known, e.g. see UsePrecomputedSparsity(),
+         // so the element matrices can be added directly to the CSR arrays
+         AssembleElementMatricesColored();
+      }
+      else
+      {
+         DofTransformation doftrans;
+         for (int i = 0; i < fes -> GetNE(); i++)
          {
-            const int elem_attr = fes->GetMesh()->GetAttribute(i);
-            eltrans = fes->GetElementTransformation(i);
-
-            elmat.SetSize(0);
-            for (int k = 0; k < domain_integs.Size(); k++)
+            // Set both doftrans (potentially needed to assemble the element
+            // matrix) and vdofs, which is also needed when the element matrices
+            // are pre-assembled.
+            fes->GetElementVDofs(i, vdofs, doftrans);
+            if (element_matrices)
             {
-               if (domain_integs_marker[k]) { domain_integs_marker[k]->HostRead(); }
-               if ((domain_integs_marker[k] == NULL ||
-                    (*(domain_integs_marker[k]))[elem_attr-1] == 1)
-                   && !domain_integs[k]->Patchwise())
+               elmat_p = &(*element_matrices)(i);
+            }
+            else
+            {
+               const int elem_attr = fes->GetMesh()->GetAttribute(i);
+               eltrans = fes->GetElementTransformation(i);
+
+               elmat.SetSize(0);
+               for (int k = 0; k < domain_integs.Size(); k++)
                {
-                  domain_integs[k]->AssembleElementMatrix(*fes->GetFE(i),
-                                                          *eltrans, elemmat);
-                  if (elmat.Size() == 0)
+                  if (domain_integs_marker[k])
                   {
-                     elmat = elemmat;
+                     domain_integs_marker[k]->HostRead();
                   }
-                  else
+                  if ((domain_integs_marker[k] == NULL ||
+                       (*(domain_integs_marker[k]))[elem_attr-1] == 1)
+                      && !domain_integs[k]->Patchwise())
                   {
-                     elmat += elemmat;
+                     domain_integs[k]->AssembleElementMatrix(*fes->GetFE(i),
+                                                             *eltrans, elemmat);
+                     if (elmat.Size() == 0)
+                     {
+                        elmat = elemmat;
+                     }
+                     else
+                     {
+                        elmat += elemmat;
+                     }
                   }
                }
+               if (elmat.Size() == 0)
+               {
+                  continue;
+               }
+               else
+               {
+                  elmat_p = &elmat;
+               }
+               doftrans.TransformDual(elmat);
+               elmat_p = &elmat;
             }
-            if (elmat.Size() == 0)
+            if (static_cond)
             {
-               continue;
+               static_cond->AssembleMatrix(i, *elmat_p);
             }
             else
             {
-               elmat_p = &elmat;
-            }
-            doftrans.TransformDual(elmat);
-            elmat_p = &elmat;
-         }
-         if (static_cond)
-         {
-            static_cond->AssembleMatrix(i, *elmat_p);
-         }
-         else
-         {
-            mat->AddSubMatrix(vdofs, vdofs, *elmat_p, skip_zeros);
-            if (hybridization)
-            {
-               hybridization->AssembleMatrix(i, *elmat_p);
+               mat->AddSubMatrix(vdofs, vdofs, *elmat_p, skip_zeros);
+               if (hybridization)
+               {
+                  hybridization->AssembleMatrix(i, *elmat_p);
+               }
             }
          }
       }
@@ -964,6 +1181,15 @@ void BilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
    }
    else
    {
+      ess_tdof_list.HostRead();
+      if (elim_pending &&
+          (ess_tdof_list != elim_vdofs || diag_policy != elim_policy))
+      {
+         // The values-only elimination map does not apply, start over
+         delete mat_e;
+         mat_e = NULL;
+         ClearEliminationMap();
+      }
       if (!mat_e)
       {
          const SparseMatrix *P = fes->GetConformingProlongation();
@@ -971,6 +1197,20 @@ void BilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
          EliminateVDofs(ess_tdof_list, diag_policy);
          const int remove_zeros = 0;
          Finalize(remove_zeros);
+         if (values_only_reassembly && !P && !hybridization)
+         {
+            BuildEliminationMap(ess_tdof_list);
+         }
+      }
+      else if (elim_pending)
+      {
+         const int remove_zeros = 0;
+         Finalize(remove_zeros);
+         const real_t diag = (elim_policy == DIAG_ONE) ? 1.0 : 0.0;
+         ApplyEliminationMap(elim_map, elim_diag_map, diag,
+                             mat->HostReadWriteData(),
+                             mat_e->HostReadWriteData());
+         elim_pending = false;
       }
       if (hybridization)
       {
@@ -1193,6 +1433,95 @@ void BilinearForm::EliminateVDofs(const Array<int> &vdofs_,
    }
 }
 
+void BilinearForm::BuildEliminationMap(const Array<int> &ess_vdofs)
+{
+   MFEM_VERIFY(mat->Finalized() && mat_e->Finalized(),
+               "the matrices must be finalized");
+   elim_vdofs = ess_vdofs;
+   elim_policy = diag_policy;
+   elim_map.SetSize(0);
+   elim_diag_map.SetSize(0);
+
+   Array<int> ess_marker(height);
+   ess_marker = 0;
+   ess_vdofs.HostRead();
+   for (int i = 0; i < ess_vdofs.Size(); i++)
+   {
+      const int vdof = ess_vdofs[i];
+      ess_marker[(vdof >= 0) ? vdof : -1-vdof] = 1;
+   }
+
+   const int *I = mat->HostReadI(), *J = mat->HostReadJ();
+   const int *Ie = mat_e->HostReadI(), *Je = mat_e->HostReadJ();
+   // Position of the entry (i,j) in mat_e
+   auto find_e = [&](int i, int j)
+   {
+      for (int ke = Ie[i]; ke < Ie[i+1]; ke++)
+      {
+         if (Je[ke] == j) { return ke; }
+      }
+      MFEM_ABORT("entry (" << i << "," << j << ") not found in mat_e");
+      return -1;
+   };
+
+   // Same traversal as SparseMatrix::EliminateRowCol(), moving every entry of
+   // the eliminated rows and columns exactly once
+   for (int i = 0; i < height; i++)
+   {
+      if (!ess_marker[i]) { continue; }
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         const int j = J[k];
+         if (j == i)
+         {
+            if (diag_policy != DIAG_KEEP)
+            {
+               elim_diag_map.Append(k);
+               elim_diag_map.Append(find_e(i, i));
+            }
+            continue;
+         }
+         elim_map.Append(k);
+         elim_map.Append(find_e(i, j));
+         if (ess_marker[j]) { continue; }
+         int kt = I[j];
+         while (kt < I[j+1] && J[kt] != i) { kt++; }
+         MFEM_VERIFY(kt < I[j+1], "the sparsity pattern is not symmetric");
+         elim_map.Append(kt);
+         elim_map.Append(find_e(j, i));
+      }
+   }
+   elim_map_ready = true;
+   elim_pending = false;
+}
+
+void BilinearForm::ClearEliminationMap()
+{
+   elim_map.DeleteAll();
+   elim_diag_map.DeleteAll();
+   elim_vdofs.DeleteAll();
+   elim_map_ready = false;
+   elim_pending = false;
+}
+
+void BilinearForm::ApplyEliminationMap(const Array<int> &map,
+                                       const Array<int> &diag_map,
+                                       real_t diag, real_t *a, real_t *ae)
+{
+   const int n = map.Size()/2, nd = diag_map.Size()/2;
+   const int *m = map.HostRead(), *md = diag_map.HostRead();
+   for (int i = 0; i < n; i++)
+   {
+      ae[m[2*i+1]] = a[m[2*i]];
+      a[m[2*i]] = 0.0;
+   }
+   for (int i = 0; i < nd; i++)
+   {
+      ae[md[2*i+1]] = a[md[2*i]] - diag;
+      a[md[2*i]] = diag;
+   }
+}
+
 void BilinearForm::EliminateEssentialBCFromDofs(
    const Array<int> &ess_dofs, const Vector &sol, Vector &rhs,
    DiagonalPolicy dpolicy)
@@ -1283,8 +1612,18 @@ void BilinearForm::Update(FiniteElementSpace *nfes)
                      sequence < fes->GetSequence());
    }
 
-   delete mat_e;
-   mat_e = NULL;
+   if (values_only_reassembly && elim_map_ready && !full_update)
+   {
+      // Keep the eliminated part, refilled by the next FormSystemMatrix()
+      if (mat_e) { *mat_e = 0.0; }
+      elim_pending = true;
+   }
+   else
+   {
+      delete mat_e;
+      mat_e = NULL;
+      ClearEliminationMap();
+   }
    FreeElementMatrices();
    static_cond.reset();
 
@@ -1292,6 +1631,7 @@ void BilinearForm::Update(FiniteElementSpace *nfes)
    {
       delete mat;
       mat = NULL;
+      element_colors.reset();
       hybridization.reset();
       sequence = fes->GetSequence();
    }
@@ -1369,6 +1709,26 @@ MixedBilinearForm::MixedBilinearForm (FiniteElementSpace *tr_fes,
    ext = NULL;
 }
 
+// Return true if the device full assembly of mixed forms supports the trial
+// and test spaces. The element restrictions are not available on NURBS meshes
+// and with variable order spaces, and the mixed partial assembly kernels
+// require tensor product elements (segments, quadrilaterals and hexahedra).
+// MeshGenerator() is global in parallel, so all ranks make the same choice.
+static bool MixedFullAssemblySupportsSpaces(const FiniteElementSpace &trial,
+                                            const FiniteElementSpace &test)
+{
+   for (const FiniteElementSpace *fes : {&trial, &test})
+   {
+      const Mesh *mesh = fes->GetMesh();
+      if (fes->GetNURBSext() || fes->IsVariableOrder() ||
+          (mesh->Dimension() > 1 && mesh->MeshGenerator() != 2))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
 void MixedBilinearForm::SetAssemblyLevel(AssemblyLevel assembly_level)
 {
    if (ext)
@@ -1381,12 +1741,15 @@ void MixedBilinearForm::SetAssemblyLevel(AssemblyLevel assembly_level)
       case AssemblyLevel::LEGACY:
          break;
       case AssemblyLevel::FULL:
-         // ext.reset(new FAMixedBilinearFormExtension(this));
-         // Use the original BilinearForm implementation for now
+         // The extension sets up the element restrictions of the spaces
+         if (MixedFullAssemblySupportsSpaces(*trial_fes, *test_fes))
+         {
+            ext.reset(new FAMixedBilinearFormExtension(this));
+         }
+         else { assembly = AssemblyLevel::LEGACY; }
          break;
       case AssemblyLevel::ELEMENT:
-         MFEM_ABORT("Element assembly not supported yet... stay tuned!");
-         // ext.reset(new EAMixedBilinearFormExtension(this));
+         ext.reset(new EAMixedBilinearFormExtension(this));
          break;
       case AssemblyLevel::PARTIAL:
          ext.reset(new PAMixedBilinearFormExtension(this));
@@ -1545,8 +1908,33 @@ void MixedBilinearForm::AddBdrTraceFaceIntegrator(BilinearFormIntegrator *bfi,
    boundary_trace_face_integs_marker.Append(&bdr_marker);
 }
 
+void MixedBilinearForm::CheckFullAssemblySupport()
+{
+   if (!ext || assembly != AssemblyLevel::FULL) { return; }
+
+   bool supported = boundary_integs.Size() == 0 &&
+                    interior_face_integs.Size() == 0 &&
+                    boundary_face_integs.Size() == 0 &&
+                    trace_face_integs.Size() == 0 &&
+                    boundary_trace_face_integs.Size() == 0;
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      supported = supported && domain_integs_marker[k] == NULL &&
+                  domain_integs[k]->SupportsMixedPA();
+   }
+   supported = supported &&
+               MixedFullAssemblySupportsSpaces(*trial_fes, *test_fes);
+
+   if (!supported)
+   {
+      ext.reset();
+      assembly = AssemblyLevel::LEGACY;
+   }
+}
+
 void MixedBilinearForm::Assemble(int skip_zeros)
 {
+   CheckFullAssemblySupport();
    if (ext)
    {
       ext->Assemble();
@@ -2291,7 +2679,9 @@ void MixedBilinearForm::FormRectangularSystemMatrix(
    OperatorHandle &A)
 
 {
-   if (ext)
+   // With full assembly, the extension computes 'mat' which is then used as in
+   // the legacy assembly
+   if (ext && assembly != AssemblyLevel::FULL)
    {
       ext->FormRectangularSystemOperator(trial_tdof_list, test_tdof_list, A);
       return;
@@ -2334,7 +2724,7 @@ void MixedBilinearForm::FormRectangularLinearSystem(
    OperatorHandle &A,
    Vector &X, Vector &B)
 {
-   if (ext)
+   if (ext && assembly != AssemblyLevel::FULL)
    {
       ext->FormRectangularLinearSystem(trial_tdof_list, test_tdof_list,
                                        x, b, A, X, B);
@@ -2399,8 +2789,14 @@ void DiscreteLinearOperator::SetAssemblyLevel(AssemblyLevel assembly_level)
    switch (assembly)
    {
       case AssemblyLevel::LEGACY:
+         break;
       case AssemblyLevel::FULL:
-         // Use the original implementation for now
+         // The extension sets up the element restrictions of the spaces
+         if (MixedFullAssemblySupportsSpaces(*trial_fes, *test_fes))
+         {
+            ext.reset(new FADiscreteLinearOperatorExtension(this));
+         }
+         else { assembly = AssemblyLevel::LEGACY; }
          break;
       case AssemblyLevel::ELEMENT:
          MFEM_ABORT("Element assembly not supported yet... stay tuned!");
@@ -2418,6 +2814,7 @@ void DiscreteLinearOperator::SetAssemblyLevel(AssemblyLevel assembly_level)
 
 void DiscreteLinearOperator::Assemble(int skip_zeros)
 {
+   CheckFullAssemblySupport();
    if (ext)
    {
       ext->Assemble();
@@ -124,6 +124,10 @@ protected:
 
    std::unique_ptr<DenseTensor> element_matrices;
 
+   /** @brief Coloring of the elements used by the threaded
+       AssembleElementMatricesColored(), reset by a full Update(). */
+   std::unique_ptr<Table> element_colors;
+
    std::unique_ptr<StaticCondensation> static_cond;
    std::unique_ptr<Hybridization> hybridization;
 
@@ -134,9 +138,60 @@ protected:
 
    int precompute_sparsity;
 
+   /// Enables values-only reassembly, see UseValuesOnlyReassembly().
+   bool values_only_reassembly = false;
+
+   /** @brief Pairs (k, ke) of positions in the data arrays of the assembled
+       matrix and of its eliminated part, such that the elimination of the
+       essential dofs moves entry k of the former to entry ke of the latter. */
+   Array<int> elim_map;
+
+   /** @brief Pairs (k, ke) as in #elim_map for the diagonal entries of the
+       eliminated rows, which are replaced by the value given by
+       #elim_policy. */
+   Array<int> elim_diag_map;
+
+   /// The essential dofs used to build #elim_map.
+   Array<int> elim_vdofs;
+
+   /// The diagonal policy used to build #elim_map.
+   DiagonalPolicy elim_policy = DIAG_KEEP;
+
+   /// True if #elim_map matches the pattern of the assembled matrices.
+   bool elim_map_ready = false;
+
+   /** @brief True after a values-only Update(), until the elimination is
+       applied to the reassembled matrix. */
+   bool elim_pending = false;
+
    /// Allocate appropriate SparseMatrix and assign it to #mat
    void AllocMat();
 
+   /** @brief Build #elim_map from the finalized matrices #mat and #mat_e,
+       after eliminating @a ess_vdofs with EliminateVDofs(). */
+   void BuildEliminationMap(const Array<int> &ess_vdofs);
+
+   /// Clear #elim_map and the related data.
+   void ClearEliminationMap();
+
+   /** @brief Move the entries of the data array @a a listed in @a map and
+       @a diag_map to the data array @a ae of the eliminated part. */
+   /** The entries in @a map are set to zero in @a a, while the ones in
+       @a diag_map are set to @a diag and their old value minus @a diag is
+       written to @a ae. Both arrays are assumed to be on the host. */
+   static void ApplyEliminationMap(const Array<int> &map,
+                                   const Array<int> &diag_map, real_t diag,
+                                   real_t *a, real_t *ae);
+
+   /** @brief Add the domain integrator element matrices directly to the
+       finalized matrix #mat. */
+   /** When MFEM is built with MFEM_USE_LEGACY_OPENMP, or with
+       MFEM_USE_OPENMP and MFEM_THREAD_SAFE, the elements are colored so that
+       no two elements with the same color share a dof, and the elements of
+       each color are processed by multiple threads. Otherwise, the elements
+       are processed in order, without coloring. */
+   void AssembleElementMatricesColored();
+
    /** @brief For partially conforming trial and/or test FE spaces, complete the
        assembly process by performing $ P^t A P $ where $ A $ is the
        internal sparse matrix and $ P $ is the conforming prolongation
@@ -236,11 +291,37 @@ public:
                             BilinearFormIntegrator *constr_integ,
                             const Array<int> &ess_tdof_list);
 
-   /** @brief For scalar FE spaces, precompute the sparsity pattern of the
-       matrix (assuming dense element matrices) based on the types of
-       integrators present in the bilinear form. */
+   /** @brief Precompute the sparsity pattern of the matrix (assuming dense
+       element matrices) based on the types of integrators present in the
+       bilinear form. */
+   /** For vector FE spaces, every entry of the scalar pattern is expanded to
+       a block of size vdim x vdim. Since the matrix is then allocated in CSR
+       format, Assemble() adds the element matrices directly to the CSR arrays,
+       using multiple threads when available, see
+       AssembleElementMatricesColored(). */
    void UsePrecomputedSparsity(int ps = 1) { precompute_sparsity = ps; }
 
+   /** @brief Reuse the sparsity of the assembled matrix and of its eliminated
+       part when only the values of the form change, e.g. with time-dependent
+       coefficients on a fixed mesh. */
+   /** With this option, Update() keeps the finalized matrix (setting its
+       entries to zero) instead of deleting it, so that the following
+       Assemble() adds the element matrices directly to its CSR arrays, see
+       AssembleElementMatricesColored(). The essential BC elimination in
+       FormSystemMatrix() (and FormLinearSystem()) then moves the same entries
+       as the first time, using a map built by the first call, instead of
+       rebuilding the eliminated part. In ParBilinearForm, the HypreParMatrix
+       of the system and its eliminated part are reused as well.
+
+       The sparsity pattern must include all entries that may become nonzero,
+       so the first assembly should use UsePrecomputedSparsity() or
+       Assemble(0). The option has no effect on nonconforming meshes, with
+       static condensation or hybridization, and with assembly levels other
+       than AssemblyLevel::LEGACY. If the list of essential dofs or the
+       diagonal policy change, the elimination is performed from scratch. */
+   void UseValuesOnlyReassembly(bool use = true)
+   { values_only_reassembly = use; }
+
    /** @brief Use the given CSR sparsity pattern to allocate the internal
        SparseMatrix.
 
@@ -754,6 +835,8 @@ public:
 */
 class MixedBilinearForm : public Matrix
 {
+   friend FAMixedBilinearFormExtension;
+
 protected:
    SparseMatrix *mat; ///< Owned.
    SparseMatrix *mat_e; ///< Owned.
@@ -804,6 +887,15 @@ protected:
    mutable DenseMatrix elemmat;
    mutable Array<int>  trial_vdofs, test_vdofs;
 
+   /** @brief With AssemblyLevel::FULL, switch to AssemblyLevel::LEGACY if the
+       form is not supported by the FAMixedBilinearFormExtension. */
+   /** The device full assembly requires that all domain integrators support
+       partial assembly, see BilinearFormIntegrator::SupportsMixedPA(), without
+       element markers, that there are no boundary or face integrators, and
+       that the meshes only contain tensor product elements. Both assembly
+       levels compute the same sparse matrix. */
+   void CheckFullAssemblySupport();
+
 private:
    /// Copy construction is not supported; body is undefined.
    MixedBilinearForm(const MixedBilinearForm &);
@@ -982,9 +1074,18 @@ public:
    void operator=(const real_t a) { *mat = a; }
 
    /// Set the desired assembly level. The default is AssemblyLevel::LEGACY.
-   /** This method must be called before assembly. See ::AssemblyLevel*/
+   /** This method must be called before assembly. See ::AssemblyLevel
+
+       With AssemblyLevel::FULL, the form falls back to AssemblyLevel::LEGACY
+       right away if the spaces are not supported by the device full assembly
+       (e.g. simplex meshes, NURBS or variable order), and in Assemble() if
+       some of its integrators are not supported, e.g. boundary or face
+       integrators. */
    void SetAssemblyLevel(AssemblyLevel assembly_level);
 
+   /// Returns the assembly level
+   AssemblyLevel GetAssemblyLevel() const { return assembly; }
+
    void Assemble(int skip_zeros = 1);
 
    /** @brief Assemble the diagonal of ADA^T into diag, where A is this mixed
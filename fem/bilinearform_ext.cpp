@@ -10,7 +10,8 @@
 // CONTRIBUTING.md for details.
 
 // Implementations of classes FABilinearFormExtension, EABilinearFormExtension,
-// PABilinearFormExtension and MFBilinearFormExtension.
+// PABilinearFormExtension, MFBilinearFormExtension, and of their counterparts
+// for MixedBilinearForm and DiscreteLinearOperator.
 
 #include "../general/forall.hpp"
 #include "bilinearform.hpp"
@@ -1962,6 +1963,376 @@ void PAMixedBilinearFormExtension::AssembleDiagonal_ADAt(const Vector &D,
    }
 }
 
+EAMixedBilinearFormExtension::EAMixedBilinearFormExtension(
+   MixedBilinearForm *form)
+   : PAMixedBilinearFormExtension(form),
+     ne(0), trial_edofs(0), test_edofs(0)
+{
+}
+
+void EAMixedBilinearFormExtension::Assemble()
+{
+   PAMixedBilinearFormExtension::Assemble();
+   MFEM_VERIFY(elem_restrict_trial && elem_restrict_test,
+               "element restrictions are required");
+
+   ne = trial_fes->GetNE();
+   trial_edofs = (ne > 0) ? elem_restrict_trial->Height() / ne : 0;
+   test_edofs = (ne > 0) ? elem_restrict_test->Height() / ne : 0;
+   ea_data.UseDevice(true);
+   ea_data.SetSize(test_edofs*trial_edofs*ne, Device::GetMemoryType());
+
+   // Column j of all element matrices is the action of the partially assembled
+   // integrators on the j-th unit E-vector of every element
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   const int NE = ne, TE = test_edofs, TR = trial_edofs;
+   auto A = Reshape(ea_data.Write(), TE, TR, NE);
+   for (int j = 0; j < TR; j++)
+   {
+      localTrial = 0.0;
+      auto X = Reshape(localTrial.ReadWrite(), TR, NE);
+      mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+      {
+         X(j, e) = 1.0;
+      });
+      localTest = 0.0;
+      for (int i = 0; i < integrators.Size(); ++i)
+      {
+         integrators[i]->AddMultPA(localTrial, localTest);
+      }
+      const auto Y = Reshape(localTest.Read(), TE, NE);
+      mfem::forall(TE*NE, [=] MFEM_HOST_DEVICE (int k)
+      {
+         const int i = k % TE;
+         const int e = k / TE;
+         A(i, j, e) = Y(i, e);
+      });
+   }
+}
+
+void EAMixedBilinearFormExtension::AddMult(const Vector &x, Vector &y,
+                                           const real_t c) const
+{
+   // * G operation
+   SetupMultInputs(elem_restrict_trial, x, localTrial,
+                   elem_restrict_test, y, localTest, c);
+
+   // * Element matrices
+   const int NE = ne, TE = test_edofs, TR = trial_edofs;
+   const auto A = Reshape(ea_data.Read(), TE, TR, NE);
+   const auto X = Reshape(localTrial.Read(), TR, NE);
+   auto Y = Reshape(localTest.ReadWrite(), TE, NE);
+   mfem::forall(TE*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % TE;
+      const int e = k / TE;
+      real_t val = 0.0;
+      for (int j = 0; j < TR; j++)
+      {
+         val += A(i, j, e) * X(j, e);
+      }
+      Y(i, e) += val;
+   });
+
+   // * G^T operation
+   tempY.SetSize(y.Size());
+   elem_restrict_test->MultTranspose(localTest, tempY);
+   y += tempY;
+}
+
+void EAMixedBilinearFormExtension::AddMultTranspose(const Vector &x, Vector &y,
+                                                    const real_t c) const
+{
+   // * G operation
+   SetupMultInputs(elem_restrict_test, x, localTest,
+                   elem_restrict_trial, y, localTrial, c);
+
+   // * Transposed element matrices
+   const int NE = ne, TE = test_edofs, TR = trial_edofs;
+   const auto A = Reshape(ea_data.Read(), TE, TR, NE);
+   const auto X = Reshape(localTest.Read(), TE, NE);
+   auto Y = Reshape(localTrial.ReadWrite(), TR, NE);
+   mfem::forall(TR*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int j = k % TR;
+      const int e = k / TR;
+      real_t val = 0.0;
+      for (int i = 0; i < TE; i++)
+      {
+         val += A(i, j, e) * X(i, e);
+      }
+      Y(j, e) += val;
+   });
+
+   // * G^T operation
+   tempY.SetSize(y.Size());
+   elem_restrict_trial->MultTranspose(localTrial, tempY);
+   y += tempY;
+}
+
+// Compute the map 'emap' from the E-vector entries of the element restriction
+// 'R' of 'fes' to the (signed) L-vector entries, together with its inverse in
+// CSR format: 'indices' lists the E-vector entries mapped to each L-vector
+// entry, starting at 'offsets'.
+static void GetElementVDofMaps(const FiniteElementSpace &fes,
+                               const Operator &R,
+                               Array<int> &emap, Array<int> &offsets,
+                               Array<int> &indices)
+{
+   const int ne = fes.GetNE();
+   const int vdim = fes.GetVDim();
+   const int ndofs = fes.GetNDofs();
+   const bool byvdim = fes.GetOrdering() == Ordering::byVDIM;
+   const int nd = (ne > 0) ? R.Height() / (ne*vdim) : 0;
+
+   // The E-vector layout is ND x VDIM x NE in both cases
+   const int *gather_map = nullptr;
+   if (auto ER = dynamic_cast<const ElementRestriction*>(&R))
+   {
+      gather_map = ER->GatherMap().HostRead();
+   }
+   else
+   {
+      MFEM_VERIFY(dynamic_cast<const L2ElementRestriction*>(&R),
+                  "unsupported element restriction");
+   }
+
+   emap.SetSize(ne*vdim*nd);
+   offsets.SetSize(fes.GetVSize() + 1);
+   offsets = 0;
+   for (int e = 0; e < ne; e++)
+   {
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int i = 0; i < nd; i++)
+         {
+            const int sgid = gather_map ? gather_map[i + nd*e] : i + nd*e;
+            const int gid = (sgid >= 0) ? sgid : -1-sgid;
+            const int vgid = byvdim ? c + vdim*gid : gid + ndofs*c;
+            emap[i + nd*(c + vdim*e)] = (sgid >= 0) ? vgid : -1-vgid;
+            offsets[vgid + 1]++;
+         }
+      }
+   }
+   offsets.PartialSum();
+   indices.SetSize(emap.Size());
+   Array<int> next(offsets);
+   for (int k = 0; k < emap.Size(); k++)
+   {
+      const int vgid = (emap[k] >= 0) ? emap[k] : -1-emap[k];
+      indices[next[vgid]++] = k;
+   }
+}
+
+/** Compute in @a val the entry of the assembled mixed matrix in the row of the
+    test E-vector entry @a i and the column of the trial E-vector entry @a j of
+    the element @a e. Returns false if @a e is not the lowest numbered element
+    sharing the two dofs, or if all element contributions to the entry are
+    zero. With @a SET, the value is taken from @a e instead of being summed
+    over the elements. */
+template <bool SET>
+static MFEM_HOST_DEVICE inline
+bool GetMixedEntry(const int e, const int i, const int j,
+                   const int TE, const int *te_emap, const int *te_offsets,
+                   const int *te_indices,
+                   const int TR, const int *tr_emap, const int *tr_offsets,
+                   const int *tr_indices,
+                   const DeviceTensor<3, const real_t> &A, real_t &val)
+{
+   const int te_k = te_emap[i + TE*e], tr_k = tr_emap[j + TR*e];
+   const int i_L = (te_k >= 0) ? te_k : -1-te_k;
+   const int j_L = (tr_k >= 0) ? tr_k : -1-tr_k;
+   bool nonzero = false;
+   val = 0.0;
+   for (int a = te_offsets[i_L]; a < te_offsets[i_L+1]; a++)
+   {
+      const int ka = te_indices[a];
+      const int ea = ka / TE;
+      for (int b = tr_offsets[j_L]; b < tr_offsets[j_L+1]; b++)
+      {
+         const int kb = tr_indices[b];
+         if (kb / TR != ea) { continue; }
+         if (ea < e) { return false; }
+         const bool flip = (te_emap[ka] >= 0) != (tr_emap[kb] >= 0);
+         const real_t v = (flip ? -1.0 : 1.0) * A(ka % TE, kb % TR, ea);
+         nonzero = nonzero || (v != 0.0);
+         if (!SET) { val += v; }
+         else if (ea == e) { val = v; }
+      }
+   }
+   return nonzero;
+}
+
+/** Fill the sparse matrix @a mat of size test vsize x trial vsize with the
+    element matrices @a ea_data, using the E-vector to L-vector maps computed
+    by GetElementVDofMaps(), see also ElementRestriction::FillSparseMatrix(). */
+template <bool SET>
+static void FillMixedSparseMatrix(const Vector &ea_data, const int ne,
+                                  const Array<int> &test_emap,
+                                  const Array<int> &test_offsets,
+                                  const Array<int> &test_indices,
+                                  const Array<int> &trial_emap,
+                                  const Array<int> &trial_offsets,
+                                  const Array<int> &trial_indices,
+                                  SparseMatrix &mat)
+{
+   const int height = mat.Height();
+   const int NE = ne;
+   const int TE = (ne > 0) ? test_emap.Size() / ne : 0;
+   const int TR = (ne > 0) ? trial_emap.Size() / ne : 0;
+   const auto A = Reshape(ea_data.Read(), TE, TR, NE);
+   const int *te_emap = test_emap.Read();
+   const int *te_offsets = test_offsets.Read();
+   const int *te_indices = test_indices.Read();
+   const int *tr_emap = trial_emap.Read();
+   const int *tr_offsets = trial_offsets.Read();
+   const int *tr_indices = trial_indices.Read();
+
+   // 1. Count the entries of each row, each entry is owned by one element
+   mat.GetMemoryI().New(height+1, mat.GetMemoryI().GetMemoryType());
+   auto I = mat.WriteI();
+   mfem::forall(height+1, [=] MFEM_HOST_DEVICE (int i_L) { I[i_L] = 0; });
+   mfem::forall(TE*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % TE;
+      const int e = k / TE;
+      const int te_k = te_emap[k];
+      const int i_L = (te_k >= 0) ? te_k : -1-te_k;
+      for (int j = 0; j < TR; j++)
+      {
+         real_t val;
+         if (GetMixedEntry<SET>(e, i, j, TE, te_emap, te_offsets, te_indices,
+                                TR, tr_emap, tr_offsets, tr_indices, A, val))
+         {
+            AtomicAdd(I[i_L], 1);
+         }
+      }
+   });
+   // The sum of the entries of I is sequential, we do it on the host
+   auto h_I = mat.HostReadWriteI();
+   int nnz = 0;
+   for (int i = 0; i < height; i++)
+   {
+      const int row_nnz = h_I[i];
+      h_I[i] = nnz;
+      nnz += row_nnz;
+   }
+   h_I[height] = nnz;
+
+   // 2. Fill J and Data, using I as the insertion counter of each row
+   mat.GetMemoryJ().New(nnz, mat.GetMemoryJ().GetMemoryType());
+   mat.GetMemoryData().New(nnz, mat.GetMemoryData().GetMemoryType());
+   I = mat.ReadWriteI();
+   auto J = mat.WriteJ();
+   auto Data = mat.WriteData();
+   mfem::forall(TE*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % TE;
+      const int e = k / TE;
+      const int te_k = te_emap[k];
+      const int i_L = (te_k >= 0) ? te_k : -1-te_k;
+      for (int j = 0; j < TR; j++)
+      {
+         real_t val;
+         if (GetMixedEntry<SET>(e, i, j, TE, te_emap, te_offsets, te_indices,
+                                TR, tr_emap, tr_offsets, tr_indices, A, val))
+         {
+            const int tr_k = tr_emap[j + TR*e];
+            const int nz = AtomicAdd(I[i_L], 1);
+            J[nz] = (tr_k >= 0) ? tr_k : -1-tr_k;
+            Data[nz] = val;
+         }
+      }
+   });
+   // Shift the entries of I back, on the host as above
+   h_I = mat.HostReadWriteI();
+   for (int i = height; i > 0; i--)
+   {
+      h_I[i] = h_I[i-1];
+   }
+   h_I[0] = 0;
+}
+
+FAMixedBilinearFormExtension::FAMixedBilinearFormExtension(
+   MixedBilinearForm *form)
+   : EAMixedBilinearFormExtension(form),
+     set_test_entries(false)
+{
+}
+
+void FAMixedBilinearFormExtension::Assemble()
+{
+   MFEM_VERIFY(a->GetFBFI()->Size() == 0 && a->GetBFBFI()->Size() == 0,
+               "Full assembly does not support face integrators yet.");
+   EAMixedBilinearFormExtension::Assemble();
+
+   if (test_offsets.Size() == 0)
+   {
+      GetElementVDofMaps(*trial_fes, *elem_restrict_trial,
+                         trial_emap, trial_offsets, trial_indices);
+      GetElementVDofMaps(*test_fes, *elem_restrict_test,
+                         test_emap, test_offsets, test_indices);
+   }
+
+   delete a->mat;
+   a->mat = new SparseMatrix;
+   a->mat->OverrideSize(height, width);
+   if (set_test_entries)
+   {
+      FillMixedSparseMatrix<true>(ea_data, ne, test_emap, test_offsets,
+                                  test_indices, trial_emap, trial_offsets,
+                                  trial_indices, *a->mat);
+   }
+   else
+   {
+      FillMixedSparseMatrix<false>(ea_data, ne, test_emap, test_offsets,
+                                   test_indices, trial_emap, trial_offsets,
+                                   trial_indices, *a->mat);
+   }
+}
+
+void FAMixedBilinearFormExtension::FormRectangularSystemOperator(
+   const Array<int> &trial_tdof_list,
+   const Array<int> &test_tdof_list,
+   OperatorHandle &A)
+{
+   a->FormRectangularSystemMatrix(trial_tdof_list, test_tdof_list, A);
+}
+
+void FAMixedBilinearFormExtension::FormRectangularLinearSystem(
+   const Array<int> &trial_tdof_list,
+   const Array<int> &test_tdof_list,
+   Vector &x, Vector &b,
+   OperatorHandle &A,
+   Vector &X, Vector &B)
+{
+   a->FormRectangularLinearSystem(trial_tdof_list, test_tdof_list,
+                                  x, b, A, X, B);
+}
+
+void FAMixedBilinearFormExtension::AddMult(const Vector &x, Vector &y,
+                                           const real_t c) const
+{
+   a->mat->AddMult(x, y, c);
+}
+
+void FAMixedBilinearFormExtension::AddMultTranspose(const Vector &x, Vector &y,
+                                                    const real_t c) const
+{
+   a->mat->AddMultTranspose(x, y, c);
+}
+
+void FAMixedBilinearFormExtension::Update()
+{
+   EAMixedBilinearFormExtension::Update();
+   trial_emap.DeleteAll();
+   trial_offsets.DeleteAll();
+   trial_indices.DeleteAll();
+   test_emap.DeleteAll();
+   test_offsets.DeleteAll();
+   test_indices.DeleteAll();
+}
+
 PADiscreteLinearOperatorExtension::PADiscreteLinearOperatorExtension(
    DiscreteLinearOperator *linop) :
    PAMixedBilinearFormExtension(linop)
@@ -2092,4 +2463,11 @@ void PADiscreteLinearOperatorExtension::FormRectangularSystemOperator(
    A.Reset(Arco);
 }
 
+FADiscreteLinearOperatorExtension::FADiscreteLinearOperatorExtension(
+   DiscreteLinearOperator *linop)
+   : FAMixedBilinearFormExtension(linop)
+{
+   set_test_entries = true;
+}
+
 } // namespace mfem
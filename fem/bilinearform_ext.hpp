@@ -343,6 +343,73 @@ public:
 };
 
 
+/// Data and methods for element-assembled mixed bilinear forms
+class EAMixedBilinearFormExtension : public PAMixedBilinearFormExtension
+{
+protected:
+   int ne;
+   /// Number of trial and test E-vector entries per element, resp.
+   int trial_edofs, test_edofs;
+   /// The element matrices, of size test_edofs x trial_edofs, column major
+   Vector ea_data;
+
+public:
+   EAMixedBilinearFormExtension(MixedBilinearForm *form);
+
+   /// Element assembly of all internal integrators
+   /** The element matrices are computed on the device by applying the
+       partially assembled integrators to the unit trial E-vectors. */
+   void Assemble() override;
+   /// y += c*A*x
+   void AddMult(const Vector &x, Vector &y, const real_t c=1.0) const override;
+   /// y += c*A^T*x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t c=1.0) const override;
+};
+
+/// Data and methods for fully-assembled mixed bilinear forms
+/** The sparse matrix of the MixedBilinearForm is built from the element
+    matrices on the device. It is then used exactly as with
+    AssemblyLevel::LEGACY, e.g. by MixedBilinearForm::SpMat() and
+    ParMixedBilinearForm::ParallelAssemble(). */
+class FAMixedBilinearFormExtension : public EAMixedBilinearFormExtension
+{
+protected:
+   /** @brief Maps between the E-vector and the L-vector entries of the trial
+       space, see the implementation of Assemble(). */
+   Array<int> trial_emap, trial_offsets, trial_indices;
+   /// Same as #trial_emap, etc. for the test space.
+   Array<int> test_emap, test_offsets, test_indices;
+   /** @brief If true, the matrix entries of rows shared by multiple elements
+       are taken from one element instead of being summed, as in
+       DiscreteLinearOperator::Assemble(). */
+   bool set_test_entries;
+
+public:
+   FAMixedBilinearFormExtension(MixedBilinearForm *form);
+
+   /// Full assembly of all internal integrators into a new sparse matrix
+   /** Entries whose element contributions are all zero are not stored, as
+       with the default skip_zeros = 1 in legacy assembly. */
+   void Assemble() override;
+   /// Same as MixedBilinearForm::FormRectangularSystemMatrix().
+   void FormRectangularSystemOperator(const Array<int> &trial_tdof_list,
+                                      const Array<int> &test_tdof_list,
+                                      OperatorHandle &A) override;
+   /// Same as MixedBilinearForm::FormRectangularLinearSystem().
+   void FormRectangularLinearSystem(const Array<int> &trial_tdof_list,
+                                    const Array<int> &test_tdof_list,
+                                    Vector &x, Vector &b,
+                                    OperatorHandle &A, Vector &X, Vector &B) override;
+   /// y += c*A*x
+   void AddMult(const Vector &x, Vector &y, const real_t c=1.0) const override;
+   /// y += c*A^T*x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t c=1.0) const override;
+   /// Update internals for when a new MixedBilinearForm is given to this class
+   void Update() override;
+};
+
 /**
    @brief Partial assembly extension for DiscreteLinearOperator
 
@@ -372,6 +439,18 @@ private:
    Vector test_multiplicity;
 };
 
+/**
+   @brief Full assembly extension for DiscreteLinearOperator
+
+   The entries of the rows shared by multiple elements are set rather than
+   added, see PADiscreteLinearOperatorExtension.
+*/
+class FADiscreteLinearOperatorExtension : public FAMixedBilinearFormExtension
+{
+public:
+   FADiscreteLinearOperatorExtension(DiscreteLinearOperator *linop);
+};
+
 }
 
 #endif
@@ -53,6 +53,10 @@ public:
    /** Used with BilinearFormIntegrators that have different spaces. */
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   /** @brief Return true if the methods AssemblePA(trial_fes, test_fes) and
+       AddMultPA() are implemented, as required by the assembly levels other
+       than AssemblyLevel::LEGACY of MixedBilinearForm. */
+   virtual bool SupportsMixedPA() const { return false; }
 
    /// Method defining partial assembly on NURBS patches.
    /** The result of the partial assembly is stored internally so that it can be
@@ -379,6 +383,7 @@ public:
    {
       bfi->AssemblePA(test_fes, trial_fes); // Reverse test and trial
    }
+   bool SupportsMixedPA() const override { return bfi->SupportsMixedPA(); }
 
    void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override
    {
@@ -1028,6 +1033,7 @@ protected:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector&, Vector&) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -1940,6 +1946,7 @@ protected:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector&, Vector&) const override;
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -1999,6 +2006,7 @@ protected:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector&, Vector&) const override;
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2058,6 +2066,7 @@ protected:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector&, Vector&) const override;
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2155,6 +2164,7 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -2352,7 +2362,12 @@ public:
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      AddApplyVariants<DIM,D1D,Q1D>();
    }
+
+   /// Register the apply kernels without shared memory as variants for the
+   /// KernelAutotuner.
+   template <int DIM, int D1D, int Q1D> static void AddApplyVariants();
 protected:
    const IntegrationRule* GetDefaultIntegrationRule(
       const FiniteElement& trial_fe,
@@ -2452,8 +2467,13 @@ public:
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      AddApplyVariants<DIM,D1D,Q1D>();
    }
 
+   /// Register the apply kernels without shared memory as variants for the
+   /// KernelAutotuner.
+   template <int DIM, int D1D, int Q1D> static void AddApplyVariants();
+
 protected:
    const IntegrationRule* GetDefaultIntegrationRule(
       const FiniteElement& trial_fe,
@@ -2678,6 +2698,7 @@ protected:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector&, Vector&) const override;
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -3007,6 +3028,7 @@ public:
    void AssemblePA(const FiniteElementSpace &fes) override;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddAbsMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -3056,6 +3078,7 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -3891,6 +3914,7 @@ public:
     */
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -3946,6 +3970,7 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
+   bool SupportsMixedPA() const override { return true; }
 
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
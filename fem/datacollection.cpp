@@ -18,8 +18,13 @@
 #include "picojson.h"
 
 #include <cerrno>      // errno
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <regex>
+#include <thread>
+#include <typeinfo>
 
 #ifndef _WIN32
 #include <sys/stat.h>  // mkdir
@@ -113,7 +118,32 @@ DataCollection::DataCollection(const std::string& collection_name, Mesh *mesh_)
    format = SERIAL_FORMAT; // use serial mesh format
    compression = 0;
    error = No_Error;
-}
+   async_snapshot = false;
+}
+
+DataCollection::DataCollection(const DataCollection &src)
+   : name(src.name),
+     prefix_path(src.prefix_path),
+     mesh(NULL),
+     cycle(src.cycle),
+     time(src.time),
+     time_step(src.time_step),
+     serial(src.serial),
+     appendRankToFileName(src.appendRankToFileName),
+     myid(src.myid),
+     num_procs(src.num_procs),
+#ifdef MFEM_USE_MPI
+     m_comm(src.m_comm),
+#endif
+     precision(src.precision),
+     pad_digits_cycle(src.pad_digits_cycle),
+     pad_digits_rank(src.pad_digits_rank),
+     format(src.format),
+     compression(src.compression),
+     own_data(false),
+     error(No_Error),
+     async_snapshot(true)
+{ }
 
 void DataCollection::SetMesh(Mesh *new_mesh)
 {
@@ -196,6 +226,8 @@ void DataCollection::Load(int cycle_)
 
 void DataCollection::Save()
 {
+   if (StageAsyncSave()) { return; }
+
    SaveMesh();
 
    if (error) { return; }
@@ -220,7 +252,9 @@ void DataCollection::SaveMesh()
    {
       dir_name += "_" + to_padded_string(cycle, pad_digits_cycle);
    }
-   int error_code = create_directory(dir_name, mesh, myid);
+   // The background writer does not synchronize the ranks
+   int error_code = create_directory(dir_name, async_snapshot ? NULL : mesh,
+                                     myid);
    if (error_code)
    {
       error = WRITE_ERROR;
@@ -338,10 +372,340 @@ void DataCollection::DeleteAll()
 
 DataCollection::~DataCollection()
 {
+   async_writer.reset();
    DeleteData();
 }
 
 
+// class DataCollection::AsyncWriter implementation
+
+/// Background thread writing the snapshots staged by DataCollection::Save()
+class DataCollection::AsyncWriter
+{
+   /// Copy of the mesh and of the spaces of the fields, shared by the
+   /// snapshots staged while the mesh does not change.
+   struct MeshSnapshot
+   {
+      const Mesh *source;
+      long sequence;
+      std::unique_ptr<Mesh> mesh;
+      std::map<std::string, std::unique_ptr<FiniteElementCollection>> fecs;
+      std::map<std::pair<const FiniteElementSpace*, long>,
+          std::unique_ptr<FiniteElementSpace>> fespaces;
+      std::map<const QuadratureSpaceBase*,
+          std::unique_ptr<QuadratureSpace>> qspaces;
+   };
+
+   /// A staged save: snapshot of the collection and of its fields
+   struct Job
+   {
+      std::shared_ptr<MeshSnapshot> mesh;
+      std::vector<std::unique_ptr<GridFunction>> fields;
+      std::vector<std::unique_ptr<QuadratureFunction>> q_fields;
+      std::unique_ptr<DataCollection> dc;
+      std::size_t bytes = 0;
+   };
+
+   const std::size_t max_bytes;
+   std::size_t staged_bytes = 0;
+   // Latest mesh snapshot, used by the calling thread only
+   std::shared_ptr<MeshSnapshot> mesh_snapshot;
+   // Staged saves; the first one is being written
+   std::deque<std::unique_ptr<Job>> queue;
+   // Written saves, deleted by the calling thread
+   std::vector<std::unique_ptr<Job>> done;
+   bool stop = false, write_error = false;
+   std::mutex mtx;
+   std::condition_variable cv;
+   std::thread worker;
+
+   void Run();
+   bool UseMeshSnapshot(const DataCollection &dc) const;
+   void NewMeshSnapshot(const DataCollection &dc);
+
+public:
+   AsyncWriter(std::size_t max_staged_bytes)
+      : max_bytes(max_staged_bytes), worker(&AsyncWriter::Run, this) { }
+
+   /** @brief Stage a snapshot of @a dc, waiting if the staging buffers are
+       full. Returns true if a save failed since the last call. */
+   bool Stage(const DataCollection &dc);
+
+   /** @brief Wait until all staged saves are written. Returns true if a save
+       failed since the last call. */
+   bool Wait();
+
+   ~AsyncWriter();
+};
+
+// Approximate size of the copy of a mesh: vertices, elements and nodes
+static std::size_t MeshBytes(const Mesh &mesh)
+{
+   std::size_t bytes = mesh.GetNV()*sizeof(Vertex);
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      bytes += mesh.GetElement(i)->GetNVertices()*sizeof(int);
+   }
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      bytes += mesh.GetBdrElement(i)->GetNVertices()*sizeof(int);
+   }
+   if (mesh.GetNodes()) { bytes += mesh.GetNodes()->Size()*sizeof(real_t); }
+   return bytes;
+}
+
+void DataCollection::AsyncWriter::Run()
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   while (true)
+   {
+      cv.wait(lock, [this] { return stop || !queue.empty(); });
+      if (queue.empty()) { return; }
+      Job &job = *queue.front();
+      lock.unlock();
+      bool failed;
+      try
+      {
+         job.dc->Save();
+         failed = job.dc->Error() != No_Error;
+      }
+      catch (...)
+      {
+         failed = true;
+      }
+      lock.lock();
+      write_error = write_error || failed;
+      staged_bytes -= job.bytes;
+      done.push_back(std::move(queue.front()));
+      queue.pop_front();
+      cv.notify_all();
+   }
+}
+
+bool DataCollection::AsyncWriter::UseMeshSnapshot(
+   const DataCollection &dc) const
+{
+   // Meshes with nodes are copied every time, since the nodes may move
+   const MeshSnapshot *ms = mesh_snapshot.get();
+   if (!ms || ms->source != dc.mesh || ms->sequence != dc.mesh->GetSequence() ||
+       dc.mesh->GetNodes())
+   {
+      return false;
+   }
+   for (const auto &f : dc.field_map)
+   {
+      const FiniteElementSpace *fes = f.second->FESpace();
+      if (!ms->fespaces.count(std::make_pair(fes, fes->GetSequence())))
+      {
+         return false;
+      }
+   }
+   for (const auto &f : dc.q_field_map)
+   {
+      if (!ms->qspaces.count(f.second->GetSpace())) { return false; }
+   }
+   return true;
+}
+
+void DataCollection::AsyncWriter::NewMeshSnapshot(const DataCollection &dc)
+{
+   std::shared_ptr<MeshSnapshot> ms(new MeshSnapshot);
+   ms->source = dc.mesh;
+   ms->sequence = dc.mesh->GetSequence();
+#ifdef MFEM_USE_MPI
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(dc.mesh);
+   if (pmesh) { ms->mesh.reset(new ParMesh(*pmesh, true)); }
+   else
+#endif
+   {
+      ms->mesh.reset(new Mesh(*dc.mesh, true));
+   }
+
+   // The spaces use their own copies of the collections, since the finite
+   // elements are not thread-safe
+   for (const auto &f : dc.field_map)
+   {
+      const FiniteElementSpace *fes = f.second->FESpace();
+      MFEM_VERIFY(fes->GetMesh() == dc.mesh, "field '" << f.first << "' is not "
+                  "defined on the mesh of the collection");
+      std::unique_ptr<FiniteElementSpace> &fes_copy =
+         ms->fespaces[std::make_pair(fes, fes->GetSequence())];
+      if (fes_copy) { continue; }
+      const char *fec_name = fes->FEColl()->Name();
+      std::unique_ptr<FiniteElementCollection> &fec = ms->fecs[fec_name];
+      if (!fec) { fec.reset(FiniteElementCollection::New(fec_name)); }
+#ifdef MFEM_USE_MPI
+      const ParFiniteElementSpace *pfes =
+         dynamic_cast<const ParFiniteElementSpace*>(fes);
+      if (pfes)
+      {
+         fes_copy.reset(new ParFiniteElementSpace(
+                           *pfes, static_cast<ParMesh*>(ms->mesh.get()),
+                           fec.get()));
+      }
+      else
+#endif
+      {
+         fes_copy.reset(new FiniteElementSpace(*fes, ms->mesh.get(),
+                                               fec.get()));
+      }
+   }
+
+   for (const auto &f : dc.q_field_map)
+   {
+      const QuadratureSpace *qs =
+         dynamic_cast<const QuadratureSpace*>(f.second->GetSpace());
+      MFEM_VERIFY(qs && qs->GetMesh() == dc.mesh, "q-field '" << f.first << "' "
+                  "is not defined by a QuadratureSpace on the mesh of the "
+                  "collection");
+      std::unique_ptr<QuadratureSpace> &qs_copy = ms->qspaces[qs];
+      if (qs_copy) { continue; }
+      std::stringstream ss;
+      qs->Save(ss);
+      qs_copy.reset(new QuadratureSpace(ms->mesh.get(), ss));
+   }
+   mesh_snapshot = ms;
+}
+
+bool DataCollection::AsyncWriter::Stage(const DataCollection &dc)
+{
+   MFEM_VERIFY(dc.mesh, "the collection has no mesh");
+   std::unique_ptr<Job> job(new Job);
+   job->dc.reset(dc.NewSnapshot());
+   MFEM_VERIFY(job->dc, "asynchronous saving is not supported by this "
+               "collection");
+
+   const bool new_mesh = !UseMeshSnapshot(dc);
+   if (new_mesh) { job->bytes += MeshBytes(*dc.mesh); }
+   for (const auto &f : dc.field_map)
+   {
+      job->bytes += f.second->Size()*sizeof(real_t);
+   }
+   for (const auto &f : dc.q_field_map)
+   {
+      job->bytes += f.second->Size()*sizeof(real_t);
+   }
+
+   // Back-pressure: wait until the staged saves leave room for this one
+   std::vector<std::unique_ptr<Job>> written;
+   bool failed;
+   {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [&]
+      {
+         return queue.empty() || staged_bytes + job->bytes <= max_bytes;
+      });
+      written.swap(done);
+      failed = write_error;
+      write_error = false;
+   }
+   written.clear();
+
+   if (new_mesh) { NewMeshSnapshot(dc); }
+   job->mesh = mesh_snapshot;
+   DataCollection &snapshot = *job->dc;
+   snapshot.mesh = job->mesh->mesh.get();
+   for (const auto &f : dc.field_map)
+   {
+      const FiniteElementSpace *fes = f.second->FESpace();
+      FiniteElementSpace *fes_copy =
+         job->mesh->fespaces.at(std::make_pair(fes, fes->GetSequence())).get();
+      GridFunction *gf;
+#ifdef MFEM_USE_MPI
+      ParFiniteElementSpace *pfes =
+         dynamic_cast<ParFiniteElementSpace*>(fes_copy);
+      if (pfes) { gf = new ParGridFunction(pfes); }
+      else
+#endif
+      {
+         gf = new GridFunction(fes_copy);
+      }
+      job->fields.emplace_back(gf);
+      MFEM_ASSERT(gf->Size() == f.second->Size(), "invalid field size");
+      const real_t *src = f.second->HostRead();
+      std::copy(src, src + gf->Size(), gf->HostWrite());
+      snapshot.field_map.Register(f.first, gf, false);
+   }
+   for (const auto &f : dc.q_field_map)
+   {
+      QuadratureSpace *qs = job->mesh->qspaces.at(f.second->GetSpace()).get();
+      QuadratureFunction *qf = new QuadratureFunction(qs, f.second->GetVDim());
+      job->q_fields.emplace_back(qf);
+      const real_t *src = f.second->HostRead();
+      std::copy(src, src + qf->Size(), qf->HostWrite());
+      snapshot.q_field_map.Register(f.first, qf, false);
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      staged_bytes += job->bytes;
+      queue.push_back(std::move(job));
+   }
+   cv.notify_all();
+   return failed;
+}
+
+bool DataCollection::AsyncWriter::Wait()
+{
+   std::vector<std::unique_ptr<Job>> written;
+   std::unique_lock<std::mutex> lock(mtx);
+   cv.wait(lock, [this] { return queue.empty(); });
+   written.swap(done);
+   const bool failed = write_error;
+   write_error = false;
+   return failed;
+}
+
+DataCollection::AsyncWriter::~AsyncWriter()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+   }
+   cv.notify_all();
+   worker.join();
+}
+
+DataCollection *DataCollection::NewSnapshot() const
+{
+   // Derived classes support asynchronous saving by overriding this method
+   if (typeid(*this) != typeid(DataCollection)) { return NULL; }
+   return new DataCollection(*this);
+}
+
+bool DataCollection::StageAsyncSave()
+{
+   if (!async_writer) { return false; }
+   if (async_writer->Stage(*this)) { error = WRITE_ERROR; }
+   return true;
+}
+
+void DataCollection::SetAsyncSave(bool async, std::size_t max_staged_bytes)
+{
+   if (async_writer)
+   {
+      Wait();
+      async_writer.reset();
+   }
+   if (!async) { return; }
+   // The background thread allocates host memory, and the MemoryManager
+   // registers the allocations of host memory types other than HOST in maps
+   // that are not protected against concurrent access
+   MFEM_VERIFY(Device::GetHostMemoryType() == MemoryType::HOST,
+               "asynchronous saving requires the host memory type HOST, not "
+               << MemoryTypeName[(int)Device::GetHostMemoryType()]);
+   std::unique_ptr<DataCollection> snapshot(NewSnapshot());
+   MFEM_VERIFY(snapshot, "asynchronous saving is not supported by this "
+               "collection");
+   async_writer.reset(new AsyncWriter(max_staged_bytes));
+}
+
+void DataCollection::Wait()
+{
+   if (async_writer && async_writer->Wait()) { error = WRITE_ERROR; }
+}
+
+
 // class VisItDataCollection implementation
 
 void VisItDataCollection::UpdateMeshInfo()
@@ -478,8 +842,16 @@ void VisItDataCollection::DeleteAll()
    DataCollection::DeleteAll();
 }
 
+DataCollection *VisItDataCollection::NewSnapshot() const
+{
+   if (typeid(*this) != typeid(VisItDataCollection)) { return NULL; }
+   return new VisItDataCollection(*this);
+}
+
 void VisItDataCollection::Save()
 {
+   if (StageAsyncSave()) { return; }
+
    DataCollection::Save();
    SaveRootFile();
 }
@@ -850,7 +1222,34 @@ void ParaViewDataCollectionBase::UseRestartMode(bool restart_mode_)
 
 ParaViewDataCollection::ParaViewDataCollection(
    const std::string& collection_name, Mesh *mesh_)
-   : ParaViewDataCollectionBase(collection_name, mesh_) { }
+   : ParaViewDataCollectionBase(collection_name, mesh_),
+     pvd_stream(new std::fstream) { }
+
+ParaViewDataCollection::ParaViewDataCollection(
+   const ParaViewDataCollection &src)
+   : ParaViewDataCollectionBase(src), pvd_stream(src.pvd_stream),
+     appended_output(src.appended_output) { }
+
+DataCollection *ParaViewDataCollection::NewSnapshot() const
+{
+   if (typeid(*this) != typeid(ParaViewDataCollection)) { return NULL; }
+   MFEM_VERIFY(coeff_field_map.NumFields() == 0 &&
+               vcoeff_field_map.NumFields() == 0,
+               "coefficient fields cannot be saved asynchronously");
+   // The VTU output refines the elements with GlobGeometryRefiner, which is
+   // not thread-safe: create the refined geometries on the calling thread.
+   if (mesh)
+   {
+      Array<Geometry::Type> geoms;
+      const int dim = mesh->Dimension();
+      mesh->GetGeometries(bdr_output ? dim - 1 : dim, geoms);
+      for (Geometry::Type geom : geoms)
+      {
+         GlobGeometryRefiner.Refine(geom, levels_of_detail, 1);
+      }
+   }
+   return new ParaViewDataCollection(*this);
+}
 
 std::string ParaViewDataCollection::GenerateCollectionPath()
 {
@@ -886,13 +1285,17 @@ std::string ParaViewDataCollection::GenerateVTUFileName(
 
 void ParaViewDataCollection::Save()
 {
+   if (StageAsyncSave()) { return; }
+
    // add a new collection to the PDV file
 
    std::string col_path = GenerateCollectionPath();
    // check if the directories are created
    {
       std::string path = col_path + "/" + GenerateVTUPath();
-      int error_code = create_directory(path, mesh, myid);
+      // The background writer does not synchronize the ranks
+      int error_code = create_directory(path, async_snapshot ? NULL : mesh,
+                                        myid);
       if (error_code)
       {
          error = WRITE_ERROR;
@@ -906,7 +1309,7 @@ void ParaViewDataCollection::Save()
    // is always created. In restart mode, we keep any previously defined
    // timestep values as long as they are less than the currently defined time.
 
-   if (myid == 0 && !pvd_stream.is_open())
+   if (myid == 0 && !pvd_stream->is_open())
    {
       std::string pvdname = col_path + "/" + GeneratePVDFileName();
 
@@ -954,21 +1357,21 @@ void ParaViewDataCollection::Save()
             // Open the PVD file in truncate mode to delete the previous
             // contents. Open in binary mode to write the data buffer without
             // converting \r\n to \r\r\n on Windows.
-            pvd_stream.open(pvdname,std::ios::out|std::ios::trunc|std::ios::binary);
-            pvd_stream.write(buf.data(), count);
+            pvd_stream->open(pvdname,std::ios::out|std::ios::trunc|std::ios::binary);
+            pvd_stream->write(buf.data(), count);
             // Close and reopen the file in text mode, appending to the end.
-            pvd_stream.close();
-            pvd_stream.open(pvdname,std::ios::in|std::ios::out|std::ios::ate);
+            pvd_stream->close();
+            pvd_stream->open(pvdname,std::ios::in|std::ios::out|std::ios::ate);
          }
       }
       if (write_header)
       {
          // Initialize new pvd file.
-         pvd_stream.open(pvdname,std::ios::out|std::ios::trunc);
-         pvd_stream << "<?xml version=\"1.0\"?>\n";
-         pvd_stream << "<VTKFile type=\"Collection\" version=\"2.2\"";
-         pvd_stream << " byte_order=\"" << VTKByteOrder() << "\">\n";
-         pvd_stream << "<Collection>" << std::endl;
+         pvd_stream->open(pvdname,std::ios::out|std::ios::trunc);
+         *pvd_stream << "<?xml version=\"1.0\"?>\n";
+         *pvd_stream << "<VTKFile type=\"Collection\" version=\"2.2\"";
+         *pvd_stream << " byte_order=\"" << VTKByteOrder() << "\">\n";
+         *pvd_stream << "<Collection>" << std::endl;
       }
    }
 
@@ -1043,7 +1446,7 @@ void ParaViewDataCollection::Save()
       }
 
       // Add the latest PVTU to the PVD
-      pvd_stream << "<DataSet timestep=\"" << GetTime()
+      *pvd_stream << "<DataSet timestep=\"" << GetTime()
                  << "\" group=\"\" part=\"" << 0 << "\" file=\""
                  << GeneratePVTUPath() + "/" + GeneratePVTUFileName("data")
                  << "\" name=\"mesh\"/>\n";
@@ -1068,17 +1471,17 @@ void ParaViewDataCollection::Save()
          pvtu_out << "</PPointData>\n";
          WritePVTUFooter(pvtu_out, q_field_name);
 
-         pvd_stream << "<DataSet timestep=\"" << GetTime()
+         *pvd_stream << "<DataSet timestep=\"" << GetTime()
                     << "\" group=\"\" part=\"" << 0 << "\" file=\""
                     << q_fname << "\" name=\"" << q_field_name << "\"/>\n";
       }
-      pvd_stream.flush();
+      pvd_stream->flush();
       // Move the insertion point before the closing collection tag, so that
       // the PVD file is valid even when writing incrementally.
-      std::fstream::pos_type pos = pvd_stream.tellp();
-      pvd_stream << "</Collection>\n";
-      pvd_stream << "</VTKFile>" << std::endl;
-      pvd_stream.seekp(pos);
+      std::fstream::pos_type pos = pvd_stream->tellp();
+      *pvd_stream << "</Collection>\n";
+      *pvd_stream << "</VTKFile>" << std::endl;
+      pvd_stream->seekp(pos);
    }
 }
 
@@ -1129,8 +1532,13 @@ void ParaViewDataCollection::SaveDataVTU(std::ostream &os, int ref)
    }
    os << " version=\"2.2\" byte_order=\"" << VTKByteOrder() << "\">\n";
    os << "<UnstructuredGrid>\n";
+   std::unique_ptr<VTKAppendedData> appended;
+   if (appended_output && IsBinaryFormat())
+   {
+      appended.reset(new VTKAppendedData(GetCompressionLevel()));
+   }
    mesh->PrintVTU(os,ref,pv_data_format,high_order_output,GetCompressionLevel(),
-                  bdr_output);
+                  bdr_output,appended.get());
 
    // dump out the grid functions as point data
    os << "<PointData >\n";
@@ -1141,7 +1549,7 @@ void ParaViewDataCollection::SaveDataVTU(std::ostream &os, int ref)
       MFEM_VERIFY(!bdr_output,
                   "GridFunction output is not supported for "
                   "ParaViewDataCollection on domain boundary!");
-      SaveGFieldVTU(os,ref,it);
+      SaveGFieldVTU(os,ref,it,appended.get());
    }
    // save the coefficient functions
    // iterate over all Coefficient and VectorCoefficient functions
@@ -1157,23 +1565,52 @@ void ParaViewDataCollection::SaveDataVTU(std::ostream &os, int ref)
    // close the mesh
    os << "</Piece>\n"; // close the piece open in the PrintVTU method
    os << "</UnstructuredGrid>\n";
+   if (appended) { appended->Write(os); }
    os << "</VTKFile>" << std::endl;
 }
 
 void ParaViewDataCollection::SaveGFieldVTU(std::ostream &os, int ref_,
-                                           const FieldMapIterator &it)
+                                           const FieldMapIterator &it,
+                                           VTKAppendedData *appended)
 {
    RefinedGeometry *RefG;
    Vector val;
    DenseMatrix vval, pmat;
    std::vector<char> buf;
-   int vec_dim = it->second->VectorDim();
+   const GridFunction &gf = *it->second;
+   int vec_dim = gf.VectorDim();
    os << "<DataArray type=\"" << GetDataTypeString()
       << "\" Name=\"" << it->first
       << "\" NumberOfComponents=\"" << vec_dim << "\" "
-      << VTKComponentLabels(vec_dim) << " "
-      << "format=\"" << GetDataFormatString() << "\" >" << '\n';
-   if (vec_dim == 1)
+      << VTKComponentLabels(vec_dim) << " ";
+   if (appended) { os << appended->Attributes() << " >" << '\n'; }
+   else { os << "format=\"" << GetDataFormatString() << "\" >" << '\n'; }
+
+   // In the binary formats, the fields given by scalar finite elements are
+   // evaluated in parallel
+   const FiniteElementSpace *fes = gf.FESpace();
+   std::vector<real_t> values;
+   bool evaluated = false;
+   if (pv_data_format != VTKFormat::ASCII && !fes->GetNURBSext())
+   {
+      auto get_geom = [&](int i) { return mesh->GetElementBaseGeometry(i); };
+      auto get_fe = [&](int i) { return fes->GetFE(i); };
+      auto get_dofs = [&](int i, Array<int> &vdofs, Vector &dofs)
+      {
+         DofTransformation doftrans;
+         fes->GetElementVDofs(i, vdofs, doftrans);
+         gf.GetSubVector(vdofs, dofs);
+         doftrans.InvTransformPrimal(dofs);
+      };
+      gf.HostRead();
+      evaluated = EvalVTKRefinedField(mesh->GetNE(), ref_, vec_dim, get_geom,
+                                      get_fe, get_dofs, values);
+   }
+   if (evaluated)
+   {
+      AppendVTKBinary(buf, values.data(), values.size(), pv_data_format);
+   }
+   else if (vec_dim == 1)
    {
       for (int i = 0; i < mesh->GetNE(); i++)
       {
@@ -1204,7 +1641,8 @@ void ParaViewDataCollection::SaveGFieldVTU(std::ostream &os, int ref_,
          }
       }
    }
-   if (pv_data_format != VTKFormat::ASCII)
+   if (appended) { appended->AppendAndClear(buf); }
+   else if (pv_data_format != VTKFormat::ASCII)
    {
       WriteBase64WithSizeAndClear(os, buf, GetCompressionLevel());
    }
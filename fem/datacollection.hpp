@@ -21,6 +21,7 @@
 #include <string>
 #include <map>
 #include <fstream>
+#include <memory>
 
 namespace mfem
 {
@@ -216,6 +217,26 @@ protected:
    /// Error state
    int error;
 
+   /// Background writer used in asynchronous mode, see SetAsyncSave()
+   class AsyncWriter;
+   std::unique_ptr<AsyncWriter> async_writer;
+
+   /// True for the snapshots of a collection written by the background writer
+   bool async_snapshot;
+
+   /// Copy the settings of @a src, but not its mesh and fields.
+   /** Used to create the snapshots written in asynchronous mode. */
+   DataCollection(const DataCollection &src);
+
+   /** @brief Return a new collection with the settings of this one, without
+       mesh and fields, to be written by the background writer. Returns NULL
+       if the collection does not support asynchronous saving. */
+   virtual DataCollection *NewSnapshot() const;
+
+   /** @brief In asynchronous mode, stage a snapshot of the collection for the
+       background writer and return true, otherwise return false. */
+   bool StageAsyncSave();
+
    /// Delete data owned by the DataCollection keeping field information
    void DeleteData();
    /// Delete data owned by the DataCollection including field information
@@ -375,6 +396,40 @@ public:
    /// Load the collection. Not implemented in the base class DataCollection.
    virtual void Load(int cycle_ = 0);
 
+   /// Enable or disable asynchronous saving.
+   /** In asynchronous mode, Save() copies the field data, and the mesh when it
+       changed, into staging buffers and returns, while a background thread
+       formats, compresses and writes the files. The saves are written in the
+       order they are staged. If the staged data would exceed
+       @a max_staged_bytes, Save() first waits for the pending saves to be
+       written; with the default value 0, it waits for the previous save.
+       Disabling the asynchronous mode waits for all pending saves.
+
+       The fields must be defined on the mesh of the collection. The background
+       thread does not use MPI: in parallel, every rank creates the output
+       directories. Asynchronous saving is supported by DataCollection,
+       VisItDataCollection and ParaViewDataCollection (without coefficient
+       fields).
+
+       Since the background thread allocates memory and the MemoryManager is
+       not thread-safe, asynchronous saving requires the host memory type
+       MemoryType::HOST, see Device::GetHostMemoryType(). With
+       ParaViewDataCollection, the background thread also reads the refined
+       geometries cached by GlobGeometryRefiner, which are created by Save()
+       on the calling thread. While saves are pending, the calling thread must
+       not add new refinements to this cache, e.g. with Mesh::PrintVTU() or
+       GridFunction::SaveVTK() at other refinement levels, unless it calls
+       Wait() first. */
+   void SetAsyncSave(bool async, std::size_t max_staged_bytes = 0);
+
+   /// Return true if asynchronous saving is enabled, see SetAsyncSave().
+   bool IsAsyncSave() const { return async_writer != nullptr; }
+
+   /// Wait until all asynchronous saves are written.
+   /** Errors of the background writer are reported by Error() after this call
+       or the next Save(). Does nothing if asynchronous saving is disabled. */
+   void Wait();
+
    /// Delete the mesh and fields if owned by the collection
    virtual ~DataCollection();
 
@@ -446,6 +501,9 @@ protected:
    void LoadMesh();
    void LoadFields();
 
+   VisItDataCollection(const VisItDataCollection &) = default;
+   DataCollection *NewSnapshot() const override;
+
 public:
    /// Constructor. The collection name is used when saving the data.
    /** If @a mesh_ is NULL, then the mesh can be set later by calling either
@@ -520,6 +578,8 @@ protected:
    bool bdr_output = false;
    VTKFormat pv_data_format = VTKFormat::BINARY;
 
+   ParaViewDataCollectionBase(const ParaViewDataCollectionBase &) = default;
+
 public:
    ParaViewDataCollectionBase(const std::string &name, Mesh *mesh);
 
@@ -584,7 +644,8 @@ public:
 class ParaViewDataCollection : public ParaViewDataCollectionBase
 {
 private:
-   std::fstream pvd_stream;
+   /// The PVD file, shared with the snapshots written in asynchronous mode
+   std::shared_ptr<std::fstream> pvd_stream;
 
    /// A collection of named Coefficients and VectorCoefficients
    using CoeffFieldMap = NamedFieldsMap<Coefficient>;
@@ -594,11 +655,14 @@ private:
        pointers. */
    CoeffFieldMap coeff_field_map;
    VCoeffFieldMap vcoeff_field_map;
+
+   bool appended_output = false;
 protected:
    void WritePVTUHeader(std::ostream &out);
    void WritePVTUFooter(std::ostream &out, const std::string &vtu_prefix);
    void SaveDataVTU(std::ostream &out, int ref);
-   void SaveGFieldVTU(std::ostream& out, int ref_, const FieldMapIterator& it);
+   void SaveGFieldVTU(std::ostream& out, int ref_, const FieldMapIterator& it,
+                      VTKAppendedData *appended = nullptr);
    void SaveCoeffFieldVTU(std::ostream& out, int ref_, const std::string &name,
                           Coefficient &coeff);
    void SaveVCoeffFieldVTU(std::ostream& out, int ref_, const std::string &name,
@@ -613,6 +677,9 @@ protected:
    std::string GeneratePVTUFileName(const std::string &prefix);
    std::string GeneratePVTUPath();
 
+   ParaViewDataCollection(const ParaViewDataCollection &src);
+   DataCollection *NewSnapshot() const override;
+
 public:
    /// Constructor. The collection name is used when saving the data.
    /** If @a mesh_ is NULL, then the mesh can be set later by calling SetMesh().
@@ -640,6 +707,16 @@ public:
    void DeregisterVCoeffField(const std::string& field_name)
    { vcoeff_field_map.Deregister(field_name, own_data); }
 
+   /// @brief Sets whether or not to write the mesh and grid function arrays of
+   /// the VTU files in the appended raw format (false by default).
+   ///
+   /// The arrays are then stored unencoded in the AppendedData element at the
+   /// end of the files, which is faster to write and to read, and smaller,
+   /// than the base 64 encoding. Only used with the BINARY and BINARY32
+   /// formats.
+   void SetAppendedOutput(bool appended_output_)
+   { appended_output = appended_output_; }
+
    /// Save the collection - the directory name is constructed based on the
    /// cycle value
    void Save() override;
@@ -190,6 +190,18 @@ void FiniteElementSpace::SetElementOrder(int i, int p)
    variableOrder = true;
 }
 
+void FiniteElementSpace::GetElementCosts(Vector &costs) const
+{
+   costs.SetSize(GetNE());
+   for (int i = 0; i < GetNE(); i++)
+   {
+      const FiniteElement *fe = GetFE(i);
+      const IntegrationRule &ir = IntRules.Get(fe->GetGeomType(),
+                                               2*fe->GetOrder());
+      costs(i) = real_t(fe->GetDof())*vdim*ir.GetNPoints();
+   }
+}
+
 int FiniteElementSpace::GetElementOrder(int i) const
 {
    MFEM_VERIFY(mesh_sequence == mesh->GetSequence(),
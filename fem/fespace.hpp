@@ -668,6 +668,17 @@ public:
    virtual int GetMaxElementOrder() const
    { return IsVariableOrder() ? elem_order.Max() : fec->GetOrder(); }
 
+   /** @brief Estimate the relative computational cost of each element, e.g.
+       for weighted partitioning with Mesh::GeneratePartitioning() or
+       ParMesh::RebalanceWeighted().
+
+       The cost of element i is the product of its number of vector DOFs and
+       of the number of points of its quadrature rule of order 2p, a simple
+       estimate of the work of the quadrature-based element operations. For
+       variable-order spaces this gives much larger weights to high-order
+       elements. Measured costs can be used instead, where available. */
+   void GetElementCosts(Vector &costs) const;
+
    /// Returns true if the space contains elements of varying polynomial orders.
    bool IsVariableOrder() const { return variableOrder; }
 
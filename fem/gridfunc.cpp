@@ -18,6 +18,7 @@
 #include "transfer.hpp"
 #include "../mesh/nurbs.hpp"
 #include "../mesh/vtkhdf.hpp"
+#include "../general/binaryio.hpp"
 #include "../general/text.hpp"
 
 #ifdef MFEM_USE_MPI
@@ -47,7 +48,11 @@ GridFunction::GridFunction(Mesh *m, std::istream &input)
 
    skip_comment_lines(input, '#');
    istream::int_type next_char = input.peek();
-   if (next_char == 'N') // First letter of "NURBS_patches"
+   if (next_char == 'M') // First letter of "MFEM binary vector v1.0"
+   {
+      LoadBinaryData(input);
+   }
+   else if (next_char == 'N') // First letter of "NURBS_patches"
    {
       string buff;
       getline(input, buff);
@@ -4170,6 +4175,47 @@ void GridFunction::Save(const char *fname, int precision) const
    Save(ofs);
 }
 
+void GridFunction::SaveBinary(std::ostream &os) const
+{
+   fes->Save(os);
+   os << "\nMFEM binary vector v1.0\n";
+   bin_io::BinaryWriter writer(os);
+   writer.WriteHeader();
+   writer.Write(int64_t(Size()));
+   writer.WriteArray(HostRead(), size_t(Size()));
+   os.flush();
+}
+
+void GridFunction::SaveBinary(const char *fname) const
+{
+   ofstream ofs(fname, std::ios::binary);
+   SaveBinary(ofs);
+}
+
+void GridFunction::LoadBinaryData(std::istream &input)
+{
+   string buff;
+   getline(input, buff);
+   filter_dos(buff);
+   MFEM_VERIFY(buff == "MFEM binary vector v1.0", "unknown section: " << buff);
+
+   bin_io::BinaryReader reader(input);
+   reader.ReadHeader();
+   const int64_t n = reader.Read<int64_t>();
+   MFEM_VERIFY(n == fes->GetVSize(), "invalid GridFunction size: " << n);
+   const real_t *data = reader.MapArray<real_t>(size_t(n));
+   if (data)
+   {
+      // Use the data in place, e.g. from a memory-mapped file
+      NewDataAndSize(const_cast<real_t*>(data), int(n));
+   }
+   else
+   {
+      SetSize(int(n));
+      reader.ReadArray(HostWrite(), size_t(n));
+   }
+}
+
 #ifdef MFEM_USE_ADIOS2
 void GridFunction::Save(adios2stream &os,
                         const std::string& variable_name,
@@ -92,6 +92,9 @@ protected:
    /// Loading helper.
    void LegacyNCReorder();
 
+   /// Loading helper, reading the values in the format of SaveBinary().
+   void LoadBinaryData(std::istream &input);
+
    void Destroy();
 
 public:
@@ -1626,6 +1629,18 @@ public:
    /// ASCII output.
    virtual void Save(const char *fname, int precision=16) const;
 
+   /** @brief Save the GridFunction to an output stream in a binary format,
+       which is read by the constructor GridFunction(Mesh*, std::istream&).
+
+       The FiniteElementSpace is written as in Save(), followed by the values
+       as a contiguous array, with the byte order and the size of real_t. When
+       reading from a mapped_ifstream, the values are used in place, without
+       copying. The stream should be opened in binary mode. */
+   void SaveBinary(std::ostream &out) const;
+
+   /// Save the GridFunction to a file in the format of SaveBinary().
+   void SaveBinary(const char *fname) const;
+
 #ifdef MFEM_USE_ADIOS2
    /// Save the GridFunction to a binary output stream using adios2 bp format.
    virtual void Save(adios2stream &out, const std::string& variable_name,
@@ -237,6 +237,12 @@ void FindPointsGSLIB::FindPoints(const Vector &point_pos,
                                  const int point_pos_ordering)
 {
    MFEM_VERIFY(setupflag, "Use FindPointsGSLIB::Setup before finding points.");
+   if (warm_start && point_pos.Size() == points_cnt*dim &&
+       gsl_code.Size() == points_cnt && gsl_mfem_elem.Size() == points_cnt)
+   {
+      FindPointsWarmStart(point_pos, point_pos_ordering);
+      return;
+   }
    bool dev_mode = (point_pos.UseDevice() && Device::IsEnabled());
    points_cnt = point_pos.Size() / dim;
    gsl_code.SetSize(points_cnt);
@@ -268,6 +274,14 @@ void FindPointsGSLIB::FindPoints(const Vector &point_pos,
       return;
 #endif
    }
+#if GSLIB_RELEASE_VERSION >= 10009
+   if (host_kernels && tensor_product_only)
+   {
+      // The local search kernels run on the host, threaded with OpenMP
+      FindPointsOnDevice(point_pos, point_pos_ordering);
+      return;
+   }
+#endif
 
    auto pp = point_pos.HostRead();
    auto xvFill = [&](const double *xv_base[], unsigned xv_stride[])
@@ -334,6 +348,124 @@ void FindPointsGSLIB::FindPoints(const Vector &point_pos,
    MapRefPosAndElemIndices();
 }
 
+void FindPointsGSLIB::FindPointsWarmStart(const Vector &point_pos,
+                                          const int point_pos_ordering)
+{
+   const int npt = points_cnt, id = gsl_comm->id;
+   const double rbtol = 1e-12; // must match MapRefPosAndElemIndices
+   const Table &el_to_el = mesh->ElementToElementTable();
+   const real_t *pp = point_pos.HostRead();
+   gsl_mfem_ref.HostReadWrite();
+   gsl_ref.HostReadWrite();
+   gsl_dist.HostReadWrite();
+
+   IsoparametricTransformation T;
+   InverseElementTransformation inv_tr;
+   inv_tr.SetTransformation(T);
+   Vector x(dim), x_found(dim);
+   IntegrationPoint ip;
+   Array<int> search; // points left for the global search
+
+   // Newton solve in element e, starting from ip, returning true if the point
+   // x is found in the element
+   auto FindInElement = [&](int e, bool initial_guess)
+   {
+      const Geometry::Type gt = mesh->GetElementBaseGeometry(e);
+      if (gt != Geometry::SQUARE && gt != Geometry::CUBE) { return false; }
+      mesh->GetElementTransformation(e, &T);
+      if (initial_guess) { inv_tr.SetInitialGuess(ip); }
+      else { inv_tr.SetInitialGuessType(InverseElementTransformation::Center); }
+      return inv_tr.Transform(x, ip) == InverseElementTransformation::Inside;
+   };
+
+   for (int i = 0; i < npt; i++)
+   {
+      for (int d = 0; d < dim; d++)
+      {
+         x(d) = (point_pos_ordering == Ordering::byNODES) ?
+                pp[i + d*npt] : pp[i*dim + d];
+      }
+      int elem = -1;
+      if (gsl_code[i] != CODE_NOT_FOUND && gsl_proc[i] == (unsigned int) id)
+      {
+         const int e = gsl_mfem_elem[i];
+         ip.Set(gsl_mfem_ref.GetData() + i*dim, dim);
+         if (FindInElement(e, true)) { elem = e; }
+         else
+         {
+            const int *nbr = el_to_el.GetRow(e);
+            for (int k = 0; k < el_to_el.RowSize(e) && elem < 0; k++)
+            {
+               if (FindInElement(nbr[k], false)) { elem = nbr[k]; }
+            }
+         }
+      }
+      if (elem < 0)
+      {
+         search.Append(i);
+         continue;
+      }
+
+      T.Transform(ip, x_found);
+      x_found -= x;
+      gsl_mfem_elem[i] = elem;
+      gsl_elem[i] = split_element_offset[elem];
+      ip.Get(gsl_mfem_ref.GetData() + i*dim, dim);
+      for (int d = 0; d < dim; d++)
+      {
+         gsl_ref(i*dim + d) = 2.0*gsl_mfem_ref(i*dim + d) - 1.0;
+      }
+      gsl_dist(i) = x_found.Norml2();
+      gsl_code[i] = Geometry::CheckPoint(mesh->GetElementBaseGeometry(elem),
+                                         ip, -rbtol) ? CODE_INTERNAL : CODE_BORDER;
+   }
+
+   // Global search of the remaining points, which is collective
+   const int nsearch = search.Size();
+   Vector search_pos(nsearch*dim);
+   for (int k = 0; k < nsearch; k++)
+   {
+      for (int d = 0; d < dim; d++)
+      {
+         search_pos(k*dim + d) = (point_pos_ordering == Ordering::byNODES) ?
+                                 pp[search[k] + d*npt] : pp[search[k]*dim + d];
+      }
+   }
+   Array<unsigned int> code(gsl_code), proc(gsl_proc), elem(gsl_elem),
+         mfem_elem(gsl_mfem_elem);
+   Vector ref(gsl_ref), mfem_ref(gsl_mfem_ref), dist(gsl_dist);
+   warm_start = false;
+   FindPoints(search_pos, Ordering::byVDIM);
+   warm_start = true;
+
+   // Merge the results of the global search
+   gsl_ref.HostRead();
+   gsl_mfem_ref.HostRead();
+   gsl_dist.HostRead();
+   for (int k = 0; k < nsearch; k++)
+   {
+      const int i = search[k];
+      code[i] = gsl_code[k];
+      proc[i] = gsl_proc[k];
+      elem[i] = gsl_elem[k];
+      mfem_elem[i] = gsl_mfem_elem[k];
+      dist(i) = gsl_dist(k);
+      for (int d = 0; d < dim; d++)
+      {
+         ref(i*dim + d) = gsl_ref(k*dim + d);
+         mfem_ref(i*dim + d) = gsl_mfem_ref(k*dim + d);
+      }
+   }
+   code.Swap(gsl_code);
+   proc.Swap(gsl_proc);
+   elem.Swap(gsl_elem);
+   mfem_elem.Swap(gsl_mfem_elem);
+   ref.Swap(gsl_ref);
+   mfem_ref.Swap(gsl_mfem_ref);
+   dist.Swap(gsl_dist);
+   points_cnt = npt;
+}
+
 #if GSLIB_RELEASE_VERSION >= 10009
 slong lfloor(double x) { return floor(x); }
 
@@ -1152,6 +1284,7 @@ void FindPointsGSLIB::FreeData()
    gsl_code.DeleteAll();
    gsl_proc.DeleteAll();
    gsl_elem.DeleteAll();
+   gsl_mfem_elem.DeleteAll();
    gsl_mesh.Destroy();
    gsl_ref.Destroy();
    gsl_dist.Destroy();
@@ -1449,6 +1582,7 @@ void FindPointsGSLIB::SetupSplitMeshesAndIntegrationRules(const int order)
    NE_split_total = 0;
    split_element_map.SetSize(0);
    split_element_index.SetSize(0);
+   split_element_offset.SetSize(0);
    int NEsplit = 0;
    for (int e = 0; e < mesh->GetNE(); e++)
    {
@@ -1473,6 +1607,7 @@ void FindPointsGSLIB::SetupSplitMeshesAndIntegrationRules(const int order)
       {
          MFEM_ABORT("Unsupported geometry type.");
       }
+      split_element_offset.Append(NE_split_total);
       NE_split_total += NEsplit;
       for (int i = 0; i < NEsplit; i++)
       {
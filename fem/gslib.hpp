@@ -102,6 +102,12 @@ protected:
    double     bdr_tol;
    // Use CPU functions for Mesh/GridFunction on device for gslib1.0.7
    bool       gpu_to_cpu_fallback = false;
+   // Use the local search kernels of the device path for host data
+   bool       host_kernels = false;
+   // Start the search from the elements found by the previous search
+   bool       warm_start = false;
+   // First split element of each mesh element
+   Array<int> split_element_offset;
 
    // Device specific data used for FindPoints
    struct
@@ -180,6 +186,13 @@ protected:
    // Prepare data for device functions.
    void SetupDevice();
 
+   /** Searches positions given in physical space by @a point_pos, starting
+       with a Newton solve in the elements where the same points were found by
+       the previous search, and in their face neighbors. The points that are
+       not found this way are searched with the global search. */
+   void FindPointsWarmStart(const Vector &point_pos,
+                            const int point_pos_ordering);
+
    /** Searches positions given in physical space by @a point_pos.
        These positions can be ordered byNodes: (XXX...,YYY...,ZZZ) or
        byVDim: (XYZ,XYZ,....XYZ) specified by @a point_pos_ordering. */
@@ -324,6 +337,24 @@ public:
    /// is older.
    virtual void SetGPUtoCPUFallback(bool mode) { gpu_to_cpu_fallback = mode; }
 
+   /** @brief Enable/Disable the search of host points with the local search
+       kernels used for device data, threaded with OpenMP (one point per
+       thread), instead of the serial gslib search. Used only for meshes of
+       quadrilaterals or hexahedra, with gslib v1.0.9 or later. */
+   virtual void SetHostKernels(bool mode) { host_kernels = mode; }
+
+   /** @brief Enable/Disable the warm start of FindPoints().
+
+       When enabled, and the number of points is the same as in the previous
+       call, FindPoints() assumes that the points moved only slightly since
+       then. Each point found on this MPI rank in a quadrilateral or hexahedral
+       element is first searched with a Newton solve in the same element,
+       starting from its previous reference coordinates (see GetElem() and
+       GetReferencePosition()), and then in the face neighbors of that
+       element. Only the points that are not found this way are searched with
+       the global (hash-based) search. */
+   virtual void SetWarmStart(bool mode) { warm_start = mode; }
+
    /** Cleans up memory allocated internally by gslib.
        Note that in parallel, this must be called before MPI_Finalize(), as it
        calls MPI_Comm_free() for internal gslib communicators. FreeData is
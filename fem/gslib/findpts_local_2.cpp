@@ -693,6 +693,22 @@ static MFEM_HOST_DEVICE double tensor_ig2_j(double *g_partials,
    return uJs * Jr[j];
 }
 
+// Search each point in a forall_2D kernel on the device, or in an OpenMP
+// parallel loop on the host, one point per thread.
+template <typename BODY>
+static void FindPointsForall(const int npt, const int nThreads, BODY &&body)
+{
+   if (Device::Allows(Backend::DEVICE_MASK))
+   {
+      mfem::forall_2D(npt, nThreads, 1, body);
+      return;
+   }
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < npt; i++) { body(i); }
+}
+
 template<int T_D1D = 0>
 static void FindPointsLocal2D_Kernel(const int npt,
                                      const double tol,
@@ -724,7 +740,7 @@ static void FindPointsLocal2D_Kernel(const int npt,
    MFEM_VERIFY(D1D != 0, "Polynomial order not specified.");
    const int nThreads = D1D*DIM;
 
-   mfem::forall_2D(npt, nThreads, 1, [=] MFEM_HOST_DEVICE (int i)
+   FindPointsForall(npt, nThreads, [=] MFEM_HOST_DEVICE (int i)
    {
       // 3D1D for seed, 10D1D+6 for area, 3D1D+9 for edge
       constexpr int size1 = 10*MD1 + 6;
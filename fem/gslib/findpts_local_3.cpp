@@ -1050,6 +1050,22 @@ static MFEM_HOST_DEVICE double tensor_ig3_j(double *g_partials,
    return uJtJs*Jr[j];
 }
 
+// Search each point in a forall_2D kernel on the device, or in an OpenMP
+// parallel loop on the host, one point per thread.
+template <typename BODY>
+static void FindPointsForall(const int npt, const int nThreads, BODY &&body)
+{
+   if (Device::Allows(Backend::DEVICE_MASK))
+   {
+      mfem::forall_2D(npt, nThreads, 1, body);
+      return;
+   }
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < npt; i++) { body(i); }
+}
+
 template<int T_D1D = 0>
 static void FindPointsLocal3DKernel(const int npt,
                                     const double tol,
@@ -1080,7 +1096,7 @@ static void FindPointsLocal3DKernel(const int npt,
 #define MAXC(a, b) (((a) > (b)) ? (a) : (b))
    const int nThreads = MAXC(D1D*DIM, 15);
 
-   mfem::forall_2D(npt, nThreads, 1, [=] MFEM_HOST_DEVICE (int i)
+   FindPointsForall(npt, nThreads, [=] MFEM_HOST_DEVICE (int i)
    {
       // 4 D1D for seed, 18D1D+12 for vol, 21D1D+15 for face, 3D1D+32 for edge.
       constexpr int size1 = 21*MD1+15;
@@ -14,10 +14,45 @@
 #include "hyperbolic.hpp"
 #include "nonlinearform.hpp"
 #include "pnonlinearform.hpp"
+#include "quadinterpolator.hpp"
+#include "restriction.hpp"
+#include "../general/forall.hpp"
+#include "../linalg/kernels.hpp"
 
 namespace mfem
 {
 
+// Call func(Tr, p) at the points of the face integration rule ir on all
+// interior faces of fes, where Tr is the face transformation with all
+// integration points set and p is the point index in the face E-vector
+// ordering, i.e. lexicographic with respect to the first element of the face,
+// see FaceGeometricFactors and L2FaceRestriction.
+template <typename func_t>
+static void ForallInteriorFacePoints(const FiniteElementSpace &fes,
+                                     const IntegrationRule &ir, func_t &&func)
+{
+   Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   const int nq = ir.GetNPoints();
+   const int q1d = (dim == 3) ? (int)std::lround(std::sqrt(real_t(nq))) : nq;
+   int f_ind = 0;
+   for (int f = 0; f < mesh.GetNumFacesWithGhost(); f++)
+   {
+      const Mesh::FaceInformation face = mesh.GetFaceInformation(f);
+      if (face.IsNonconformingCoarse() ||
+          !face.IsOfFaceType(FaceType::Interior)) { continue; }
+      FaceElementTransformations &Tr = *mesh.GetFaceElementTransformations(f);
+      for (int q = 0; q < nq; q++)
+      {
+         const int iq =
+            ToLexOrdering(dim, face.element[0].local_face_id, q1d, q);
+         Tr.SetAllIntPoints(&ir.IntPoint(q));
+         func(Tr, iq + nq*f_ind);
+      }
+      f_ind++;
+   }
+}
+
 HyperbolicFormIntegrator::HyperbolicFormIntegrator(
    const NumericalFlux &numFlux,
    const int IntOrderOffset,
@@ -417,6 +452,359 @@ void HyperbolicFormIntegrator::AssembleFaceGrad(
    }
 }
 
+// y(i,c,e) += Σ_q ∇φ_i(x_q)⋅G(c,:,q,e) for tensor-product elements in 2D,
+// where G are the reference fluxes, summing over the points dimension by
+// dimension.
+static void PAHyperbolicApplyGrad2D(const int NE, const int NEQ,
+                                    const int D1D, const int Q1D,
+                                    const Array<real_t> &b,
+                                    const Array<real_t> &g,
+                                    const Vector &fluxes, Vector &y)
+{
+   constexpr int MD1 = DofQuadLimits::MAX_D1D;
+   constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto G = Reshape(g.Read(), Q1D, D1D);
+   const auto F = Reshape(fluxes.Read(), NEQ, 2, Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, NEQ, NE);
+
+   mfem::forall(NEQ*NE, [=] MFEM_HOST_DEVICE (int t)
+   {
+      const int c = t % NEQ;
+      const int e = t / NEQ;
+      real_t A0[MD1][MQ1], A1[MD1][MQ1];
+      for (int qy = 0; qy < Q1D; qy++)
+      {
+         for (int dx = 0; dx < D1D; dx++)
+         {
+            real_t a0 = 0.0, a1 = 0.0;
+            for (int qx = 0; qx < Q1D; qx++)
+            {
+               a0 += G(qx,dx) * F(c,0,qx,qy,e);
+               a1 += B(qx,dx) * F(c,1,qx,qy,e);
+            }
+            A0[dx][qy] = a0;
+            A1[dx][qy] = a1;
+         }
+      }
+      for (int dy = 0; dy < D1D; dy++)
+      {
+         for (int dx = 0; dx < D1D; dx++)
+         {
+            real_t v = 0.0;
+            for (int qy = 0; qy < Q1D; qy++)
+            {
+               v += B(qy,dy) * A0[dx][qy] + G(qy,dy) * A1[dx][qy];
+            }
+            Y(dx,dy,c,e) += v;
+         }
+      }
+   });
+}
+
+// 3D version of PAHyperbolicApplyGrad2D().
+static void PAHyperbolicApplyGrad3D(const int NE, const int NEQ,
+                                    const int D1D, const int Q1D,
+                                    const Array<real_t> &b,
+                                    const Array<real_t> &g,
+                                    const Vector &fluxes, Vector &y)
+{
+   constexpr int MD1 = DofQuadLimits::MAX_D1D;
+   constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto G = Reshape(g.Read(), Q1D, D1D);
+   const auto F = Reshape(fluxes.Read(), NEQ, 3, Q1D, Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, D1D, NEQ, NE);
+
+   mfem::forall(NEQ*NE, [=] MFEM_HOST_DEVICE (int t)
+   {
+      const int c = t % NEQ;
+      const int e = t / NEQ;
+      real_t A0[MD1][MQ1], A1[MD1][MQ1], A2[MD1][MQ1];
+      real_t C0[MD1][MD1], C1[MD1][MD1];
+      for (int qz = 0; qz < Q1D; qz++)
+      {
+         for (int qy = 0; qy < Q1D; qy++)
+         {
+            for (int dx = 0; dx < D1D; dx++)
+            {
+               real_t a0 = 0.0, a1 = 0.0, a2 = 0.0;
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  a0 += G(qx,dx) * F(c,0,qx,qy,qz,e);
+                  a1 += B(qx,dx) * F(c,1,qx,qy,qz,e);
+                  a2 += B(qx,dx) * F(c,2,qx,qy,qz,e);
+               }
+               A0[dx][qy] = a0;
+               A1[dx][qy] = a1;
+               A2[dx][qy] = a2;
+            }
+         }
+         for (int dy = 0; dy < D1D; dy++)
+         {
+            for (int dx = 0; dx < D1D; dx++)
+            {
+               real_t c01 = 0.0, c2 = 0.0;
+               for (int qy = 0; qy < Q1D; qy++)
+               {
+                  c01 += B(qy,dy) * A0[dx][qy] + G(qy,dy) * A1[dx][qy];
+                  c2 += B(qy,dy) * A2[dx][qy];
+               }
+               C0[dx][dy] = c01;
+               C1[dx][dy] = c2;
+            }
+         }
+         for (int dz = 0; dz < D1D; dz++)
+         {
+            for (int dy = 0; dy < D1D; dy++)
+            {
+               for (int dx = 0; dx < D1D; dx++)
+               {
+                  Y(dx,dy,dz,c,e) += B(qz,dz) * C0[dx][dy] +
+                                     G(qz,dz) * C1[dx][dy];
+               }
+            }
+         }
+      }
+   });
+}
+
+void HyperbolicFormIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   MFEM_VERIFY(fes.IsDGSpace() && !fes.IsVariableOrder(),
+               "Partial assembly requires a fixed-order DG space.");
+   MFEM_VERIFY(dim > 1 && dim == mesh.SpaceDimension(),
+               "Partial assembly requires dim == space dim > 1.");
+   MFEM_VERIFY(fes.GetVDim() == num_equations,
+               "The vector dimension must be the number of equations.");
+   const FiniteElement &el = *fes.GetTypicalFE();
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(&el),
+               "Partial assembly requires tensor-product elements.");
+
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+   pa_fes = &fes;
+   pa_ne = fes.GetNE();
+   pa_ir = IntRule ? IntRule :
+           &IntRules.Get(el.GetGeomType(), 2*el.GetOrder() + IntOrderOffset);
+   pa_maps = &el.GetDofToQuad(*pa_ir, DofToQuad::TENSOR);
+   MFEM_VERIFY(pa_maps->ndof <= DeviceDofQuadLimits::Get().MAX_D1D &&
+               pa_maps->nqpt <= DeviceDofQuadLimits::Get().MAX_Q1D,
+               "Orders higher than " << DeviceDofQuadLimits::Get().MAX_D1D-1
+               << " are not supported!");
+
+   const int NE = pa_ne;
+   const int NQ = pa_ir->GetNPoints();
+   const GeometricFactors *geom =
+      mesh.GetGeometricFactors(*pa_ir, GeometricFactors::JACOBIANS, mt);
+   pa_adj.SetSize(dim*dim*NQ*NE, mt);
+
+   const auto W = pa_ir->GetWeights().Read();
+   const auto J = Reshape(geom->J.Read(), NQ, dim, dim, NE);
+   auto A = Reshape(pa_adj.Write(), dim, dim, NQ, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const int q = p % NQ;
+      const int e = p / NQ;
+      real_t Jq[9], adj[9];
+      for (int j = 0; j < dim; j++)
+      {
+         for (int i = 0; i < dim; i++) { Jq[i + dim*j] = J(q,i,j,e); }
+      }
+      if (dim == 2) { kernels::CalcAdjugate<2>(Jq, adj); }
+      else { kernels::CalcAdjugate<3>(Jq, adj); }
+      for (int j = 0; j < dim; j++)
+      {
+         for (int i = 0; i < dim; i++) { A(i,j,q,e) = W[q] * adj[i + dim*j]; }
+      }
+   });
+
+   pa_states.SetSize(num_equations*NQ*NE, mt);
+   pa_fluxes.SetSize(num_equations*dim*NQ*NE, mt);
+   pa_speeds.SetSize(NQ*NE, mt);
+   pa_speeds.UseDevice(true);
+}
+
+void HyperbolicFormIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(pa_fes, "AssemblePA() must be called first.");
+   const int dim = fluxFunction.dim;
+   const int NEQ = num_equations;
+   const int NE = pa_ne;
+   const int NQ = pa_ir->GetNPoints();
+   const real_t s = sign;
+
+   // Interpolate the states and evaluate the fluxes at all points
+   const QuadratureInterpolator *qi =
+      pa_fes->GetQuadratureInterpolator(*pa_ir);
+   qi->SetOutputLayout(QVectorLayout::byVDIM);
+   qi->Values(x, pa_states);
+   fluxFunction.ComputeFluxes(pa_states, *pa_fes, *pa_ir, pa_fluxes,
+                              pa_speeds);
+   max_char_speed = std::max(max_char_speed, pa_speeds.Max());
+
+   // Map the fluxes to the reference element, including the weights:
+   // F(c,:) <- sign * w * adj(J) F(c,:)
+   const auto A = Reshape(pa_adj.Read(), dim, dim, NQ, NE);
+   auto F = Reshape(pa_fluxes.ReadWrite(), NEQ, dim, NQ, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const int q = p % NQ;
+      const int e = p / NQ;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t Fc[3];
+         for (int d = 0; d < dim; d++) { Fc[d] = F(c,d,q,e); }
+         for (int k = 0; k < dim; k++)
+         {
+            real_t v = 0.0;
+            for (int d = 0; d < dim; d++) { v += A(k,d,q,e) * Fc[d]; }
+            F(c,k,q,e) = s * v;
+         }
+      }
+   });
+
+   // Integrate against the gradients of the test functions
+   const int D1D = pa_maps->ndof;
+   const int Q1D = pa_maps->nqpt;
+   if (dim == 2)
+   {
+      PAHyperbolicApplyGrad2D(NE, NEQ, D1D, Q1D, pa_maps->B, pa_maps->G,
+                              pa_fluxes, y);
+   }
+   else
+   {
+      PAHyperbolicApplyGrad3D(NE, NEQ, D1D, Q1D, pa_maps->B, pa_maps->G,
+                              pa_fluxes, y);
+   }
+}
+
+void HyperbolicFormIntegrator::AssembleFacePA(const FiniteElementSpace &fes)
+{
+   Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   MFEM_VERIFY(fes.IsDGSpace() && !fes.IsVariableOrder(),
+               "Partial assembly requires a fixed-order DG space.");
+   MFEM_VERIFY(dim > 1 && dim == mesh.SpaceDimension(),
+               "Partial assembly requires dim == space dim > 1.");
+   MFEM_VERIFY(mesh.Conforming(),
+               "Partial assembly requires a conforming mesh.");
+   MFEM_VERIFY(fes.GetVDim() == num_equations,
+               "The vector dimension must be the number of equations.");
+   const TensorBasisElement *tfe =
+      dynamic_cast<const TensorBasisElement*>(fes.GetTypicalFE());
+   MFEM_VERIFY(tfe, "Partial assembly requires tensor-product elements.");
+   MFEM_VERIFY(tfe->GetBasisType() == BasisType::GaussLobatto ||
+               tfe->GetBasisType() == BasisType::Positive,
+               "Partial assembly on faces requires a Gauss-Lobatto or a "
+               "Bernstein basis, see L2FaceRestriction.");
+   const FiniteElement &el = *fes.GetTypicalTraceElement();
+
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+   pa_fes = &fes;
+   const int order = fes.GetTypicalFE()->GetOrder();
+   pa_face_ir = IntRule ? IntRule :
+                &IntRules.Get(el.GetGeomType(), 2*order + IntOrderOffset);
+   pa_face_maps = &el.GetDofToQuad(*pa_face_ir, DofToQuad::TENSOR);
+   pa_nf = fes.GetNFbyType(FaceType::Interior);
+
+   const int NF = pa_nf;
+   const int NQ = pa_face_ir->GetNPoints();
+   pa_nor.SetSize(dim*NQ*NF, mt);
+   pa_states1.SetSize(num_equations*NQ*NF, mt);
+   pa_states2.SetSize(num_equations*NQ*NF, mt);
+   pa_fluxN.SetSize(num_equations*NQ*NF, mt);
+   pa_face_speeds.SetSize(NQ*NF, mt);
+   pa_face_speeds.UseDevice(true);
+   if (NF == 0) { return; }
+
+   // Scaled normals, see CalcOrtho()
+   const FaceGeometricFactors *geom = mesh.GetFaceGeometricFactors(
+                                         *pa_face_ir,
+                                         FaceGeometricFactors::DETERMINANTS |
+                                         FaceGeometricFactors::NORMALS,
+                                         FaceType::Interior, mt);
+   const auto detJ = Reshape(geom->detJ.Read(), NQ, NF);
+   const auto n = Reshape(geom->normal.Read(), NQ, dim, NF);
+   auto N = Reshape(pa_nor.Write(), dim, NQ, NF);
+   mfem::forall(NQ*NF, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const int q = p % NQ;
+      const int f = p / NQ;
+      for (int d = 0; d < dim; d++) { N(d,q,f) = n(q,d,f) * detJ(q,f); }
+   });
+}
+
+void HyperbolicFormIntegrator::AddMultFacePA(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(pa_face_maps, "AssembleFacePA() must be called first.");
+   if (pa_nf == 0) { return; }
+   const int dim = fluxFunction.dim;
+   const int NEQ = num_equations;
+   const int NF = pa_nf;
+   const int NQ = pa_face_ir->GetNPoints();
+   const int D1D = pa_face_maps->ndof;
+   const int Q1D = pa_face_maps->nqpt;
+   const int ND = (dim == 3) ? D1D*D1D : D1D;
+   const real_t s = sign;
+   const auto B = Reshape(pa_face_maps->B.Read(), Q1D, D1D);
+
+   // Interpolate the states from both sides to the face points
+   const auto X = Reshape(x.Read(), ND, NEQ, 2, NF);
+   auto U1 = Reshape(pa_states1.Write(), NEQ, NQ, NF);
+   auto U2 = Reshape(pa_states2.Write(), NEQ, NQ, NF);
+   mfem::forall(NQ*NF, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const int q = p % NQ;
+      const int f = p / NQ;
+      const int q1 = q % Q1D, q2 = q / Q1D;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t u1 = 0.0, u2 = 0.0;
+         for (int i = 0; i < ND; i++)
+         {
+            const int i1 = i % D1D, i2 = i / D1D;
+            const real_t b = (dim == 3) ? B(q1,i1) * B(q2,i2) : B(q1,i1);
+            u1 += b * X(i,c,0,f);
+            u2 += b * X(i,c,1,f);
+         }
+         U1(c,q,f) = u1;
+         U2(c,q,f) = u2;
+      }
+   });
+
+   numFlux.EvalFaces(pa_states1, pa_states2, pa_nor, *pa_fes, *pa_face_ir,
+                     pa_fluxN, pa_face_speeds);
+   max_char_speed = std::max(max_char_speed, pa_face_speeds.Max());
+
+   // Integrate -F̂ n against the test functions of the first element and
+   // +F̂ n against the ones of the second element
+   const auto W = pa_face_ir->GetWeights().Read();
+   const auto Fn = Reshape(pa_fluxN.Read(), NEQ, NQ, NF);
+   auto Y = Reshape(y.ReadWrite(), ND, NEQ, 2, NF);
+   mfem::forall(ND*NF, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const int i = p % ND;
+      const int f = p / ND;
+      const int i1 = i % D1D, i2 = i / D1D;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t v = 0.0;
+         for (int q = 0; q < NQ; q++)
+         {
+            const int q1 = q % Q1D, q2 = q / Q1D;
+            const real_t b = (dim == 3) ? B(q1,i1) * B(q2,i2) : B(q1,i1);
+            v += b * W[q] * Fn(c,q,f);
+         }
+         Y(i,c,0,f) -= s * v;
+         Y(i,c,1,f) += s * v;
+      }
+   });
+}
+
 BdrHyperbolicDirichletIntegrator::BdrHyperbolicDirichletIntegrator(
    const NumericalFlux &numFlux,
    VectorCoefficient &bdrState,
@@ -751,6 +1139,80 @@ void FluxFunction::ComputeFluxJacobianDotN(const Vector &U,
    }
 }
 
+void FluxFunction::ComputeFluxes(const Vector &states,
+                                 const FiniteElementSpace &fes,
+                                 const IntegrationRule &ir,
+                                 Vector &fluxes, Vector &speeds) const
+{
+   const int nq = ir.GetNPoints();
+   const int ne = fes.GetNE();
+   const auto U = Reshape(states.HostRead(), num_equations, nq, ne);
+   auto F = Reshape(fluxes.HostWrite(), num_equations, dim, nq, ne);
+   auto S = Reshape(speeds.HostWrite(), nq, ne);
+   Vector state(num_equations);
+   DenseMatrix flux_q;
+   for (int e = 0; e < ne; e++)
+   {
+      ElementTransformation &Tr = *fes.GetElementTransformation(e);
+      for (int q = 0; q < nq; q++)
+      {
+         Tr.SetIntPoint(&ir.IntPoint(q));
+         for (int i = 0; i < num_equations; i++) { state(i) = U(i,q,e); }
+         flux_q.UseExternalData(&F(0,0,q,e), num_equations, dim);
+         S(q,e) = ComputeFlux(state, Tr, flux_q);
+      }
+   }
+}
+
+void FluxFunction::ComputeFluxesDotN(const Vector &states,
+                                     const Vector &normals,
+                                     const FiniteElementSpace &fes,
+                                     const IntegrationRule &ir,
+                                     Vector &fluxDotN, Vector &speeds) const
+{
+   const int np = speeds.Size();
+   const auto U = Reshape(states.HostRead(), num_equations, np);
+   const auto N = Reshape(normals.HostRead(), dim, np);
+   auto F = Reshape(fluxDotN.HostWrite(), num_equations, np);
+   auto S = speeds.HostWrite();
+   Vector state(num_equations), nor(dim), fluxN(num_equations);
+   ForallInteriorFacePoints(fes, ir, [&](FaceElementTransformations &Tr, int p)
+   {
+      for (int i = 0; i < num_equations; i++) { state(i) = U(i,p); }
+      for (int d = 0; d < dim; d++) { nor(d) = N(d,p); }
+      S[p] = ComputeFluxDotN(state, nor, Tr, fluxN);
+      for (int i = 0; i < num_equations; i++) { F(i,p) = fluxN(i); }
+   });
+}
+
+void NumericalFlux::EvalFaces(const Vector &states1, const Vector &states2,
+                              const Vector &normals,
+                              const FiniteElementSpace &fes,
+                              const IntegrationRule &ir,
+                              Vector &fluxes, Vector &speeds) const
+{
+   const int neq = fluxFunction.num_equations;
+   const int dim = fluxFunction.dim;
+   const int np = speeds.Size();
+   const auto U1 = Reshape(states1.HostRead(), neq, np);
+   const auto U2 = Reshape(states2.HostRead(), neq, np);
+   const auto N = Reshape(normals.HostRead(), dim, np);
+   auto F = Reshape(fluxes.HostWrite(), neq, np);
+   auto S = speeds.HostWrite();
+   Vector state1(neq), state2(neq), nor(dim), flux(neq);
+   ForallInteriorFacePoints(fes, ir, [&](FaceElementTransformations &Tr, int p)
+   {
+      for (int i = 0; i < neq; i++)
+      {
+         state1(i) = U1(i,p);
+         state2(i) = U2(i,p);
+      }
+      for (int d = 0; d < dim; d++) { nor(d) = N(d,p); }
+      S[p] = Eval(state1, state2, nor, Tr, flux);
+      for (int i = 0; i < neq; i++) { F(i,p) = flux(i); }
+   });
+}
+
 RusanovFlux::RusanovFlux(const FluxFunction &fluxFunction)
    : NumericalFlux(fluxFunction)
 {
@@ -908,6 +1370,44 @@ void RusanovFlux::AverageGrad(int side, const Vector &state1,
    }
 }
 
+void RusanovFlux::EvalFaces(const Vector &states1, const Vector &states2,
+                            const Vector &normals,
+                            const FiniteElementSpace &fes,
+                            const IntegrationRule &ir,
+                            Vector &fluxes, Vector &speeds) const
+{
+   const int neq = fluxFunction.num_equations;
+   const int dim = fluxFunction.dim;
+   const int np = speeds.Size();
+   fluxesN1.SetSize(neq*np, Device::GetDeviceMemoryType());
+   fluxesN2.SetSize(neq*np, Device::GetDeviceMemoryType());
+   speeds2.SetSize(np, Device::GetDeviceMemoryType());
+   fluxFunction.ComputeFluxesDotN(states1, normals, fes, ir, fluxesN1, speeds);
+   fluxFunction.ComputeFluxesDotN(states2, normals, fes, ir, fluxesN2, speeds2);
+
+   const auto U1 = Reshape(states1.Read(), neq, np);
+   const auto U2 = Reshape(states2.Read(), neq, np);
+   const auto F1 = Reshape(fluxesN1.Read(), neq, np);
+   const auto F2 = Reshape(fluxesN2.Read(), neq, np);
+   const auto N = Reshape(normals.Read(), dim, np);
+   const auto S2 = speeds2.Read();
+   auto S = speeds.ReadWrite();
+   auto F = Reshape(fluxes.Write(), neq, np);
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t maxE = fmax(S[p], S2[p]);
+      real_t nor2 = 0.0;
+      for (int d = 0; d < dim; d++) { nor2 += N(d,p) * N(d,p); }
+      // here, |nor| is multiplied to match the scale with the normal fluxes
+      const real_t scaledMaxE = maxE * sqrt(nor2);
+      for (int i = 0; i < neq; i++)
+      {
+         F(i,p) = 0.5*(scaledMaxE*(U1(i,p) - U2(i,p)) + (F1(i,p) + F2(i,p)));
+      }
+      S[p] = maxE;
+   });
+}
+
 ComponentwiseUpwindFlux::ComponentwiseUpwindFlux(
    const FluxFunction &fluxFunction)
    : NumericalFlux(fluxFunction)
@@ -1087,6 +1587,39 @@ void ComponentwiseUpwindFlux::AverageGrad(int side, const Vector &state1,
    }
 }
 
+void ComponentwiseUpwindFlux::EvalFaces(const Vector &states1,
+                                        const Vector &states2,
+                                        const Vector &normals,
+                                        const FiniteElementSpace &fes,
+                                        const IntegrationRule &ir,
+                                        Vector &fluxes, Vector &speeds) const
+{
+   const int neq = fluxFunction.num_equations;
+   const int np = speeds.Size();
+   fluxesN1.SetSize(neq*np, Device::GetDeviceMemoryType());
+   fluxesN2.SetSize(neq*np, Device::GetDeviceMemoryType());
+   speeds2.SetSize(np, Device::GetDeviceMemoryType());
+   fluxFunction.ComputeFluxesDotN(states1, normals, fes, ir, fluxesN1, speeds);
+   fluxFunction.ComputeFluxesDotN(states2, normals, fes, ir, fluxesN2, speeds2);
+
+   const auto U1 = Reshape(states1.Read(), neq, np);
+   const auto U2 = Reshape(states2.Read(), neq, np);
+   const auto F1 = Reshape(fluxesN1.Read(), neq, np);
+   const auto F2 = Reshape(fluxesN2.Read(), neq, np);
+   const auto S2 = speeds2.Read();
+   auto S = speeds.ReadWrite();
+   auto F = Reshape(fluxes.Write(), neq, np);
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      for (int i = 0; i < neq; i++)
+      {
+         F(i,p) = (U1(i,p) <= U2(i,p)) ? fmin(F1(i,p), F2(i,p)) :
+                  fmax(F1(i,p), F2(i,p));
+      }
+      S[p] = fmax(S[p], S2[p]);
+   });
+}
+
 real_t AdvectionFlux::ComputeFlux(const Vector &U,
                                   ElementTransformation &Tr,
                                   DenseMatrix &FU) const
@@ -1221,6 +1754,44 @@ void BurgersFlux::ComputeFluxJacobianDotN(const Vector &U,
    JDotN(0,0) = U(0) * normal.Sum();
 }
 
+void BurgersFlux::ComputeFluxes(const Vector &states,
+                                const FiniteElementSpace &fes,
+                                const IntegrationRule &ir,
+                                Vector &fluxes, Vector &speeds) const
+{
+   const int d = dim;
+   const int np = speeds.Size();
+   const auto U = states.Read();
+   auto F = Reshape(fluxes.Write(), d, np);
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      for (int k = 0; k < d; k++) { F(k,p) = U[p] * U[p] * 0.5; }
+      S[p] = fabs(U[p]);
+   });
+}
+
+void BurgersFlux::ComputeFluxesDotN(const Vector &states,
+                                    const Vector &normals,
+                                    const FiniteElementSpace &fes,
+                                    const IntegrationRule &ir,
+                                    Vector &fluxDotN, Vector &speeds) const
+{
+   const int d = dim;
+   const int np = speeds.Size();
+   const auto U = states.Read();
+   const auto N = Reshape(normals.Read(), d, np);
+   auto F = fluxDotN.Write();
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      real_t nsum = 0.0;
+      for (int k = 0; k < d; k++) { nsum += N(k,p); }
+      F[p] = U[p] * U[p] * 0.5 * nsum;
+      S[p] = fabs(U[p]);
+   });
+}
+
 real_t ShallowWaterFlux::ComputeFlux(const Vector &U,
                                      ElementTransformation &Tr,
                                      DenseMatrix &FU) const
@@ -1273,6 +1844,92 @@ real_t ShallowWaterFlux::ComputeFluxDotN(const Vector &U,
    return vel + sound;
 }
 
+// Shallow water flux F(U) at a point, F(i,d) = F[i + (dim+1)*d], returning
+// the maximum characteristic speed, see ShallowWaterFlux::ComputeFlux().
+MFEM_HOST_DEVICE static inline
+real_t ShallowWaterPointFlux(const int dim, const real_t g, const real_t *U,
+                             real_t *F)
+{
+   const int neq = dim + 1;
+   const real_t height = U[0];
+   const real_t *h_vel = U + 1;
+   const real_t energy = 0.5 * g * (height * height);
+   real_t h_vel2 = 0.0;
+   for (int d = 0; d < dim; d++)
+   {
+      F[neq*d] = h_vel[d];
+      for (int i = 0; i < dim; i++)
+      {
+         F[1 + i + neq*d] = h_vel[i] * h_vel[d] / height;
+      }
+      F[1 + d + neq*d] += energy;
+      h_vel2 += h_vel[d] * h_vel[d];
+   }
+   return sqrt(h_vel2) / height + sqrt(g * height);
+}
+
+// Shallow water normal flux F(U) n at a point, returning the maximum
+// characteristic speed, see ShallowWaterFlux::ComputeFluxDotN().
+MFEM_HOST_DEVICE static inline
+real_t ShallowWaterPointFluxDotN(const int dim, const real_t g,
+                                 const real_t *U, const real_t *nor,
+                                 real_t *FN)
+{
+   const real_t height = U[0];
+   const real_t *h_vel = U + 1;
+   const real_t energy = 0.5 * g * (height * height);
+   real_t h_vel_n = 0.0, nor2 = 0.0;
+   for (int d = 0; d < dim; d++)
+   {
+      h_vel_n += h_vel[d] * nor[d];
+      nor2 += nor[d] * nor[d];
+   }
+   FN[0] = h_vel_n;
+   const real_t normal_vel = h_vel_n / height;
+   for (int i = 0; i < dim; i++)
+   {
+      FN[1 + i] = normal_vel * h_vel[i] + energy * nor[i];
+   }
+   return fabs(normal_vel) / sqrt(nor2) + sqrt(g * height);
+}
+
+void ShallowWaterFlux::ComputeFluxes(const Vector &states,
+                                     const FiniteElementSpace &fes,
+                                     const IntegrationRule &ir,
+                                     Vector &fluxes, Vector &speeds) const
+{
+   const int d = dim, neq = num_equations;
+   const real_t grav = g;
+   const int np = speeds.Size();
+   const auto U = Reshape(states.Read(), neq, np);
+   auto F = Reshape(fluxes.Write(), neq, d, np);
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      S[p] = ShallowWaterPointFlux(d, grav, &U(0,p), &F(0,0,p));
+   });
+}
+
+void ShallowWaterFlux::ComputeFluxesDotN(const Vector &states,
+                                         const Vector &normals,
+                                         const FiniteElementSpace &fes,
+                                         const IntegrationRule &ir,
+                                         Vector &fluxDotN,
+                                         Vector &speeds) const
+{
+   const int d = dim, neq = num_equations;
+   const real_t grav = g;
+   const int np = speeds.Size();
+   const auto U = Reshape(states.Read(), neq, np);
+   const auto N = Reshape(normals.Read(), d, np);
+   auto F = Reshape(fluxDotN.Write(), neq, np);
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      S[p] = ShallowWaterPointFluxDotN(d, grav, &U(0,p), &N(0,p), &F(0,p));
+   });
+}
+
 
 real_t EulerFlux::ComputeFlux(const Vector &U,
                               ElementTransformation &Tr,
@@ -1365,4 +2022,100 @@ real_t EulerFlux::ComputeFluxDotN(const Vector &x,
    return speed + sound;
 }
 
+// Euler flux F(U) at a point, F(i,d) = F[i + (dim+2)*d], returning the
+// maximum characteristic speed, see EulerFlux::ComputeFlux().
+MFEM_HOST_DEVICE static inline
+real_t EulerPointFlux(const int dim, const real_t gamma, const real_t *U,
+                      real_t *F)
+{
+   const int neq = dim + 2;
+   const real_t density = U[0];          // ρ
+   const real_t *momentum = U + 1;       // ρu
+   const real_t energy = U[1 + dim];     // E
+   real_t momentum2 = 0.0;
+   for (int d = 0; d < dim; d++) { momentum2 += momentum[d] * momentum[d]; }
+   const real_t kinetic_energy = 0.5 * momentum2 / density;
+   const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+   const real_t H = (energy + pressure) / density;
+   for (int d = 0; d < dim; d++)
+   {
+      F[neq*d] = momentum[d];
+      for (int i = 0; i < dim; i++)
+      {
+         F[1 + i + neq*d] = momentum[i] * momentum[d] / density;
+      }
+      F[1 + d + neq*d] += pressure;
+      F[1 + dim + neq*d] = momentum[d] * H;
+   }
+   const real_t sound = sqrt(gamma * pressure / density);
+   const real_t speed = sqrt(2.0 * kinetic_energy / density);
+   return speed + sound;
+}
+
+// Euler normal flux F(U) n at a point, returning the maximum characteristic
+// speed, see EulerFlux::ComputeFluxDotN().
+MFEM_HOST_DEVICE static inline
+real_t EulerPointFluxDotN(const int dim, const real_t gamma, const real_t *U,
+                          const real_t *nor, real_t *FN)
+{
+   const real_t density = U[0];          // ρ
+   const real_t *momentum = U + 1;       // ρu
+   const real_t energy = U[1 + dim];     // E
+   real_t momentum2 = 0.0, momentum_n = 0.0, nor2 = 0.0;
+   for (int d = 0; d < dim; d++)
+   {
+      momentum2 += momentum[d] * momentum[d];
+      momentum_n += momentum[d] * nor[d];
+      nor2 += nor[d] * nor[d];
+   }
+   const real_t kinetic_energy = 0.5 * momentum2 / density;
+   const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+   FN[0] = momentum_n;
+   const real_t normal_velocity = momentum_n / density;
+   for (int d = 0; d < dim; d++)
+   {
+      FN[1 + d] = normal_velocity * momentum[d] + pressure * nor[d];
+   }
+   FN[1 + dim] = normal_velocity * (energy + pressure);
+   const real_t sound = sqrt(gamma * pressure / density);
+   const real_t speed = fabs(normal_velocity) / sqrt(nor2);
+   return speed + sound;
+}
+
+void EulerFlux::ComputeFluxes(const Vector &states,
+                              const FiniteElementSpace &fes,
+                              const IntegrationRule &ir,
+                              Vector &fluxes, Vector &speeds) const
+{
+   const int d = dim, neq = num_equations;
+   const real_t gamma = specific_heat_ratio;
+   const int np = speeds.Size();
+   const auto U = Reshape(states.Read(), neq, np);
+   auto F = Reshape(fluxes.Write(), neq, d, np);
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      S[p] = EulerPointFlux(d, gamma, &U(0,p), &F(0,0,p));
+   });
+}
+
+void EulerFlux::ComputeFluxesDotN(const Vector &states,
+                                  const Vector &normals,
+                                  const FiniteElementSpace &fes,
+                                  const IntegrationRule &ir,
+                                  Vector &fluxDotN, Vector &speeds) const
+{
+   const int d = dim, neq = num_equations;
+   const real_t gamma = specific_heat_ratio;
+   const int np = speeds.Size();
+   const auto U = Reshape(states.Read(), neq, np);
+   const auto N = Reshape(normals.Read(), d, np);
+   auto F = Reshape(fluxDotN.Write(), neq, np);
+   auto S = speeds.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int p)
+   {
+      S[p] = EulerPointFluxDotN(d, gamma, &U(0,p), &N(0,p), &F(0,p));
+   });
+}
+
 } // namespace mfem
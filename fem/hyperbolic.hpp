@@ -48,6 +48,18 @@ namespace mfem
 // Note: To avoid communication overhead, we update the maximum characteristic
 // speed within each MPI process only. Use the appropriate MPI routine to gather
 // the information.
+//
+// HyperbolicFormIntegrator also supports partial assembly, see
+// AssemblyLevel::PARTIAL and NonlinearForm::SetAssemblyLevel(), for DG spaces
+// with tensor-product elements in 2D and 3D. As an interior face integrator,
+// this requires a conforming mesh and a Gauss-Lobatto or Bernstein basis. The
+// states are then interpolated to the quadrature points of all elements and
+// interior faces at once, and the fluxes are evaluated in batches by
+// FluxFunction::ComputeFluxes(), FluxFunction::ComputeFluxesDotN() and
+// NumericalFlux::EvalFaces(). The default implementations of these methods
+// loop over the points on the host, while BurgersFlux, ShallowWaterFlux and
+// EulerFlux, together with RusanovFlux and ComponentwiseUpwindFlux, evaluate
+// them with device kernels.
 
 /**
  * @brief Abstract class for hyperbolic flux for a system of hyperbolic
@@ -177,6 +189,45 @@ public:
                                         ElementTransformation &Tr,
                                         DenseMatrix &JDotN) const;
 
+   /**
+    * @brief Compute the flux F(u, x) at the points @a ir of all elements of
+    * @a fes. Optionally overloaded in a derived class.
+    *
+    * Used in HyperbolicFormIntegrator::AddMultPA(). The default
+    * implementation calls ComputeFlux() at each point on the host.
+    * @param[in] states states at the points (num_equations, NQ, NE)
+    * @param[in] fes finite element space defining the elements
+    * @param[in] ir integration rule with NQ points
+    * @param[out] fluxes fluxes at the points (num_equations, dim, NQ, NE)
+    * @param[out] speeds maximum characteristic speeds at the points (NQ, NE)
+    */
+   virtual void ComputeFluxes(const Vector &states,
+                              const FiniteElementSpace &fes,
+                              const IntegrationRule &ir,
+                              Vector &fluxes, Vector &speeds) const;
+
+   /**
+    * @brief Compute the normal flux F(u, x)⋅n at the points @a ir of all
+    * interior faces of @a fes. Optionally overloaded in a derived class.
+    *
+    * Used in the default implementation of NumericalFlux::EvalFaces(). The
+    * faces are ordered as in the face restriction of @a fes, see
+    * FiniteElementSpace::GetFaceRestriction(), and the points as in
+    * FaceGeometricFactors. The default implementation calls
+    * ComputeFluxDotN() at each point on the host.
+    * @param[in] states states at the points (num_equations, NQ, NF)
+    * @param[in] normals normal vectors, see mfem::CalcOrtho() (dim, NQ, NF)
+    * @param[in] fes finite element space defining the faces
+    * @param[in] ir face integration rule with NQ points
+    * @param[out] fluxDotN normal fluxes at the points (num_equations, NQ, NF)
+    * @param[out] speeds maximum (normal) characteristic speeds at the points
+    * (NQ, NF)
+    */
+   virtual void ComputeFluxesDotN(const Vector &states, const Vector &normals,
+                                  const FiniteElementSpace &fes,
+                                  const IntegrationRule &ir,
+                                  Vector &fluxDotN, Vector &speeds) const;
+
 private:
 #ifndef MFEM_THREAD_SAFE
    mutable DenseMatrix flux;
@@ -282,6 +333,30 @@ public:
                             DenseMatrix &grad) const
    { MFEM_ABORT("Not implemented."); }
 
+   /**
+    * @brief Evaluates normal numerical flux at the points @a ir of all
+    * interior faces of @a fes. Optionally overloaded in a derived class.
+    *
+    * Used in HyperbolicFormIntegrator::AddMultFacePA(). The faces and the
+    * points are ordered as in FluxFunction::ComputeFluxesDotN(). The default
+    * implementation calls Eval() at each point on the host.
+    * @param[in] states1 states at the points from the first elements
+    * (num_equations, NQ, NF)
+    * @param[in] states2 states at the points from the second elements
+    * (num_equations, NQ, NF)
+    * @param[in] normals scaled normal vectors, see mfem::CalcOrtho()
+    * (dim, NQ, NF)
+    * @param[in] fes finite element space defining the faces
+    * @param[in] ir face integration rule with NQ points
+    * @param[out] fluxes numerical fluxes (num_equations, NQ, NF)
+    * @param[out] speeds maximum characteristic speeds at the points (NQ, NF)
+    */
+   virtual void EvalFaces(const Vector &states1, const Vector &states2,
+                          const Vector &normals,
+                          const FiniteElementSpace &fes,
+                          const IntegrationRule &ir,
+                          Vector &fluxes, Vector &speeds) const;
+
    virtual ~NumericalFlux() = default;
 
    /// @brief Get flux function F
@@ -312,7 +387,23 @@ private:
    const real_t sign;
 
    // The maximum characteristic speed, updated during element/face vector assembly
-   real_t max_char_speed;
+   // and during the partially assembled actions
+   mutable real_t max_char_speed;
+
+   // Partial assembly data for the elements
+   const FiniteElementSpace *pa_fes = nullptr; // not owned
+   const IntegrationRule *pa_ir = nullptr;     // not owned
+   const DofToQuad *pa_maps = nullptr;         // not owned, 1D TENSOR maps
+   int pa_ne = 0;
+   Vector pa_adj;  // weight * adj(J) at the points, (dim, dim, NQ, NE)
+   mutable Vector pa_states, pa_fluxes, pa_speeds;
+
+   // Partial assembly data for the interior faces
+   const IntegrationRule *pa_face_ir = nullptr; // not owned
+   const DofToQuad *pa_face_maps = nullptr;     // not owned, 1D TENSOR maps
+   int pa_nf = 0;
+   Vector pa_nor;  // scaled normals at the points, (dim, NQ, NF)
+   mutable Vector pa_states1, pa_states2, pa_fluxN, pa_face_speeds;
 
 #ifndef MFEM_THREAD_SAFE
    // Local storage for element integration
@@ -410,6 +501,34 @@ public:
                          const FiniteElement &el2,
                          FaceElementTransformations &Tr,
                          const Vector &elfun, DenseMatrix &elmat) override;
+
+   using NonlinearFormIntegrator::AssemblePA;
+
+   /**
+    * @brief Prepare the partially assembled (F(u), ∇v) term on the DG space
+    * @a fes, storing the quadrature weights times the adjugate Jacobians.
+    */
+   void AssemblePA(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partially assembled action of the (F(u), ∇v) term on the
+    * E-vector @a x, added to @a y. The maximum characteristic speed is
+    * updated with a device reduction.
+    */
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   /**
+    * @brief Prepare the partially assembled <-F̂(u⁻,u⁺,x) n, [v]> term on the
+    * interior faces of the DG space @a fes, storing the scaled normals.
+    */
+   void AssembleFacePA(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partially assembled action of the <-F̂(u⁻,u⁺,x) n, [v]> term on
+    * the double-valued face E-vector @a x, added to @a y. The maximum
+    * characteristic speed is updated with a device reduction.
+    */
+   void AddMultFacePA(const Vector &x, Vector &y) const override;
 };
 
 /**
@@ -691,11 +810,22 @@ public:
                     const Vector &nor, FaceElementTransformations &Tr,
                     DenseMatrix &grad) const override;
 
+   /**
+    * @brief Normal numerical flux at all interior face points, see Eval(),
+    * computed with a device kernel from FluxFunction::ComputeFluxesDotN().
+    */
+   void EvalFaces(const Vector &states1, const Vector &states2,
+                  const Vector &normals, const FiniteElementSpace &fes,
+                  const IntegrationRule &ir,
+                  Vector &fluxes, Vector &speeds) const override;
+
 protected:
 #ifndef MFEM_THREAD_SAFE
    mutable Vector fluxN1, fluxN2;
    mutable DenseMatrix JDotN;
 #endif
+   // Batched normal fluxes and speeds of the second states, see EvalFaces()
+   mutable Vector fluxesN1, fluxesN2, speeds2;
 };
 
 /**
@@ -801,11 +931,22 @@ public:
                     const Vector &nor, FaceElementTransformations &Tr,
                     DenseMatrix &grad) const override;
 
+   /**
+    * @brief Normal numerical flux at all interior face points, see Eval(),
+    * computed with a device kernel from FluxFunction::ComputeFluxesDotN().
+    */
+   void EvalFaces(const Vector &states1, const Vector &states2,
+                  const Vector &normals, const FiniteElementSpace &fes,
+                  const IntegrationRule &ir,
+                  Vector &fluxes, Vector &speeds) const override;
+
 protected:
 #ifndef MFEM_THREAD_SAFE
    mutable Vector fluxN1, fluxN2;
    mutable DenseMatrix JDotN;
 #endif
+   // Batched normal fluxes and speeds of the second states, see EvalFaces()
+   mutable Vector fluxesN1, fluxesN2, speeds2;
 };
 
 /// Advection flux
@@ -944,6 +1085,17 @@ public:
                           FaceElementTransformations &Tr,
                           Vector &fluxDotN) const override;
 
+   /// Compute F(u) at all element points with a device kernel.
+   void ComputeFluxes(const Vector &states, const FiniteElementSpace &fes,
+                      const IntegrationRule &ir,
+                      Vector &fluxes, Vector &speeds) const override;
+
+   /// Compute F(u) n at all interior face points with a device kernel.
+   void ComputeFluxesDotN(const Vector &states, const Vector &normals,
+                          const FiniteElementSpace &fes,
+                          const IntegrationRule &ir,
+                          Vector &fluxDotN, Vector &speeds) const override;
+
    /**
     * @brief Compute average flux F̄(u)
     *
@@ -1039,6 +1191,17 @@ public:
    real_t ComputeFluxDotN(const Vector &state, const Vector &normal,
                           FaceElementTransformations &Tr,
                           Vector &fluxN) const override;
+
+   /// Compute F(u) at all element points with a device kernel.
+   void ComputeFluxes(const Vector &states, const FiniteElementSpace &fes,
+                      const IntegrationRule &ir,
+                      Vector &fluxes, Vector &speeds) const override;
+
+   /// Compute F(u) n at all interior face points with a device kernel.
+   void ComputeFluxesDotN(const Vector &states, const Vector &normals,
+                          const FiniteElementSpace &fes,
+                          const IntegrationRule &ir,
+                          Vector &fluxDotN, Vector &speeds) const override;
 };
 
 /// Euler flux
@@ -1083,6 +1246,17 @@ public:
    real_t ComputeFluxDotN(const Vector &x, const Vector &normal,
                           FaceElementTransformations &Tr,
                           Vector &fluxN) const override;
+
+   /// Compute F(u) at all element points with a device kernel.
+   void ComputeFluxes(const Vector &states, const FiniteElementSpace &fes,
+                      const IntegrationRule &ir,
+                      Vector &fluxes, Vector &speeds) const override;
+
+   /// Compute F(u) n at all interior face points with a device kernel.
+   void ComputeFluxesDotN(const Vector &states, const Vector &normals,
+                          const FiniteElementSpace &fes,
+                          const IntegrationRule &ir,
+                          Vector &fluxDotN, Vector &speeds) const override;
 };
 
 } // namespace mfem
@@ -1234,6 +1234,23 @@ ApplyKernelType DiffusionIntegrator::ApplyPAKernels::Fallback(int DIM, int, int)
    else { MFEM_ABORT(""); }
 }
 
+template<int DIM, int T_D1D, int T_Q1D>
+void DiffusionIntegrator::AddApplyVariants()
+{
+   if constexpr (DIM == 2)
+   {
+      ApplyPAKernels::AddVariant("no-smem",
+                                 internal::PADiffusionApply2D<T_D1D,T_Q1D>,
+                                 DIM, T_D1D, T_Q1D);
+   }
+   else if constexpr (DIM == 3)
+   {
+      ApplyPAKernels::AddVariant("no-smem",
+                                 internal::PADiffusionApply3D<T_D1D,T_Q1D>,
+                                 DIM, T_D1D, T_Q1D);
+   }
+}
+
 template<int DIM, int D1D, int Q1D>
 DiagonalKernelType DiffusionIntegrator::DiagonalPAKernels::Kernel()
 {
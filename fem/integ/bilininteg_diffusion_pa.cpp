@@ -68,6 +68,17 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
       }
 #endif // MFEM_USE_OCCA
 
+      if (KernelProfiler::Enabled())
+      {
+         // x, y (read and write) and the quadrature point data; gradient,
+         // its transpose and the point-wise product with the dim x dim data
+         const double nd = std::pow(dofs1D, dim), nq = std::pow(quad1D, dim);
+         const int nqd = symmetric ? dim*(dim+1)/2 : dim*dim;
+         const double interp =
+            KernelProfiler::TensorInterpFlops(dim, dofs1D, quad1D);
+         KernelProfiler::SetWork(ne*(3*nd + nqd*nq)*sizeof(real_t),
+                                 ne*(2*dim*interp + 2*dim*dim*nq));
+      }
       ApplyPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric, B, G, Bt,
                           Gt, Dv, x, y, dofs1D, quad1D);
    }
@@ -1398,6 +1398,21 @@ ApplyKernelType MassIntegrator::ApplyPAKernels::Kernel()
    MFEM_ABORT("");
 }
 
+template<int DIM, int T_D1D, int T_Q1D>
+void MassIntegrator::AddApplyVariants()
+{
+   if constexpr (DIM == 2)
+   {
+      ApplyPAKernels::AddVariant("no-smem", internal::PAMassApply2D<T_D1D,T_Q1D>,
+                                 DIM, T_D1D, T_Q1D);
+   }
+   else if constexpr (DIM == 3)
+   {
+      ApplyPAKernels::AddVariant("no-smem", internal::PAMassApply3D<T_D1D,T_Q1D>,
+                                 DIM, T_D1D, T_Q1D);
+   }
+}
+
 inline ApplyKernelType MassIntegrator::ApplyPAKernels::Fallback(
    int DIM, int, int)
 {
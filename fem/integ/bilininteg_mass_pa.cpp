@@ -164,6 +164,15 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
          MFEM_ABORT("OCCA PA Mass Apply unknown kernel!");
       }
 #endif // MFEM_USE_OCCA
+      if (KernelProfiler::Enabled())
+      {
+         // x, y (read and write) and the quadrature point data; B, B^t and
+         // the point-wise scaling
+         const double nd = std::pow(D1D, dim), nq = std::pow(Q1D, dim);
+         KernelProfiler::SetWork(
+            ne*(3*nd + nq)*sizeof(real_t),
+            ne*(2*KernelProfiler::TensorInterpFlops(dim, D1D, Q1D) + nq));
+      }
       ApplyPAKernels::Run(dim, D1D, Q1D, ne, B, Bt, D, x, y, D1D, Q1D);
    }
 }
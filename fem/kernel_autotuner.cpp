@@ -0,0 +1,243 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "kernel_autotuner.hpp"
+#include "kernel_profiler.hpp"
+#include "../general/forall.hpp"
+#ifdef MFEM_USE_MPI
+#include "../general/communication.hpp"
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+
+namespace mfem
+{
+
+namespace
+{
+
+const char *KernelAutotunerEnv()
+{
+   const char *env = GetEnv("MFEM_AUTOTUNE_KERNELS");
+   return (env && std::string(env) != "NO") ? env : nullptr;
+}
+
+/// Key of an entry in the index and in the files.
+std::string EntryKey(const std::string &kernel, const std::string &params)
+{
+   return kernel + '\t' + params;
+}
+
+/// Owner of the entries, saving the choices at program exit.
+struct KernelAutotunerData
+{
+   std::deque<KernelAutotuner::Entry> entries; // stable references
+   std::map<std::string, KernelAutotuner::Entry*> index;
+   std::map<std::string, std::string> loaded; // choices loaded from a file
+   std::string cache_file;
+   int rank = 0;
+
+   static KernelAutotunerData &Get()
+   {
+      static KernelAutotunerData data;
+      return data;
+   }
+
+   KernelAutotunerData()
+   {
+      const char *env = KernelAutotunerEnv();
+      if (env && std::string(env) != "YES") { SetCacheFile(env); }
+   }
+
+   void SetCacheFile(const std::string &fname)
+   {
+      cache_file = fname;
+      std::ifstream ifs(cache_file);
+      if (ifs) { Load(ifs); }
+   }
+
+   void Load(std::istream &is)
+   {
+      std::string line;
+      while (std::getline(is, line))
+      {
+         if (line.empty() || line[0] == '#') { continue; }
+         const auto sep = line.rfind('\t');
+         if (sep == std::string::npos || sep == 0) { continue; }
+         const std::string key = line.substr(0, sep);
+         loaded[key] = line.substr(sep + 1);
+         const auto it = index.find(key);
+         if (it != index.end() && !it->second->Tuned()) { Apply(*it->second); }
+      }
+   }
+
+   /// Select the loaded choice for @a e, if it is one of its variants.
+   void Apply(KernelAutotuner::Entry &e)
+   {
+      const auto it = loaded.find(EntryKey(e.kernel, e.params));
+      if (it == loaded.end()) { return; }
+      const auto v = std::find(e.variants.begin(), e.variants.end(),
+                               it->second);
+      if (v != e.variants.end()) { e.choice = int(v - e.variants.begin()); }
+   }
+
+   // All ranks load the same file, only the first one saves it.
+   ~KernelAutotunerData()
+   {
+      if (cache_file.empty() || rank != 0) { return; }
+      std::ofstream ofs(cache_file);
+      if (ofs) { KernelAutotuner::Save(ofs); }
+      else { mfem::err << "KernelAutotuner: cannot open " << cache_file << '\n'; }
+   }
+};
+
+inline void DeviceSync()
+{
+   if (Device::Allows(Backend::DEVICE_MASK)) { MFEM_DEVICE_SYNC; }
+}
+
+} // anonymous namespace
+
+bool KernelAutotuner::enabled = KernelAutotunerEnv() != nullptr;
+int KernelAutotuner::num_trials = 3;
+
+void KernelAutotuner::Enable(const std::string &cache_file)
+{
+   if (!cache_file.empty())
+   {
+      KernelAutotunerData::Get().SetCacheFile(cache_file);
+   }
+   enabled = true;
+}
+
+void KernelAutotuner::SetTrials(int n)
+{
+   MFEM_VERIFY(n > 0, "the number of trials must be positive");
+   num_trials = n;
+}
+
+void KernelAutotuner::Reset()
+{
+   KernelAutotunerData &data = KernelAutotunerData::Get();
+   data.loaded.clear();
+   for (Entry &e : data.entries)
+   {
+      e.trials = 0;
+      e.choice = (e.variants.size() == 1) ? 0 : -1;
+      std::fill(e.times.begin(), e.times.end(),
+                std::numeric_limits<double>::infinity());
+   }
+}
+
+void KernelAutotuner::Load(std::istream &is)
+{
+   KernelAutotunerData::Get().Load(is);
+}
+
+void KernelAutotuner::Save(std::ostream &os)
+{
+   KernelAutotunerData &data = KernelAutotunerData::Get();
+   // Keep the loaded choices of the kernels that were not tuned in this run
+   std::map<std::string, std::string> choices = data.loaded;
+   for (const Entry &e : data.entries)
+   {
+      if (e.Tuned()) { choices[EntryKey(e.kernel, e.params)] = e.variants[e.choice]; }
+   }
+   os << "# MFEM kernel autotuning choices: kernel, parameters, variant\n";
+   for (const auto &c : choices) { os << c.first << '\t' << c.second << '\n'; }
+}
+
+void KernelAutotuner::Print(std::ostream &os)
+{
+   const auto flags = os.flags();
+   const auto prec = os.precision();
+   os << "\nKernel autotuning:\n";
+   for (const Entry &e : KernelAutotunerData::Get().entries)
+   {
+      os << "  " << e.kernel << '<' << e.params << '>';
+      if (e.Tuned()) { os << ": " << e.variants[e.choice]; }
+      os << '\n' << std::scientific << std::setprecision(3);
+      for (size_t i = 0; i < e.variants.size(); i++)
+      {
+         os << "    " << std::setw(12) << std::left << e.variants[i]
+            << std::right;
+         if (e.times[i] < std::numeric_limits<double>::infinity())
+         {
+            os << std::setw(12) << 1e6*e.times[i] << " us";
+         }
+         if (int(i) == e.choice) { os << "  *"; }
+         os << '\n';
+      }
+      os.flags(flags);
+   }
+   os.precision(prec);
+}
+
+KernelAutotuner::Entry &KernelAutotuner::GetEntry(
+   const char *kernel_name, const std::string &params,
+   const std::vector<std::string> &variants)
+{
+   MFEM_ASSERT(!variants.empty(), "no candidate variants");
+   KernelAutotunerData &data = KernelAutotunerData::Get();
+   const std::string kernel = internal::ShortKernelName(kernel_name);
+   Entry *&e = data.index[EntryKey(kernel, params)];
+   if (e == nullptr)
+   {
+      data.entries.emplace_back();
+      e = &data.entries.back();
+      e->kernel = kernel;
+      e->params = params;
+      e->variants = variants;
+      e->times.assign(variants.size(),
+                      std::numeric_limits<double>::infinity());
+      if (variants.size() == 1) { e->choice = 0; }
+      data.Apply(*e);
+#ifdef MFEM_USE_MPI
+      if (Mpi::IsInitialized() && !Mpi::IsFinalized())
+      {
+         data.rank = Mpi::WorldRank();
+      }
+#endif
+   }
+   return *e;
+}
+
+KernelAutotuner::Trial::Trial(Entry &e)
+   : entry(e), index(e.Next()), active(!e.Tuned())
+{
+   if (!active) { return; }
+   DeviceSync();
+   start = std::chrono::steady_clock::now();
+}
+
+KernelAutotuner::Trial::~Trial()
+{
+   if (!active) { return; }
+   DeviceSync();
+   const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   if (entry.Tuned()) { return; } // tuned during the call, e.g. by Load()
+   entry.times[index] = std::min(entry.times[index], elapsed.count());
+   entry.trials++;
+   if (entry.trials == num_trials*int(entry.variants.size()))
+   {
+      entry.choice = int(std::min_element(entry.times.begin(),
+                                          entry.times.end()) -
+                         entry.times.begin());
+   }
+}
+
+} // namespace mfem
@@ -0,0 +1,135 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_AUTOTUNER_HPP
+#define MFEM_KERNEL_AUTOTUNER_HPP
+
+#include "../config/config.hpp"
+#include "../general/globals.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+/// @brief Runtime selection of the fastest variant of the kernels dispatched
+/// with KernelDispatchTable::Run().
+///
+/// For a given kernel registered with MFEM_REGISTER_KERNELS and a set of
+/// dispatch parameters (e.g. dim, D1D and Q1D), the candidate variants are the
+/// compile-time specialization (if any), the variants registered with
+/// KernelDispatchTable::AddVariant() and the fallback kernel. When the
+/// autotuner is enabled, the first calls with these parameters cycle through
+/// the candidates, each call running exactly one of them on the actual data,
+/// so the results are not affected. After every candidate has been timed
+/// GetTrials() times, the one with the smallest time is used for all following
+/// calls.
+///
+/// The choices can be saved to a file and loaded in later runs, in which case
+/// no timing is done for the kernels found in the file.
+///
+/// @note The autotuner is enabled when the environment variable
+/// MFEM_AUTOTUNE_KERNELS is set to a value other than 'NO', or if
+/// KernelAutotuner::Enable() is called. If the value is not 'YES', it is the
+/// name of a file from which the choices are loaded at startup and to which
+/// they are saved at program exit. With MPI, all ranks load the file and the
+/// first rank saves it.
+///
+/// @note The choice is made per set of dispatch parameters, typically with the
+/// problem size of the first calls. The autotuner is not thread-safe: kernels
+/// should be dispatched from a single thread while it is enabled.
+class KernelAutotuner
+{
+public:
+   /// Tuning state of one (kernel, dispatch parameters) pair.
+   struct Entry
+   {
+      /// Kernel name, "file:line KernelName".
+      std::string kernel;
+      /// Comma-separated dispatch parameters.
+      std::string params;
+      /// Names of the candidate variants.
+      std::vector<std::string> variants;
+      /// Smallest measured time of each variant, in seconds.
+      std::vector<double> times;
+      /// Number of timed calls.
+      int trials = 0;
+      /// Index of the selected variant, or -1 while tuning.
+      int choice = -1;
+
+      /// Return true if a variant has been selected.
+      bool Tuned() const { return choice >= 0; }
+
+      /// Return the index of the variant to run in the next call.
+      int Next() const
+      { return Tuned() ? choice : trials % int(variants.size()); }
+   };
+
+   /// Return true if the autotuner is enabled.
+   static bool Enabled() { return enabled; }
+
+   /** @brief Enable the autotuner. If @a cache_file is not empty, the choices
+       stored in it (if it exists) are loaded, and all choices are saved to it
+       at program exit. */
+   static void Enable(const std::string &cache_file = "");
+
+   /// Disable the autotuner. The choices are kept.
+   static void Disable() { enabled = false; }
+
+   /// Set the number of timed calls of each variant, by default 3.
+   static void SetTrials(int n);
+
+   /// Return the number of timed calls of each variant.
+   static int GetTrials() { return num_trials; }
+
+   /** @brief Discard all measurements and choices, including the ones loaded
+       from a file, so the kernels are tuned again. */
+   static void Reset();
+
+   /** @brief Load choices in the format written by Save(). The choices apply
+       to the kernels that have not been tuned yet. */
+   static void Load(std::istream &is);
+
+   /// Save the choices, one line per kernel and set of dispatch parameters.
+   static void Save(std::ostream &os);
+
+   /// Print the candidate times and the choices as a table.
+   static void Print(std::ostream &os = mfem::out);
+
+   /** @brief Return the entry for the given kernel name (as set by
+       MFEM_REGISTER_KERNELS) and dispatch parameters, creating it with the
+       given candidate @a variants if needed. The returned reference stays
+       valid until program exit. */
+   static Entry &GetEntry(const char *kernel_name, const std::string &params,
+                          const std::vector<std::string> &variants);
+
+   /** @brief Times one call of a candidate variant, used by
+       KernelDispatchTable::Run(). Does nothing if the entry is tuned. */
+   class Trial
+   {
+      Entry &entry;
+      const int index;
+      const bool active;
+      std::chrono::steady_clock::time_point start;
+   public:
+      Trial(Entry &e);
+      ~Trial();
+   };
+
+private:
+   MFEM_EXPORT static bool enabled;
+   MFEM_EXPORT static int num_trials;
+};
+
+} // namespace mfem
+
+#endif
@@ -14,11 +14,16 @@
 
 #include "../config/config.hpp"
 #include "kernel_reporter.hpp"
+#include "kernel_profiler.hpp"
+#include "kernel_autotuner.hpp"
 #include "../general/hash_util.hpp"
 #include <unordered_map>
 #include <tuple>
 #include <type_traits>
 #include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace mfem
 {
@@ -42,7 +47,9 @@ namespace mfem
 // functions depending on the parameters.
 //
 // Specialized functions can be registered using the static AddSpecialization
-// member function.
+// member function. Alternative implementations for a given set of parameters
+// (e.g. with or without shared memory) can be registered with AddVariant; they
+// are only used by the KernelAutotuner.
 
 #define MFEM_EXPAND(X) X // Workaround needed for MSVC compiler
 
@@ -104,6 +111,23 @@ class KernelDispatchTable<Kernels,
       std::unordered_map<std::tuple<Params...>, Signature, TupleHasher>;
    TableType table;
 
+   using VariantList = std::vector<std::pair<std::string, Signature>>;
+   std::unordered_map<std::tuple<Params...>, VariantList, TupleHasher> variants;
+
+   /// Candidate kernels of one set of dispatch parameters for the autotuner.
+   struct TunedKernels
+   {
+      std::vector<Signature> kernels;
+      /// Names of the candidates, as given to KernelAutotuner::GetEntry().
+      std::vector<std::string> names;
+      /// Whether each candidate is a specialization (or a variant) instead
+      /// of the fallback.
+      std::vector<bool> specialized;
+      /// KernelProfiler records of the candidates, created on first use.
+      std::vector<KernelProfiler::Record*> records;
+      KernelAutotuner::Entry *entry = nullptr;
+   };
+
    /// @brief Call function @a f with arguments @a args (perfect forwaring).
    ///
    /// Only valid when the function @a f is not a member function.
@@ -126,6 +150,63 @@ class KernelDispatchTable<Kernels,
       (t.*f)(std::forward<Args>(args)...);
    }
 
+   /// Return the KernelProfiler record of the kernel with the given
+   /// parameters; the lookup by name is only done on the first call.
+   static KernelProfiler::Record &ProfilerRecord(bool specialized,
+                                                 Params... params)
+   {
+      static std::unordered_map<std::tuple<Params...>,
+             KernelProfiler::Record*, TupleHasher> records;
+      KernelProfiler::Record *&r = records[std::make_tuple(params...)];
+      if (r == nullptr)
+      {
+         r = &KernelProfiler::GetRecord(Kernels::Get().kernel_name,
+                                        internal::Stringify(params...),
+                                        specialized);
+      }
+      return *r;
+   }
+
+   /// Return the autotuning candidates of the kernel with the given
+   /// parameters: the specialization (if any), the variants and the fallback.
+   static TunedKernels &GetTunedKernels(Params... params)
+   {
+      static std::unordered_map<std::tuple<Params...>, TunedKernels,
+             TupleHasher> tuned;
+      const std::tuple<Params...> key = std::make_tuple(params...);
+      TunedKernels &t = tuned[key];
+      if (t.entry == nullptr)
+      {
+         const auto &table = Kernels::Get().table;
+         const auto it = table.find(key);
+         if (it != table.end())
+         {
+            t.kernels.push_back(it->second);
+            t.names.push_back("specialized");
+            t.specialized.push_back(true);
+         }
+         const auto &vars = Kernels::Get().variants;
+         const auto v = vars.find(key);
+         if (v != vars.end())
+         {
+            for (const auto &var : v->second)
+            {
+               t.kernels.push_back(var.second);
+               t.names.push_back(var.first);
+               t.specialized.push_back(true);
+            }
+         }
+         t.kernels.push_back(Kernels::Fallback(params...));
+         t.names.push_back("fallback");
+         t.specialized.push_back(false);
+         t.records.assign(t.kernels.size(), nullptr);
+         t.entry = &KernelAutotuner::GetEntry(Kernels::Get().kernel_name,
+                                              internal::Stringify(params...),
+                                              t.names);
+      }
+      return t;
+   }
+
 public:
    /// @brief Run the kernel with the given dispatch parameters and arguments.
    ///
@@ -135,21 +216,86 @@ public:
    ///
    /// If the kernel is a member function, then the first argument after @a
    /// params should be the object on which it is called.
+   ///
+   /// When the KernelProfiler is enabled, the call is timed and recorded.
+   ///
+   /// When the KernelAutotuner is enabled, the kernel is chosen among the
+   /// specialization, the variants registered with AddVariant() and the
+   /// fallback, see KernelAutotuner.
    template<typename... Args>
    static void Run(Params... params, Args&&... args)
    {
+      if (KernelAutotuner::Enabled())
+      {
+         return RunTuned(params..., std::forward<Args>(args)...);
+      }
       const auto &table = Kernels::Get().table;
       const std::tuple<Params...> key = std::make_tuple(params...);
       const auto it = table.find(key);
-      if (it != table.end())
+      const bool specialized = (it != table.end());
+      if (!specialized)
       {
-         Invoke(it->second, std::forward<Args>(args)...);
+         KernelReporter::ReportFallback(Kernels::Get().kernel_name, params...);
+      }
+      const Signature kernel =
+         specialized ? it->second : Kernels::Fallback(params...);
+      if (KernelProfiler::Enabled())
+      {
+         KernelProfiler::Timer timer(ProfilerRecord(specialized, params...));
+         Invoke(kernel, std::forward<Args>(args)...);
       }
       else
       {
-         KernelReporter::ReportFallback(Kernels::Get().kernel_name, params...);
-         Invoke(Kernels::Fallback(params...), std::forward<Args>(args)...);
+         Invoke(kernel, std::forward<Args>(args)...);
+      }
+   }
+
+   /// @brief Run the kernel selected by the KernelAutotuner for the given
+   /// dispatch parameters, timing it while the candidates are being tuned.
+   ///
+   /// When the KernelProfiler is enabled, each candidate has its own record,
+   /// whose parameters are followed by the name of the candidate, e.g.
+   /// "2,3,4 (fallback)".
+   template<typename... Args>
+   static void RunTuned(Params... params, Args&&... args)
+   {
+      TunedKernels &t = GetTunedKernels(params...);
+      KernelAutotuner::Entry &entry = *t.entry;
+      const int i = entry.Next();
+      const Signature kernel = t.kernels[i];
+      KernelAutotuner::Trial trial(entry);
+      if (KernelProfiler::Enabled())
+      {
+         KernelProfiler::Record *&r = t.records[i];
+         if (r == nullptr)
+         {
+            r = &KernelProfiler::GetRecord(
+                   Kernels::Get().kernel_name,
+                   internal::Stringify(params...) + " (" + t.names[i] + ")",
+                   t.specialized[i]);
+         }
+         KernelProfiler::Timer timer(*r);
+         Invoke(kernel, std::forward<Args>(args)...);
+      }
+      else
+      {
+         Invoke(kernel, std::forward<Args>(args)...);
+      }
+   }
+
+   /// @brief Register an alternative implementation @a kernel, called @a name,
+   /// of the kernel with the given dispatch parameters.
+   ///
+   /// Variants are only used when the KernelAutotuner is enabled, as
+   /// additional candidates to the specialization and the fallback.
+   static void AddVariant(const char *name, Signature kernel, Params... params)
+   {
+      VariantList &list = Kernels::Get().variants[std::make_tuple(params...)];
+      for (auto &var : list)
+      {
+         if (var.first == name) { var.second = kernel; return; }
       }
+      list.emplace_back(name, kernel);
    }
 
    /// Register a specialized kernel for dispatch.
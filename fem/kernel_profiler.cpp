@@ -0,0 +1,248 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "kernel_profiler.hpp"
+#include "../general/forall.hpp"
+#ifdef MFEM_USE_MPI
+#include "../general/communication.hpp"
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+namespace mfem
+{
+
+namespace
+{
+
+const char *KernelProfilerEnv()
+{
+   const char *env = GetEnv("MFEM_PROFILE_KERNELS");
+   return (env && std::string(env) != "NO") ? env : nullptr;
+}
+
+/// Owner of the records, reporting them at program exit. It is created on
+/// first use, after mfem::out, so it is destroyed before mfem::out.
+struct KernelProfilerData
+{
+   std::deque<KernelProfiler::Record> records; // stable references
+   std::map<std::string, KernelProfiler::Record*> index;
+   std::string json_file;
+   bool report_at_exit = false;
+   int rank = 0, nranks = 1;
+
+   KernelProfilerData()
+   {
+      const char *env = KernelProfilerEnv();
+      if (!env) { return; }
+      const std::string value(env);
+      if (value.size() > 5 && value.compare(value.size() - 5, 5, ".json") == 0)
+      {
+         json_file = value;
+      }
+      report_at_exit = true;
+   }
+
+   static KernelProfilerData &Get()
+   {
+      static KernelProfilerData data;
+      return data;
+   }
+
+   ~KernelProfilerData()
+   {
+      if (!report_at_exit) { return; }
+      if (rank == 0) { KernelProfiler::Print(mfem::out); }
+      if (json_file.empty()) { return; }
+      std::string fname = json_file;
+      if (nranks > 1)
+      {
+         fname.insert(fname.size() - 5, "." + std::to_string(rank));
+      }
+      std::ofstream ofs(fname);
+      if (ofs) { KernelProfiler::PrintJSON(ofs); }
+      else { mfem::err << "KernelProfiler: cannot open " << fname << '\n'; }
+   }
+};
+
+void JSONString(std::ostream &os, const std::string &s)
+{
+   os << '"';
+   for (char c : s)
+   {
+      if (c == '"' || c == '\\') { os << '\\'; }
+      os << c;
+   }
+   os << '"';
+}
+
+inline void DeviceSync()
+{
+   if (Device::Allows(Backend::DEVICE_MASK)) { MFEM_DEVICE_SYNC; }
+}
+
+} // anonymous namespace
+
+std::string internal::ShortKernelName(const char *kernel_name)
+{
+   std::string name(kernel_name);
+   const auto sep = name.find(" : ");
+   std::string loc = name.substr(0, sep);
+   const auto slash = loc.find_last_of("/\\");
+   if (slash != std::string::npos) { loc = loc.substr(slash + 1); }
+   return (sep == std::string::npos) ? loc : loc + " " + name.substr(sep + 3);
+}
+
+bool KernelProfiler::enabled = KernelProfilerEnv() != nullptr;
+double KernelProfiler::pending_bytes = 0.0;
+double KernelProfiler::pending_flops = 0.0;
+
+void KernelProfiler::Enable(bool report_at_exit)
+{
+   if (report_at_exit) { KernelProfilerData::Get().report_at_exit = true; }
+   enabled = true;
+}
+
+void KernelProfiler::Reset()
+{
+   for (Record &r : KernelProfilerData::Get().records)
+   {
+      r.calls = 0;
+      r.time = r.bytes = r.flops = 0.0;
+   }
+   pending_bytes = pending_flops = 0.0;
+}
+
+std::vector<KernelProfiler::Record> KernelProfiler::GetRecords()
+{
+   std::vector<Record> records;
+   for (const Record &r : KernelProfilerData::Get().records)
+   {
+      if (r.calls > 0) { records.push_back(r); }
+   }
+   std::stable_sort(records.begin(), records.end(),
+                    [](const Record &a, const Record &b)
+   { return a.time > b.time; });
+   return records;
+}
+
+void KernelProfiler::Print(std::ostream &os)
+{
+   const std::vector<Record> records = GetRecords();
+   double total = 0.0;
+   for (const Record &r : records) { total += r.time; }
+
+   const auto flags = os.flags();
+   const auto prec = os.precision();
+   os << "\nKernel profile: " << records.size() << " kernels, total time "
+      << std::setprecision(6) << total << " s\n"
+      << std::setw(12) << "time [s]" << std::setw(7) << "%"
+      << std::setw(10) << "calls" << std::setw(12) << "avg [us]"
+      << std::setw(10) << "GB/s" << std::setw(10) << "GFLOP/s"
+      << std::setw(9) << "flop/B" << "  kernel<params>\n";
+   for (const Record &r : records)
+   {
+      os << std::scientific << std::setprecision(3)
+         << std::setw(12) << r.time
+         << std::fixed << std::setprecision(1)
+         << std::setw(7) << (total > 0.0 ? 100.0*r.time/total : 0.0)
+         << std::setw(10) << r.calls
+         << std::setw(12) << 1e6*r.time/r.calls;
+      if (r.time > 0.0 && (r.bytes > 0.0 || r.flops > 0.0))
+      {
+         os << std::setprecision(2)
+            << std::setw(10) << 1e-9*r.bytes/r.time
+            << std::setw(10) << 1e-9*r.flops/r.time;
+         if (r.bytes > 0.0) { os << std::setw(9) << r.flops/r.bytes; }
+         else { os << std::setw(9) << "-"; }
+      }
+      else
+      {
+         os << std::setw(10) << "-" << std::setw(10) << "-"
+            << std::setw(9) << "-";
+      }
+      os << "  " << r.kernel << '<' << r.params << '>'
+         << (r.specialized ? "" : " (fallback)") << '\n';
+   }
+   os.flags(flags);
+   os.precision(prec);
+}
+
+void KernelProfiler::PrintJSON(std::ostream &os)
+{
+   const std::vector<Record> records = GetRecords();
+   const auto prec = os.precision();
+   os << std::setprecision(17) << "{\n  \"kernels\": [";
+   for (size_t i = 0; i < records.size(); i++)
+   {
+      const Record &r = records[i];
+      os << (i ? ",\n" : "\n") << "    {\"kernel\": ";
+      JSONString(os, r.kernel);
+      os << ", \"params\": [" << r.params << "]"
+         << ", \"specialized\": " << (r.specialized ? "true" : "false")
+         << ", \"calls\": " << r.calls
+         << ", \"time\": " << r.time
+         << ", \"bytes\": " << r.bytes
+         << ", \"flops\": " << r.flops << '}';
+   }
+   os << "\n  ]\n}\n";
+   os.precision(prec);
+}
+
+KernelProfiler::Record &KernelProfiler::GetRecord(const char *kernel_name,
+                                                  const std::string &params,
+                                                  bool specialized)
+{
+   KernelProfilerData &data = KernelProfilerData::Get();
+   const std::string kernel = internal::ShortKernelName(kernel_name);
+   Record *&r = data.index[kernel + '<' + params + '>'];
+   if (r == nullptr)
+   {
+      data.records.emplace_back();
+      r = &data.records.back();
+      r->kernel = kernel;
+      r->params = params;
+      r->specialized = specialized;
+#ifdef MFEM_USE_MPI
+      if (Mpi::IsInitialized() && !Mpi::IsFinalized())
+      {
+         data.rank = Mpi::WorldRank();
+         data.nranks = Mpi::WorldSize();
+      }
+#endif
+   }
+   return *r;
+}
+
+KernelProfiler::Timer::Timer(Record &r)
+   : record(r), bytes(pending_bytes), flops(pending_flops)
+{
+   pending_bytes = pending_flops = 0.0;
+   DeviceSync();
+   start = std::chrono::steady_clock::now();
+}
+
+KernelProfiler::Timer::~Timer()
+{
+   DeviceSync();
+   const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   record.calls++;
+   record.time += elapsed.count();
+   record.bytes += bytes;
+   record.flops += flops;
+}
+
+} // namespace mfem
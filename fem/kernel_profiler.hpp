@@ -0,0 +1,145 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_PROFILER_HPP
+#define MFEM_KERNEL_PROFILER_HPP
+
+#include "../config/config.hpp"
+#include "../general/globals.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+namespace internal
+{
+/// Return the name of a kernel registered with MFEM_REGISTER_KERNELS in the
+/// form "file:line KernelName", without the directories of the file.
+std::string ShortKernelName(const char *kernel_name);
+}
+
+/// @brief Profiler of the kernels dispatched with KernelDispatchTable::Run().
+///
+/// For every kernel registered with MFEM_REGISTER_KERNELS and every set of
+/// dispatch parameters (e.g. dim, D1D and Q1D), the profiler records the
+/// number of calls, the wall time, and the number of bytes moved and floating
+/// point operations performed, as declared by the caller with SetWork() before
+/// running the kernel. From these, Print() shows the achieved bandwidth,
+/// floating point rate and arithmetic intensity of each kernel, i.e. its
+/// position in a roofline plot.
+///
+/// When profiling is enabled, the device is synchronized before and after each
+/// kernel, so the times of asynchronous device kernels are accurate.
+///
+/// @note The profiler is enabled when the environment variable
+/// MFEM_PROFILE_KERNELS is set to a value other than 'NO', or if
+/// KernelProfiler::Enable() is called. By default, the table is printed to
+/// mfem::out at program exit. If the value of MFEM_PROFILE_KERNELS ends with
+/// '.json', the records are also written in JSON format to that file (with the
+/// MPI rank inserted before the extension when running on multiple ranks).
+///
+/// @note The profiler is not thread-safe: kernels should be dispatched from a
+/// single thread while it is enabled.
+class KernelProfiler
+{
+public:
+   /// Accumulated data of one (kernel, dispatch parameters) pair.
+   struct Record
+   {
+      /// Kernel name, "file:line KernelName".
+      std::string kernel;
+      /// Comma-separated dispatch parameters.
+      std::string params;
+      /// Whether a specialized kernel (or the fallback) is used.
+      bool specialized;
+      /// Number of calls.
+      long long calls = 0;
+      /// Total wall time in seconds.
+      double time = 0.0;
+      /// Total number of bytes declared with SetWork().
+      double bytes = 0.0;
+      /// Total number of floating point operations declared with SetWork().
+      double flops = 0.0;
+   };
+
+   /// Return true if the profiler is enabled.
+   static bool Enabled() { return enabled; }
+
+   /// Enable the profiler. If @a report_at_exit is true, the table is printed
+   /// to mfem::out at program exit.
+   static void Enable(bool report_at_exit = true);
+
+   /// Disable the profiler. The records are kept.
+   static void Disable() { enabled = false; }
+
+   /** @brief Declare the number of bytes moved and floating point operations
+       performed by the next kernel dispatched with KernelDispatchTable::Run().
+       Does nothing if the profiler is disabled. */
+   static void SetWork(double bytes, double flops)
+   {
+      if (!enabled) { return; }
+      pending_bytes = bytes;
+      pending_flops = flops;
+   }
+
+   /** @brief Return the number of floating point operations of a
+       sum-factorized interpolation from D1D^dim to Q1D^dim points, or of its
+       transpose, on one element. */
+   /** This is a building block for the counts given to SetWork(). */
+   static double TensorInterpFlops(int dim, int D1D, int Q1D)
+   {
+      double flops = 0.0, d = 1.0, q = 1.0;
+      for (int k = 0; k < dim; k++) { d *= D1D; }
+      for (int k = 0; k < dim; k++) { d /= D1D; q *= Q1D; flops += 2*d*D1D*q; }
+      return flops;
+   }
+
+   /// Reset all records to zero.
+   static void Reset();
+
+   /// Return a copy of the records with at least one call, sorted by
+   /// decreasing total time.
+   static std::vector<Record> GetRecords();
+
+   /// Print the records as a table, sorted by decreasing total time.
+   static void Print(std::ostream &os = mfem::out);
+
+   /// Print the records in JSON format.
+   static void PrintJSON(std::ostream &os);
+
+   /** @brief Return the record for the given kernel name (as set by
+       MFEM_REGISTER_KERNELS) and dispatch parameters, creating it if needed.
+       The returned reference stays valid until program exit. */
+   static Record &GetRecord(const char *kernel_name, const std::string &params,
+                            bool specialized);
+
+   /// Times one kernel call and adds it to a Record, used by
+   /// KernelDispatchTable::Run().
+   class Timer
+   {
+      Record &record;
+      double bytes, flops;
+      std::chrono::steady_clock::time_point start;
+   public:
+      Timer(Record &r);
+      ~Timer();
+   };
+
+private:
+   MFEM_EXPORT static bool enabled;
+   MFEM_EXPORT static double pending_bytes, pending_flops;
+};
+
+} // namespace mfem
+
+#endif
@@ -10,6 +10,14 @@
 // CONTRIBUTING.md for details.
 
 #include "multigrid.hpp"
+#include "transfer.hpp"
+#include "lor/lor.hpp"
+#include "ceed/interface/util.hpp"
+#ifdef MFEM_USE_MPI
+#include "pbilinearform.hpp"
+#endif
+
+#include <typeinfo>
 
 namespace mfem
 {
@@ -338,4 +346,253 @@ void GeometricMultigrid::RecoverFineFEMSolution(const Vector& X,
    bfs.Last()->RecoverFEMSolution(X, b, x);
 }
 
+/// Return a copy of @a integ, sharing its coefficients, if its dynamic type is
+/// one of the given types, and NULL otherwise.
+template <typename T, typename... Types>
+static BilinearFormIntegrator *CopyIntegratorAs(
+   const BilinearFormIntegrator &integ)
+{
+   if (typeid(integ) == typeid(T))
+   {
+      return new T(static_cast<const T&>(integ));
+   }
+   if constexpr (sizeof...(Types) > 0)
+   {
+      return CopyIntegratorAs<Types...>(integ);
+   }
+   else
+   {
+      return NULL;
+   }
+}
+
+/// Return a copy of @a integ using the default integration rule.
+static BilinearFormIntegrator *CopyIntegrator(
+   const BilinearFormIntegrator &integ)
+{
+   BilinearFormIntegrator *copy =
+      CopyIntegratorAs<DiffusionIntegrator, MassIntegrator,
+                       VectorDiffusionIntegrator,
+                       VectorMassIntegrator>(integ);
+   MFEM_VERIFY(copy, "integrator type not supported by "
+               "PMultigridPreconditioner: " << typeid(integ).name());
+   // The integration rule of the finest level may not be suitable
+   copy->SetIntRule(NULL);
+   return copy;
+}
+
+/// Form the operator of @a form with the essential true dofs @a ess_tdofs
+/// eliminated in @a op, and return true if the caller must delete it.
+static bool FormLevelOperator(BilinearForm &form, const Array<int> &ess_tdofs,
+                              OperatorHandle &op)
+{
+   if (form.GetAssemblyLevel() != AssemblyLevel::LEGACY)
+   {
+      op.SetType(Operator::ANY_TYPE);
+   }
+#ifdef MFEM_USE_MPI
+   else if (dynamic_cast<ParBilinearForm*>(&form))
+   {
+      op.SetType(Operator::Hypre_ParCSR);
+   }
+#endif
+   form.FormSystemMatrix(ess_tdofs, op);
+   const bool own_op = op.OwnsOperator();
+   op.SetOperatorOwner(false);
+   return own_op;
+}
+
+PMultigridPreconditioner::PMultigridPreconditioner(BilinearForm &a,
+                                                   const Array<int> &ess_bdr,
+                                                   int smoother_order)
+{
+   FiniteElementSpace &fes = *a.FESpace();
+   MFEM_VERIFY(dynamic_cast<const H1_FECollection*>(fes.FEColl()),
+               "only H1 spaces are supported");
+   MFEM_VERIFY(!fes.IsVariableOrder(),
+               "variable order spaces are not supported");
+   MFEM_VERIFY(a.GetFBFI()->Size() == 0 && a.GetBFBFI()->Size() == 0,
+               "face integrators are not supported");
+   // The copies of the integrators would share the libCEED operators
+   MFEM_VERIFY(!DeviceCanUseCeed(), "libCEED is not supported");
+#ifdef MFEM_USE_MPI
+   ParFiniteElementSpace *pfes = dynamic_cast<ParFiniteElementSpace*>(&fes);
+#endif
+
+   // Orders of the levels, from the finest to the coarsest
+   Array<int> orders;
+   for (int p = fes.FEColl()->GetOrder(); p > 1; p /= 2) { orders.Append(p); }
+   orders.Append(1);
+   const int nlevels = orders.Size();
+
+   fespaces.SetSize(nlevels);
+   forms.SetSize(nlevels);
+   fespaces[nlevels - 1] = &fes;
+   forms[nlevels - 1] = &a;
+   for (int level = 0; level < nlevels - 1; ++level)
+   {
+      FiniteElementCollection *fec =
+         fes.FEColl()->Clone(orders[nlevels - 1 - level]);
+      fecs.Append(fec);
+#ifdef MFEM_USE_MPI
+      if (pfes)
+      {
+         ParFiniteElementSpace *level_pfes = new ParFiniteElementSpace(
+            pfes->GetParMesh(), fec, fes.GetVDim(), fes.GetOrdering());
+         fespaces[level] = level_pfes;
+         forms[level] = new ParBilinearForm(level_pfes);
+      }
+      else
+#endif
+      {
+         fespaces[level] = new FiniteElementSpace(
+            fes.GetMesh(), fec, fes.GetVDim(), fes.GetOrdering());
+         forms[level] = new BilinearForm(fespaces[level]);
+      }
+
+      BilinearForm &form = *forms[level];
+      form.SetAssemblyLevel(a.GetAssemblyLevel());
+      for (BilinearFormIntegrator *integ : *a.GetDBFI())
+      {
+         form.AddDomainIntegrator(CopyIntegrator(*integ));
+      }
+      const Array<BilinearFormIntegrator*> &bbfi = *a.GetBBFI();
+      const Array<Array<int>*> &bbfi_marker = *a.GetBBFI_Marker();
+      for (int i = 0; i < bbfi.Size(); i++)
+      {
+         BilinearFormIntegrator *copy = CopyIntegrator(*bbfi[i]);
+         if (bbfi_marker[i])
+         {
+            form.AddBoundaryIntegrator(copy, *bbfi_marker[i]);
+         }
+         else
+         {
+            form.AddBoundaryIntegrator(copy);
+         }
+      }
+      form.Assemble();
+   }
+
+   bool have_ess_bdr = false;
+   for (int i = 0; i < ess_bdr.Size(); i++)
+   {
+      if (ess_bdr[i]) { have_ess_bdr = true; break; }
+   }
+
+   // The smoothers keep references to the essential true dofs
+   essentialTrueDofs.SetSize(nlevels);
+   for (int level = 0; level < nlevels; ++level)
+   {
+      essentialTrueDofs[level] = new Array<int>;
+      if (have_ess_bdr)
+      {
+         fespaces[level]->GetEssentialTrueDofs(ess_bdr,
+                                               *essentialTrueDofs[level]);
+      }
+   }
+
+   AddCoarseLevel();
+   for (int level = 1; level < nlevels; ++level)
+   {
+      AddSmoothedLevel(smoother_order);
+   }
+
+   ownedProlongations.SetSize(nlevels - 1);
+   ownedProlongations = true;
+   prolongations.SetSize(nlevels - 1);
+   for (int level = 0; level < nlevels - 1; ++level)
+   {
+      Operator *transfer = new TrueTransferOperator(*fespaces[level],
+                                                    *fespaces[level + 1]);
+      if (have_ess_bdr)
+      {
+         prolongations[level] = new RectangularConstrainedOperator(
+            transfer,
+            *essentialTrueDofs[level],
+            *essentialTrueDofs[level + 1],
+            true
+         );
+      }
+      else
+      {
+         prolongations[level] = transfer;
+      }
+   }
+}
+
+void PMultigridPreconditioner::AddCoarseLevel()
+{
+   BilinearForm &form = *forms[0];
+   const Array<int> &ess_tdofs = *essentialTrueDofs[0];
+   OperatorHandle op;
+   const bool own_op = FormLevelOperator(form, ess_tdofs, op);
+
+   Solver *solver;
+#ifdef MFEM_USE_MPI
+   if (ParBilinearForm *pform = dynamic_cast<ParBilinearForm*>(&form))
+   {
+      LORSolver<HypreBoomerAMG> *amg =
+         new LORSolver<HypreBoomerAMG>(*pform, ess_tdofs);
+      amg->GetSolver().SetPrintLevel(0);
+      solver = amg;
+   }
+   else
+#endif
+   {
+#ifdef MFEM_USE_SUITESPARSE
+      solver = new LORSolver<UMFPackSolver>(form, ess_tdofs);
+#else
+      solver = new LORSolver<GSSmoother>(form, ess_tdofs);
+#endif
+   }
+   AddLevel(op.Ptr(), solver, own_op, true);
+}
+
+void PMultigridPreconditioner::AddSmoothedLevel(int smoother_order)
+{
+   const int level = NumLevels();
+   BilinearForm &form = *forms[level];
+   const Array<int> &ess_tdofs = *essentialTrueDofs[level];
+   OperatorHandle op;
+   const bool own_op = FormLevelOperator(form, ess_tdofs, op);
+
+   Vector *diag = new Vector(fespaces[level]->GetTrueVSize());
+   form.AssembleDiagonal(*diag);
+   diagonals.Append(diag);
+
+#ifdef MFEM_USE_MPI
+   ParFiniteElementSpace *pfes =
+      dynamic_cast<ParFiniteElementSpace*>(fespaces[level]);
+   MPI_Comm comm = pfes ? pfes->GetComm() : MPI_COMM_NULL;
+   Solver *smoother = new OperatorChebyshevSmoother(*op, *diag, ess_tdofs,
+                                                    smoother_order, comm);
+#else
+   Solver *smoother = new OperatorChebyshevSmoother(*op, *diag, ess_tdofs,
+                                                    smoother_order);
+#endif
+   AddLevel(op.Ptr(), smoother, own_op, true);
+}
+
+PMultigridPreconditioner::~PMultigridPreconditioner()
+{
+   for (int i = 0; i < diagonals.Size(); ++i)
+   {
+      delete diagonals[i];
+   }
+   for (int i = 0; i < essentialTrueDofs.Size(); ++i)
+   {
+      delete essentialTrueDofs[i];
+   }
+   // The finest form and space are not owned
+   for (int i = 0; i < forms.Size() - 1; ++i)
+   {
+      delete forms[i];
+      delete fespaces[i];
+   }
+   for (int i = 0; i < fecs.Size(); ++i)
+   {
+      delete fecs[i];
+   }
+}
+
 } // namespace mfem
@@ -204,6 +204,57 @@ public:
    void RecoverFineFEMSolution(const Vector& X, const Vector& b, Vector& x);
 };
 
+/** @brief Matrix-free p-multigrid preconditioner built from a single
+    high-order BilinearForm.
+
+    The levels use the orders p, p/2, ..., 1 of the finite element collection
+    of the given form, on the same mesh. On each coarse level, a copy of the
+    integrators of the form, sharing its coefficients, is assembled with the
+    same assembly level as the form, e.g. partial assembly. The levels above
+    the coarsest one are smoothed with OperatorChebyshevSmoother, with the
+    largest eigenvalue estimated by power iterations, and the order 1 level is
+    solved approximately with a LORSolver: HypreBoomerAMG in parallel, and
+    UMFPackSolver (if available) or GSSmoother in serial. The transfers between
+    the levels are matrix-free TrueTransferOperator%s.
+
+    The form must be assembled, and its operator with the essential true dofs
+    of @a ess_bdr eliminated, given by BilinearForm::FormSystemMatrix(), is
+    the operator of the finest level. The space must use an H1_FECollection,
+    since the low-order refined coarse solver and the Chebyshev smoothers
+    assume an H1 problem. The integrators supported on the coarse levels are
+    DiffusionIntegrator, MassIntegrator, VectorDiffusionIntegrator and
+    VectorMassIntegrator, in the domain and on the boundary. Face integrators
+    and libCEED are not supported. */
+class PMultigridPreconditioner : public Multigrid
+{
+protected:
+   Array<FiniteElementCollection*> fecs;
+   Array<FiniteElementSpace*> fespaces; // all levels, the finest is not owned
+   Array<BilinearForm*> forms; // all levels, the finest is not owned
+   Array<Array<int>*> essentialTrueDofs;
+   Array<Vector*> diagonals;
+
+   /// Add the operator and the solver of the coarsest level.
+   void AddCoarseLevel();
+
+   /// Add the operator and the smoother of the next level.
+   void AddSmoothedLevel(int smoother_order);
+
+public:
+   /** @brief Construct the preconditioner for the assembled form @a a with the
+       essential boundary attributes @a ess_bdr. The Chebyshev smoothers have
+       order @a smoother_order. */
+   PMultigridPreconditioner(BilinearForm &a, const Array<int> &ess_bdr,
+                            int smoother_order = 2);
+
+   /// Return the finite element space of the given @a level.
+   const FiniteElementSpace &GetFESpaceAtLevel(int level) const
+   { return *fespaces[level]; }
+
+   /// Destructor
+   virtual ~PMultigridPreconditioner();
+};
+
 } // namespace mfem
 
 #endif
@@ -25,7 +25,9 @@ PANonlinearFormExtension::PANonlinearFormExtension(const NonlinearForm *nlf):
    NonlinearFormExtension(nlf),
    fes(*nlf->FESpace()),
    dnfi(*nlf->GetDNFI()),
+   fnfi(nlf->GetInteriorFaceIntegrators()),
    elemR(nullptr),
+   faceR(nullptr),
    Grad(*this)
 {
    if (!DeviceCanUseCeed())
@@ -52,11 +54,23 @@ real_t PANonlinearFormExtension::GetGridFunctionEnergy(const Vector &x) const
 
 void PANonlinearFormExtension::Assemble()
 {
-   MFEM_VERIFY(nlf->GetInteriorFaceIntegrators().Size() == 0 &&
-               nlf->GetBdrFaceIntegrators().Size() == 0,
-               "face integrators are not supported yet");
+   MFEM_VERIFY(nlf->GetBdrFaceIntegrators().Size() == 0,
+               "boundary face integrators are not supported yet");
+   MFEM_VERIFY(fnfi.Size() == 0 || !DeviceCanUseCeed(),
+               "interior face integrators are not supported with libCEED");
 
    for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AssemblePA(fes); }
+
+   if (fnfi.Size() > 0)
+   {
+      faceR = fes.GetFaceRestriction(ElementDofOrdering::LEXICOGRAPHIC,
+                                     FaceType::Interior,
+                                     L2FaceValues::DoubleValued);
+      xf.SetSize(faceR->Height(), Device::GetMemoryType());
+      yf.SetSize(faceR->Height(), Device::GetMemoryType());
+      yf.UseDevice(true);
+      for (int i = 0; i < fnfi.Size(); ++i) { fnfi[i]->AssembleFacePA(fes); }
+   }
 }
 
 void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
@@ -67,6 +81,16 @@ void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
       elemR->Mult(x, xe);
       for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AddMultPA(xe, ye); }
       elemR->MultTranspose(ye, y);
+      if (faceR)
+      {
+         yf = 0.0;
+         faceR->Mult(x, xf);
+         for (int i = 0; i < fnfi.Size(); ++i)
+         {
+            fnfi[i]->AddMultFacePA(xf, yf);
+         }
+         faceR->AddMultTranspose(yf, y);
+      }
    }
    else
    {
@@ -91,6 +115,14 @@ void PANonlinearFormExtension::Update()
    elemR = fes.GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
    xe.SetSize(elemR->Height());
    ye.SetSize(elemR->Height());
+   if (faceR)
+   {
+      faceR = fes.GetFaceRestriction(ElementDofOrdering::LEXICOGRAPHIC,
+                                     FaceType::Interior,
+                                     L2FaceValues::DoubleValued);
+      xf.SetSize(faceR->Height());
+      yf.SetSize(faceR->Height());
+   }
    Grad.Update();
 }
 
@@ -100,6 +132,8 @@ PANonlinearFormExtension::Gradient::Gradient(const PANonlinearFormExtension &e):
 
 void PANonlinearFormExtension::Gradient::AssembleGrad(const Vector &g)
 {
+   MFEM_VERIFY(ext.fnfi.Size() == 0,
+               "the gradient of interior face integrators is not supported");
    ext.elemR->Mult(g, ext.xe);
    for (int i = 0; i < ext.dnfi.Size(); ++i)
    {
@@ -90,9 +90,12 @@ private:
 
 protected:
    mutable Vector xe, ye;
+   mutable Vector xf, yf; // interior face E-vectors
    const FiniteElementSpace &fes;
    const Array<NonlinearFormIntegrator*> &dnfi;
+   const Array<NonlinearFormIntegrator*> &fnfi;
    const Operator *elemR; // not owned
+   const FaceRestriction *faceR; // not owned, used only with 'fnfi'
    mutable Gradient Grad;
 
 public:
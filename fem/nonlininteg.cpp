@@ -48,6 +48,18 @@ void NonlinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
                "   is not implemented for this class.");
 }
 
+void NonlinearFormIntegrator::AssembleFacePA(const FiniteElementSpace &)
+{
+   mfem_error ("NonlinearFormIntegrator::AssembleFacePA(...)\n"
+               "   is not implemented for this class.");
+}
+
+void NonlinearFormIntegrator::AddMultFacePA(const Vector &, Vector &) const
+{
+   mfem_error ("NonlinearFormIntegrator::AddMultFacePA(...)\n"
+               "   is not implemented for this class.");
+}
+
 void NonlinearFormIntegrator::AddMultGradPA(const Vector&, Vector&) const
 {
    mfem_error ("NonlinearFormIntegrator::AddMultGradPA(...)\n"
@@ -120,6 +120,22 @@ public:
        called. */
    virtual void AddMultPA(const Vector &x, Vector &y) const;
 
+   /// Method defining partial assembly of the interior face terms.
+   /** This is the partial assembly counterpart of AssembleFaceVector(). The
+       result is stored internally so that it can be used later in the method
+       AddMultFacePA(). */
+   virtual void AssembleFacePA(const FiniteElementSpace &fes);
+
+   /// Method for partially assembled action of the interior face terms.
+   /** Both @a x and @a y are face E-vectors of the FaceRestriction returned by
+       FiniteElementSpace::GetFaceRestriction() with the arguments
+       ElementDofOrdering::LEXICOGRAPHIC, FaceType::Interior, and
+       L2FaceValues::DoubleValued.
+
+       This method can be called only after the method AssembleFacePA() has
+       been called. */
+   virtual void AddMultFacePA(const Vector &x, Vector &y) const;
+
    /// Method for partially assembled gradient action.
    /** All arguments are E-vectors. This method can be called only after the
        method AssembleGradPA() has been called.
@@ -10,6 +10,12 @@
 // CONTRIBUTING.md for details.
 
 #include "particleset.hpp"
+#include "../general/forall.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <numeric>
 
 #if defined(MFEM_USE_MPI) && defined(MFEM_USE_GSLIB)
 
@@ -368,23 +374,6 @@ ParticleSet::TransferParticlesType ParticleSet::TransferParticles::Kernel()
    return &ParticleSet::TransferParticlesImpl<NBytes>;
 }
 
-ParticleSet::Kernels::Kernels()
-{
-   constexpr size_t sizd = sizeof(real_t);
-   TransferParticles::Specialization<2*sizd>::Add();
-   TransferParticles::Specialization<3*sizd>::Add();
-   TransferParticles::Specialization<4*sizd>::Add();
-   TransferParticles::Specialization<8*sizd>::Add();
-   TransferParticles::Specialization<12*sizd>::Add();
-   TransferParticles::Specialization<16*sizd>::Add();
-   TransferParticles::Specialization<20*sizd>::Add();
-   TransferParticles::Specialization<24*sizd>::Add();
-   TransferParticles::Specialization<28*sizd>::Add();
-   TransferParticles::Specialization<32*sizd>::Add();
-   TransferParticles::Specialization<36*sizd>::Add();
-   TransferParticles::Specialization<40*sizd>::Add();
-}
-
 auto ParticleSet::TransferParticles::Fallback(size_t bufsize)
 -> ParticleSet::TransferParticlesType
 {
@@ -466,6 +455,197 @@ void ParticleSet::Redistribute(const Array<unsigned int> &rank_list)
 
 #endif // MFEM_USE_MPI && MFEM_USE_GSLIB
 
+#ifdef MFEM_USE_MPI
+
+size_t ParticleSet::GetParticleBytes() const
+{
+   const int nreals = GetFieldVDims().Sum() + coords.GetVDim();
+   return sizeof(IDType) + nreals*sizeof(real_t) + GetNTags()*sizeof(int);
+}
+
+void ParticleSet::PackParticle(int i, char *buf) const
+{
+   std::memcpy(buf, &ids[i], sizeof(IDType));
+   buf += sizeof(IDType);
+   for (int f = -1; f < GetNFields(); f++)
+   {
+      const ParticleVector &pv = (f == -1 ? coords : *fields[f]);
+      for (int c = 0; c < pv.GetVDim(); c++)
+      {
+         std::memcpy(buf, &pv(i, c), sizeof(real_t));
+         buf += sizeof(real_t);
+      }
+   }
+   for (int t = 0; t < GetNTags(); t++)
+   {
+      std::memcpy(buf, &(*tags[t])[i], sizeof(int));
+      buf += sizeof(int);
+   }
+}
+
+void ParticleSet::UnpackParticle(int i, const char *buf)
+{
+   std::memcpy(&ids[i], buf, sizeof(IDType));
+   buf += sizeof(IDType);
+   for (int f = -1; f < GetNFields(); f++)
+   {
+      ParticleVector &pv = (f == -1 ? coords : *fields[f]);
+      for (int c = 0; c < pv.GetVDim(); c++)
+      {
+         std::memcpy(&pv(i, c), buf, sizeof(real_t));
+         buf += sizeof(real_t);
+      }
+   }
+   for (int t = 0; t < GetNTags(); t++)
+   {
+      std::memcpy(&(*tags[t])[i], buf, sizeof(int));
+      buf += sizeof(int);
+   }
+}
+
+// MPI message tags of the neighbor-only Redistribute(). The non-blocking
+// consensus alternates between two tags, so that messages of the next call,
+// sent by a rank that already left the barrier, are not received too early.
+static constexpr int PARTICLE_NBR_TAG = 4720;
+static constexpr int PARTICLE_FAR_TAG = 4721; // and 4722
+
+/// Append the message of size @a count waiting from @a rank to @a buf.
+static void RecvAppend(int rank, int tag, int count, MPI_Comm comm,
+                       std::vector<char> &buf)
+{
+   const size_t offset = buf.size();
+   buf.resize(offset + count);
+   MPI_Recv(buf.data() + offset, count, MPI_BYTE, rank, tag, comm,
+            MPI_STATUS_IGNORE);
+}
+
+void ParticleSet::Redistribute(const Array<unsigned int> &rank_list,
+                               ParMesh &pmesh)
+{
+   MFEM_VERIFY(rank_list.Size() == GetNParticles(),
+               "rank_list must be of size GetNParticles().");
+
+   const int rank = GetRank(comm), nranks = GetSize(comm);
+   const size_t pbytes = GetParticleBytes();
+   const int far_tag = PARTICLE_FAR_TAG + nbr_redistribute_count++ % 2;
+
+   // One (possibly empty) buffer for each face neighbor, one for each other
+   // destination
+   pmesh.ExchangeFaceNbrData();
+   std::map<int, std::vector<char>> nbr_bufs, far_bufs;
+   for (int fn = 0; fn < pmesh.GetNFaceNeighbors(); fn++)
+   {
+      nbr_bufs[pmesh.GetFaceNbrRank(fn)];
+   }
+
+   coords.HostRead();
+   for (int f = 0; f < GetNFields(); f++) { fields[f]->HostRead(); }
+   for (int t = 0; t < GetNTags(); t++) { tags[t]->HostRead(); }
+
+   Array<int> send_idxs;
+   for (int i = 0; i < rank_list.Size(); i++)
+   {
+      const int dest = rank_list[i];
+      if (dest == rank) { continue; }
+      MFEM_VERIFY(dest >= 0 && dest < nranks, "invalid rank " << dest);
+      send_idxs.Append(i);
+      auto it = nbr_bufs.find(dest);
+      std::vector<char> &buf = (it != nbr_bufs.end()) ? it->second
+                               : far_bufs[dest];
+      const size_t offset = buf.size();
+      buf.resize(offset + pbytes);
+      PackParticle(i, buf.data() + offset);
+   }
+
+   std::vector<MPI_Request> nbr_reqs, far_reqs;
+   nbr_reqs.reserve(nbr_bufs.size());
+   far_reqs.reserve(far_bufs.size());
+   for (auto &nb : nbr_bufs)
+   {
+      nbr_reqs.emplace_back();
+      MPI_Isend(nb.second.data(), int(nb.second.size()), MPI_BYTE, nb.first,
+                PARTICLE_NBR_TAG, comm, &nbr_reqs.back());
+   }
+   for (auto &fb : far_bufs)
+   {
+      far_reqs.emplace_back();
+      MPI_Issend(fb.second.data(), int(fb.second.size()), MPI_BYTE, fb.first,
+                 far_tag, comm, &far_reqs.back());
+   }
+
+   // Receive exactly one message from each neighbor. Probing a given source
+   // keeps the messages of consecutive calls in order.
+   std::vector<char> recv_buf;
+   for (auto &nb : nbr_bufs)
+   {
+      MPI_Status status;
+      int count;
+      MPI_Probe(nb.first, PARTICLE_NBR_TAG, comm, &status);
+      MPI_Get_count(&status, MPI_BYTE, &count);
+      RecvAppend(nb.first, PARTICLE_NBR_TAG, count, comm, recv_buf);
+   }
+
+   // Non-blocking consensus (https://scorec.rpi.edu/REPORTS/2015-9.pdf) for
+   // the messages to other ranks: once all our synchronous sends have been
+   // received, enter a non-blocking barrier and keep receiving until it
+   // completes on all ranks.
+   MPI_Request barrier = MPI_REQUEST_NULL;
+   int done = 0;
+   while (!done)
+   {
+      int flag;
+      MPI_Status status;
+      MPI_Iprobe(MPI_ANY_SOURCE, far_tag, comm, &flag, &status);
+      if (flag)
+      {
+         int count;
+         MPI_Get_count(&status, MPI_BYTE, &count);
+         RecvAppend(status.MPI_SOURCE, far_tag, count, comm, recv_buf);
+         continue;
+      }
+      if (barrier != MPI_REQUEST_NULL)
+      {
+         MPI_Test(&barrier, &done, MPI_STATUS_IGNORE);
+      }
+      else
+      {
+         int sent;
+         MPI_Testall(int(far_reqs.size()), far_reqs.data(), &sent,
+                     MPI_STATUSES_IGNORE);
+         if (sent) { MPI_Ibarrier(comm, &barrier); }
+      }
+   }
+   MPI_Waitall(int(nbr_reqs.size()), nbr_reqs.data(), MPI_STATUSES_IGNORE);
+
+   // Reuse the slots of the sent particles for the received ones, as in
+   // TransferParticlesImpl()
+   const int nsend = send_idxs.Size();
+   const int nrecv = int(recv_buf.size()/pbytes);
+   Array<int> recv_idxs(std::min(nsend, nrecv));
+   for (int i = 0; i < recv_idxs.Size(); i++) { recv_idxs[i] = send_idxs[i]; }
+   if (nrecv < nsend)
+   {
+      Array<int> delete_idxs(send_idxs.GetData() + nrecv, nsend - nrecv);
+      RemoveParticles(delete_idxs);
+   }
+   else if (nrecv > nsend)
+   {
+      Array<int> new_idxs;
+      AddParticles(Array<IDType>(nrecv - nsend), &new_idxs);
+      recv_idxs.Append(new_idxs);
+   }
+
+   coords.HostReadWrite();
+   for (int f = 0; f < GetNFields(); f++) { fields[f]->HostReadWrite(); }
+   for (int t = 0; t < GetNTags(); t++) { tags[t]->HostReadWrite(); }
+   for (int i = 0; i < nrecv; i++)
+   {
+      UnpackParticle(recv_idxs[i], recv_buf.data() + i*pbytes);
+   }
+}
+
+#endif // MFEM_USE_MPI
+
 Particle ParticleSet::CreateParticle() const
 {
    return Particle(GetDim(), GetFieldVDims(), GetNTags());
@@ -769,6 +949,220 @@ void ParticleSet::RemoveParticles(const Array<int> &list)
    }
 }
 
+/// \cond DO_NOT_DOCUMENT
+template<int T_VDIM>
+void ParticleSet::PermuteDataImpl(const Array<int> &perm, int vdim,
+                                  Ordering::Type ordering, const Vector &src,
+                                  Vector &dst)
+{
+   const int vd = T_VDIM ? T_VDIM : vdim;
+   const int np = perm.Size();
+   const bool byvdim = (ordering == Ordering::byVDIM);
+   const auto d_perm = perm.Read();
+   const auto d_src = src.Read();
+   auto d_dst = dst.Write();
+   mfem::forall(np, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int j = d_perm[i];
+      for (int c = 0; c < vd; c++)
+      {
+         d_dst[byvdim ? i*vd + c : i + c*np] =
+            d_src[byvdim ? j*vd + c : j + c*np];
+      }
+   });
+}
+
+template<int T_VDIM>
+ParticleSet::PermuteDataType ParticleSet::PermuteData::Kernel()
+{
+   return &ParticleSet::PermuteDataImpl<T_VDIM>;
+}
+
+ParticleSet::PermuteDataType ParticleSet::PermuteData::Fallback(int)
+{
+   return &ParticleSet::PermuteDataImpl<0>;
+}
+
+ParticleSet::Kernels::Kernels()
+{
+   PermuteData::Specialization<1>::Add();
+   PermuteData::Specialization<2>::Add();
+   PermuteData::Specialization<3>::Add();
+#if defined(MFEM_USE_MPI) && defined(MFEM_USE_GSLIB)
+   constexpr size_t sizd = sizeof(real_t);
+   TransferParticles::Specialization<2*sizd>::Add();
+   TransferParticles::Specialization<3*sizd>::Add();
+   TransferParticles::Specialization<4*sizd>::Add();
+   TransferParticles::Specialization<8*sizd>::Add();
+   TransferParticles::Specialization<12*sizd>::Add();
+   TransferParticles::Specialization<16*sizd>::Add();
+   TransferParticles::Specialization<20*sizd>::Add();
+   TransferParticles::Specialization<24*sizd>::Add();
+   TransferParticles::Specialization<28*sizd>::Add();
+   TransferParticles::Specialization<32*sizd>::Add();
+   TransferParticles::Specialization<36*sizd>::Add();
+   TransferParticles::Specialization<40*sizd>::Add();
+#endif // MFEM_USE_MPI && MFEM_USE_GSLIB
+}
+/// \endcond DO_NOT_DOCUMENT
+
+template <typename T>
+static void PermuteArray(const Array<int> &perm, Array<T> &arr)
+{
+   Array<T> tmp(arr.Size());
+   const auto d_perm = perm.Read();
+   const auto d_arr = arr.Read();
+   auto d_tmp = tmp.Write();
+   mfem::forall(perm.Size(), [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_tmp[i] = d_arr[d_perm[i]];
+   });
+   arr.Swap(tmp);
+}
+
+void ParticleSet::PermuteParticles(const Array<int> &perm)
+{
+   MFEM_VERIFY(perm.Size() == GetNParticles(),
+               "perm must be of size GetNParticles().");
+   static Kernels kernels;
+
+   PermuteArray(perm, ids);
+
+   Vector tmp;
+   for (int f = -1; f < GetNFields(); f++)
+   {
+      ParticleVector &pv = (f == -1 ? coords : *fields[f]);
+      tmp.SetSize(pv.Size());
+      tmp.UseDevice(true);
+      PermuteData::Run(pv.GetVDim(), perm, pv.GetVDim(), pv.GetOrdering(), pv,
+                       tmp);
+      pv.Swap(tmp);
+   }
+
+   for (int t = 0; t < GetNTags(); t++)
+   {
+      PermuteArray(perm, *tags[t]);
+   }
+}
+
+template <typename T>
+real_t ParticleSet::Disorder(const Array<T> &keys)
+{
+   if (keys.Size() < 2) { return 0.0; }
+   const T *k = keys.HostRead();
+   int count = 0;
+   for (int i = 1; i < keys.Size(); i++)
+   {
+      if (k[i] < k[i-1]) { count++; }
+   }
+   return real_t(count)/(keys.Size() - 1);
+}
+
+void ParticleSet::GetMortonKeys(Array<unsigned long long> &keys) const
+{
+   const int np = GetNParticles(), dim = coords.GetVDim();
+   MFEM_VERIFY(dim >= 1 && dim <= 3, "invalid particle dimension " << dim);
+   // Number of bits per coordinate, such that the key fits in 64 bits
+   const int bits = (dim == 3) ? 21 : 32;
+   const real_t nq = real_t(1ULL << bits);
+
+   Vector pmin(dim), pmax(dim);
+   pmin = infinity();
+   pmax = -infinity();
+   coords.HostRead();
+   for (int i = 0; i < np; i++)
+   {
+      for (int d = 0; d < dim; d++)
+      {
+         pmin(d) = std::min(pmin(d), coords(i, d));
+         pmax(d) = std::max(pmax(d), coords(i, d));
+      }
+   }
+
+   keys.SetSize(np);
+   for (int i = 0; i < np; i++)
+   {
+      unsigned long long q[3] = {0, 0, 0};
+      for (int d = 0; d < dim; d++)
+      {
+         const real_t len = pmax(d) - pmin(d);
+         if (len <= 0.0) { continue; }
+         const real_t s = (coords(i, d) - pmin(d))/len*nq;
+         q[d] = std::min((unsigned long long)s, (1ULL << bits) - 1);
+      }
+      // Interleave the bits, most significant first
+      unsigned long long key = 0;
+      for (int b = bits - 1; b >= 0; b--)
+      {
+         for (int d = 0; d < dim; d++)
+         {
+            key = (key << 1) | ((q[d] >> b) & 1ULL);
+         }
+      }
+      keys[i] = key;
+   }
+}
+
+/// Return the permutation that stably sorts @a keys.
+template <typename T>
+static void SortingPermutation(const Array<T> &keys, Array<int> &perm)
+{
+   perm.SetSize(keys.Size());
+   std::iota(perm.begin(), perm.end(), 0);
+   const T *k = keys.HostRead();
+   std::stable_sort(perm.begin(), perm.end(),
+                    [k](int a, int b) { return k[a] < k[b]; });
+}
+
+void ParticleSet::SortParticles(const Array<unsigned int> &elem,
+                                Array<int> *perm)
+{
+   MFEM_VERIFY(elem.Size() == GetNParticles(),
+               "elem must be of size GetNParticles().");
+   Array<int> p;
+   SortingPermutation(elem, p);
+   PermuteParticles(p);
+   sort_penalty = 0.0;
+   if (perm) { perm->Swap(p); }
+}
+
+void ParticleSet::SortParticles(Array<int> *perm)
+{
+   Array<unsigned long long> keys;
+   GetMortonKeys(keys);
+   Array<int> p;
+   SortingPermutation(keys, p);
+   PermuteParticles(p);
+   sort_penalty = 0.0;
+   if (perm) { perm->Swap(p); }
+}
+
+bool ParticleSet::SortParticlesIfNeeded(const Array<unsigned int> *elem,
+                                        Array<int> *perm)
+{
+   Array<unsigned long long> keys;
+   if (elem)
+   {
+      MFEM_VERIFY(elem->Size() == GetNParticles(),
+                  "elem must be of size GetNParticles().");
+      sort_penalty += Disorder(*elem);
+   }
+   else
+   {
+      GetMortonKeys(keys);
+      sort_penalty += Disorder(keys);
+   }
+   if (sort_penalty < sort_cost) { return false; }
+
+   Array<int> p;
+   if (elem) { SortingPermutation(*elem, p); }
+   else { SortingPermutation(keys, p); }
+   PermuteParticles(p);
+   sort_penalty = 0.0;
+   if (perm) { perm->Swap(p); }
+   return true;
+}
+
 Particle ParticleSet::GetParticle(int i) const
 {
    Particle p = CreateParticle();
@@ -333,6 +333,19 @@ protected:
 
 #ifdef MFEM_USE_MPI
    MPI_Comm comm;
+
+   /// Number of calls to the neighbor-only Redistribute().
+   int nbr_redistribute_count = 0;
+
+   /// Number of bytes of a packed particle, see PackParticle().
+   size_t GetParticleBytes() const;
+
+   /** @brief Copy the ID, coordinates, fields and tags of particle \p i to
+       \p buf, which must have room for GetParticleBytes() bytes. */
+   void PackParticle(int i, char *buf) const;
+
+   /// Set particle \p i from the data packed by PackParticle() in \p buf.
+   void UnpackParticle(int i, const char *buf);
 #endif // MFEM_USE_MPI
 
 #if defined(MFEM_USE_MPI) && defined(MFEM_USE_GSLIB)
@@ -352,13 +365,42 @@ protected:
    // Specialization parameter: NBytes
    MFEM_REGISTER_KERNELS(TransferParticles, TransferParticlesType, (size_t));
    friend TransferParticles;
+   /// \endcond
+
+#endif // MFEM_USE_MPI && MFEM_USE_GSLIB
+
+   /// \cond DO_NOT_DOCUMENT
+   template<int T_VDIM>
+   static void PermuteDataImpl(const Array<int> &perm, int vdim,
+                               Ordering::Type ordering, const Vector &src,
+                               Vector &dst);
+
+   using PermuteDataType = void (*)(const Array<int> &perm, int vdim,
+                                    Ordering::Type ordering,
+                                    const Vector &src, Vector &dst);
+
+   // Specialization parameter: vdim
+   MFEM_REGISTER_KERNELS(PermuteData, PermuteDataType, (int));
+   friend PermuteData;
    struct Kernels
    {
       Kernels();
    };
    /// \endcond
 
-#endif // MFEM_USE_MPI && MFEM_USE_GSLIB
+   /// Relative cost of sorting the particles, see SortParticlesIfNeeded().
+   real_t sort_cost = 2.0;
+
+   /// Disorder accumulated since the last sort, see SortParticlesIfNeeded().
+   real_t sort_penalty = 0.0;
+
+   /** @brief Return the fraction of consecutive particles whose @a keys
+       decrease, 0 for sorted keys. */
+   template <typename T>
+   static real_t Disorder(const Array<T> &keys);
+
+   /// Compute the Morton (Z-order) keys of the particle coordinates.
+   void GetMortonKeys(Array<unsigned long long> &keys) const;
 
    /** @brief  Update global ID of a particle.
     *
@@ -602,6 +644,55 @@ public:
    /// Remove particle data specified by \p list of particle indices.
    void RemoveParticles(const Array<int> &list);
 
+   /** @brief Reorder the particle storage such that the particle at index
+       \p perm[i] is moved to index i.
+
+       The IDs, coordinates, fields and tags are moved together, so a particle
+       keeps its global ID. The data is permuted on the device when the
+       ParticleVector%s are on the device. */
+   void PermuteParticles(const Array<int> &perm);
+
+   /** @brief Sort the particle storage by owning element, e.g. by the result
+       of FindPointsGSLIB::GetElem(), so that the particles in the same element
+       are contiguous in memory.
+
+       @param[in] elem    Array of size GetNParticles() with the element of
+                          each particle.
+       @param[out] perm   (Optional) The applied permutation, see
+                          PermuteParticles(). It can be used to reorder other
+                          per-particle arrays, such as \p elem itself.
+
+       The sort is stable: particles in the same element keep their relative
+       order. */
+   void SortParticles(const Array<unsigned int> &elem,
+                      Array<int> *perm=nullptr);
+
+   /** @brief Sort the particle storage by the Morton (Z-order) key of the
+       coordinates in their bounding box, so that particles close in space are
+       close in memory. The optional output \p perm is the applied
+       permutation, see PermuteParticles(). */
+   void SortParticles(Array<int> *perm=nullptr);
+
+   /** @brief Sort the particle storage by element (if \p elem is given) or
+       by Morton key, only when it is expected to pay off.
+
+       Intended to be called once per step, e.g. after the particles are moved
+       and located. The fraction of consecutive particles that are out of
+       order is accumulated over the calls, as an estimate of the cost of the
+       scattered memory accesses in the previous steps. When it exceeds the
+       relative cost of a sort, set with SetSortCost(), the particles are
+       sorted and the accumulation restarts.
+
+       @return True if the particles were sorted, in which case \p perm (if
+       given) is the applied permutation. */
+   bool SortParticlesIfNeeded(const Array<unsigned int> *elem=nullptr,
+                              Array<int> *perm=nullptr);
+
+   /** @brief Set the cost of sorting relative to one pass over fully
+       unordered particle data, used by SortParticlesIfNeeded(). The default
+       is 2. */
+   void SetSortCost(real_t cost) { sort_cost = cost; }
+
    /// Get a reference to the coordinates ParticleVector.
    ParticleVector& Coords() { return coords; }
 
@@ -673,6 +764,33 @@ public:
 
 #endif // MFEM_USE_MPI && MFEM_USE_GSLIB
 
+#ifdef MFEM_USE_MPI
+
+   /** @brief Redistribute particle data to \p rank_list, exchanging data
+       directly with the face neighbors of \p pmesh.
+
+       @param[in] rank_list    Array of size GetNParticles() denoting ultimate
+                               destination of particle data. Index = this rank
+                               means no data is moved.
+       @param[in] pmesh        Mesh whose face neighbor ranks
+                               (ParMesh::face_nbr_group) are used for the
+                               exchange; its communicator must have the same
+                               ranks as the one of this ParticleSet.
+
+       Each rank exchanges one, possibly empty, message with each of its face
+       neighbors. Particles sent to other ranks (e.g. across a corner or after
+       a long jump) are sent with synchronous point-to-point messages and
+       received with a non-blocking consensus, which only adds a non-blocking
+       barrier to the cost. Unlike Redistribute(const Array<unsigned int>&),
+       no global all-to-all exchange is done, which is much cheaper when few
+       particles cross a partition boundary in each step.
+
+       @note This method is collective on the ParticleSet communicator and
+       calls ParMesh::ExchangeFaceNbrData(). It does not require GSLIB. */
+   void Redistribute(const Array<unsigned int> &rank_list, ParMesh &pmesh);
+
+#endif // MFEM_USE_MPI
+
    /// Destructor
    ~ParticleSet();
    ParticleSet(const ParticleSet&) = delete;
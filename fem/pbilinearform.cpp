@@ -16,6 +16,8 @@
 #include "fem.hpp"
 #include "../general/sort_pairs.hpp"
 
+#include <algorithm>
+
 namespace mfem
 {
 
@@ -503,6 +505,16 @@ void ParBilinearForm::FormLinearSystem(
          X.SetSize(B.Size());
          X = 0.0;
       }
+      else if (UseCommunicationOverlap())
+      {
+         InitTVectors(&P, &R, &P, x, b, X, B);
+         if (!copy_interior) { X.SetSubVectorComplement(ess_tdof_list, 0.0); }
+         ConstrainedOperator *A_constrained =
+            new ConstrainedOperator(new ParOverlapOperator(*this),
+                                    ess_tdof_list, true);
+         A_constrained->EliminateRHS(X, B);
+         A.Reset(A_constrained);
+      }
       else
       {
          ext->FormLinearSystem(ess_tdof_list, x, b, A, X, B, copy_interior);
@@ -558,6 +570,11 @@ void ParBilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
          Finalize(remove_zeros);
          hybridization->GetParallelMatrix(A);
       }
+      else if (UseCommunicationOverlap())
+      {
+         A.Reset(new ConstrainedOperator(new ParOverlapOperator(*this),
+                                         ess_tdof_list, true));
+      }
       else
       {
          ext->FormSystemMatrix(ess_tdof_list, A);
@@ -579,7 +596,13 @@ void ParBilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
    }
    else
    {
-      if (mat)
+      if (mat && elim_pending)
+      {
+         const int remove_zeros = 0;
+         Finalize(remove_zeros);
+         ParallelReassemble(ess_tdof_list);
+      }
+      else if (mat && !elim_map_ready)
       {
          const int remove_zeros = 0;
          Finalize(remove_zeros);
@@ -587,11 +610,20 @@ void ParBilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
                      "The ParBilinearForm must be updated with Update() before "
                      "re-assembling the ParBilinearForm.");
          ParallelAssemble(p_mat, mat);
-         delete mat;
-         mat = NULL;
          delete mat_e;
          mat_e = NULL;
          ParallelEliminateTDofs(ess_tdof_list);
+         if (values_only_reassembly && !hybridization &&
+             p_mat.Type() == Operator::Hypre_ParCSR)
+         {
+            // Keep mat, p_mat, and p_mat_e for the next values-only Update()
+            BuildParallelEliminationMap(ess_tdof_list);
+         }
+         else
+         {
+            delete mat;
+            mat = NULL;
+         }
       }
       if (hybridization)
       {
@@ -604,6 +636,156 @@ void ParBilinearForm::FormSystemMatrix(const Array<int> &ess_tdof_list,
    }
 }
 
+// Return true if the hypre_CSRMatrix objects a and b have the same sparsity.
+static bool SameCSRPattern(hypre_CSRMatrix *a, hypre_CSRMatrix *b)
+{
+   const HYPRE_Int n = hypre_CSRMatrixNumRows(a);
+   if (n != hypre_CSRMatrixNumRows(b)) { return false; }
+   const HYPRE_Int *Ia = hypre_CSRMatrixI(a), *Ib = hypre_CSRMatrixI(b);
+   if (!std::equal(Ia, Ia + n + 1, Ib)) { return false; }
+   const HYPRE_Int *Ja = hypre_CSRMatrixJ(a), *Jb = hypre_CSRMatrixJ(b);
+   return std::equal(Ja, Ja + Ia[n], Jb);
+}
+
+void ParBilinearForm::BuildParallelEliminationMap(
+   const Array<int> &ess_tdof_list)
+{
+   elim_vdofs = ess_tdof_list;
+   elim_policy = DIAG_ONE; // used by hypre_ParCSRMatrixEliminateAAe
+   elim_map.SetSize(0);
+   elim_diag_map.SetSize(0);
+   p_elim_offd_map.SetSize(0);
+
+   HypreParMatrix &A = *p_mat.As<HypreParMatrix>();
+   HypreParMatrix &Ae = *p_mat_e.As<HypreParMatrix>();
+   A.HostRead();
+   Ae.HostRead();
+   hypre_ParCSRMatrix *pA = A, *pAe = Ae;
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(pA);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(pA);
+   hypre_CSRMatrix *Ae_diag = hypre_ParCSRMatrixDiag(pAe);
+   hypre_CSRMatrix *Ae_offd = hypre_ParCSRMatrixOffd(pAe);
+   const HYPRE_BigInt *cmap = hypre_ParCSRMatrixColMapOffd(pA);
+   const HYPRE_BigInt *cmap_e = hypre_ParCSRMatrixColMapOffd(pAe);
+   const int nrows = hypre_CSRMatrixNumRows(A_diag);
+
+   Array<int> ess_marker(nrows);
+   ess_marker = 0;
+   ess_tdof_list.HostRead();
+   for (int i = 0; i < ess_tdof_list.Size(); i++)
+   {
+      ess_marker[ess_tdof_list[i]] = 1;
+   }
+
+   // Every entry of Ae was moved from the entry of A in the same row and
+   // (global) column, see hypre_ParCSRMatrixEliminateAAe()
+   {
+      const HYPRE_Int *I = hypre_CSRMatrixI(A_diag);
+      const HYPRE_Int *J = hypre_CSRMatrixJ(A_diag);
+      const HYPRE_Int *Ie = hypre_CSRMatrixI(Ae_diag);
+      const HYPRE_Int *Je = hypre_CSRMatrixJ(Ae_diag);
+      for (int i = 0; i < nrows; i++)
+      {
+         for (int ke = Ie[i]; ke < Ie[i+1]; ke++)
+         {
+            int k = I[i];
+            while (k < I[i+1] && J[k] != Je[ke]) { k++; }
+            MFEM_VERIFY(k < I[i+1], "invalid eliminated matrix");
+            Array<int> &map = (Je[ke] == i && ess_marker[i]) ?
+                              elim_diag_map : elim_map;
+            map.Append(k);
+            map.Append(ke);
+         }
+      }
+   }
+   {
+      const HYPRE_Int *I = hypre_CSRMatrixI(A_offd);
+      const HYPRE_Int *J = hypre_CSRMatrixJ(A_offd);
+      const HYPRE_Int *Ie = hypre_CSRMatrixI(Ae_offd);
+      const HYPRE_Int *Je = hypre_CSRMatrixJ(Ae_offd);
+      for (int i = 0; i < nrows; i++)
+      {
+         for (int ke = Ie[i]; ke < Ie[i+1]; ke++)
+         {
+            int k = I[i];
+            while (k < I[i+1] && cmap[J[k]] != cmap_e[Je[ke]]) { k++; }
+            MFEM_VERIFY(k < I[i+1], "invalid eliminated matrix");
+            p_elim_offd_map.Append(k);
+            p_elim_offd_map.Append(ke);
+         }
+      }
+   }
+   elim_map_ready = true;
+   elim_pending = false;
+}
+
+void ParBilinearForm::ParallelReassemble(const Array<int> &ess_tdof_list)
+{
+   OperatorHandle p_new(p_mat.Type());
+   ParallelAssemble(p_new, mat);
+
+   HypreParMatrix &A = *p_mat.As<HypreParMatrix>();
+   HypreParMatrix &A_new = *p_new.As<HypreParMatrix>();
+   A.HostReadWrite();
+   A_new.HostRead();
+   hypre_ParCSRMatrix *pA = A, *pA_new = A_new;
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(pA);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(pA);
+   hypre_CSRMatrix *A_new_diag = hypre_ParCSRMatrixDiag(pA_new);
+   hypre_CSRMatrix *A_new_offd = hypre_ParCSRMatrixOffd(pA_new);
+   const int ncols_offd = hypre_CSRMatrixNumCols(A_offd);
+   const HYPRE_BigInt *cmap = hypre_ParCSRMatrixColMapOffd(pA);
+   const HYPRE_BigInt *cmap_new = hypre_ParCSRMatrixColMapOffd(pA_new);
+
+   ess_tdof_list.HostRead();
+   const bool local_reuse =
+      ess_tdof_list == elim_vdofs &&
+      ncols_offd == hypre_CSRMatrixNumCols(A_new_offd) &&
+      std::equal(cmap, cmap + ncols_offd, cmap_new) &&
+      SameCSRPattern(A_diag, A_new_diag) && SameCSRPattern(A_offd, A_new_offd);
+   // The elimination below is collective, all ranks must take the same branch
+   bool reuse;
+   MPI_Allreduce(&local_reuse, &reuse, 1, MFEM_MPI_CXX_BOOL, MPI_LAND,
+                 pfes->GetComm());
+   if (!reuse)
+   {
+      A.HypreRead();
+      p_new.SetOperatorOwner(false);
+      p_mat.Reset(&A_new);
+      ParallelEliminateTDofs(ess_tdof_list);
+      BuildParallelEliminationMap(ess_tdof_list);
+      return;
+   }
+
+   // Copy the values, keeping the diag/offd split, the column map and the
+   // communication package of p_mat
+   const HYPRE_Int nnz_diag = hypre_CSRMatrixI(A_diag)[
+                                 hypre_CSRMatrixNumRows(A_diag)];
+   const HYPRE_Int nnz_offd = hypre_CSRMatrixI(A_offd)[
+                                 hypre_CSRMatrixNumRows(A_offd)];
+   std::copy(hypre_CSRMatrixData(A_new_diag),
+             hypre_CSRMatrixData(A_new_diag) + nnz_diag,
+             hypre_CSRMatrixData(A_diag));
+   std::copy(hypre_CSRMatrixData(A_new_offd),
+             hypre_CSRMatrixData(A_new_offd) + nnz_offd,
+             hypre_CSRMatrixData(A_offd));
+
+   HypreParMatrix &Ae = *p_mat_e.As<HypreParMatrix>();
+   Ae.HostReadWrite();
+   hypre_ParCSRMatrix *pAe = Ae;
+   ApplyEliminationMap(elim_map, elim_diag_map, 1.0,
+                       hypre_CSRMatrixData(A_diag),
+                       hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(pAe)));
+   const Array<int> no_diag;
+   ApplyEliminationMap(p_elim_offd_map, no_diag, 1.0,
+                       hypre_CSRMatrixData(A_offd),
+                       hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(pAe)));
+   A.HypreRead();
+   Ae.HypreRead();
+   elim_pending = false;
+}
+
 void ParBilinearForm::RecoverFEMSolution(
    const Vector &X, const Vector &b, Vector &x)
 {
@@ -649,8 +831,160 @@ void ParBilinearForm::Update(FiniteElementSpace *nfes)
       MFEM_VERIFY(pfes != NULL, "nfes must be a ParFiniteElementSpace!");
    }
 
-   p_mat.Clear();
-   p_mat_e.Clear();
+   if (!elim_map_ready)
+   {
+      p_mat.Clear();
+      p_mat_e.Clear();
+   }
+}
+
+bool ParBilinearForm::UseCommunicationOverlap() const
+{
+   return overlap_comm && ext && !hybridization &&
+          (assembly == AssemblyLevel::PARTIAL ||
+           assembly == AssemblyLevel::ELEMENT) &&
+          dynamic_cast<const ConformingProlongationOperator*>(
+             pfes->GetProlongationMatrix()) != nullptr;
+}
+
+static const ConformingProlongationOperator &GetConformingProlongation(
+   const ParFiniteElementSpace &pfes)
+{
+   const auto *P = dynamic_cast<const ConformingProlongationOperator*>(
+                      pfes.GetProlongationMatrix());
+   MFEM_VERIFY(P, "the prolongation is not a ConformingProlongationOperator");
+   return *P;
+}
+
+static const Operator &GetFormExtension(
+   const std::unique_ptr<BilinearFormExtension> &ext)
+{
+   MFEM_VERIFY(ext, "an assembly level other than LEGACY is required");
+   return *ext;
+}
+
+ParOverlapOperator::ParOverlapOperator(ParBilinearForm &a)
+   : Operator(a.ParFESpace()->GetTrueVSize()),
+     A(GetFormExtension(a.ext)),
+     P(GetConformingProlongation(*a.ParFESpace())),
+     A_ext(P.Height()),
+     num_bdr_elems(0)
+{
+   MFEM_VERIFY(a.GetFBFI()->Size() == 0 && a.GetBFBFI()->Size() == 0,
+               "face integrators are not supported");
+
+   ParFiniteElementSpace &pfes = *a.ParFESpace();
+   ParMesh &pmesh = *pfes.GetParMesh();
+   const Array<int> &external_ldofs = P.GetExternalLDofs();
+   Array<bool> ext_marker(P.Height());
+   ext_marker = false;
+   for (int ldof : external_ldofs) { ext_marker[ldof] = true; }
+   auto HasExternalDofs = [&](const Array<int> &vdofs)
+   {
+      for (int vdof : vdofs)
+      {
+         if (ext_marker[vdof >= 0 ? vdof : -1-vdof]) { return true; }
+      }
+      return false;
+   };
+
+   Array<int> vdofs;
+   DofTransformation doftrans;
+   DenseMatrix elmat, elemmat;
+
+   Array<BilinearFormIntegrator*> &dbfi = *a.GetDBFI();
+   Array<Array<int>*> &dbfi_marker = *a.GetDBFI_Marker();
+   for (int i = 0; i < pfes.GetNE(); i++)
+   {
+      pfes.GetElementVDofs(i, vdofs, doftrans);
+      if (!HasExternalDofs(vdofs)) { continue; }
+      num_bdr_elems++;
+
+      const int elem_attr = pmesh.GetAttribute(i);
+      ElementTransformation *eltrans = pfes.GetElementTransformation(i);
+      elmat.SetSize(0);
+      for (int k = 0; k < dbfi.Size(); k++)
+      {
+         if (dbfi_marker[k] && (*dbfi_marker[k])[elem_attr-1] == 0)
+         {
+            continue;
+         }
+         dbfi[k]->AssembleElementMatrix(*pfes.GetFE(i), *eltrans, elemmat);
+         if (elmat.Size() == 0) { elmat = elemmat; }
+         else { elmat += elemmat; }
+      }
+      if (elmat.Size() == 0) { continue; }
+      doftrans.TransformDual(elmat);
+      AddExternalColumns(vdofs, elmat, ext_marker);
+   }
+
+   Array<BilinearFormIntegrator*> &bbfi = *a.GetBBFI();
+   Array<Array<int>*> &bbfi_marker = *a.GetBBFI_Marker();
+   for (int i = 0; bbfi.Size() && i < pfes.GetNBE(); i++)
+   {
+      pfes.GetBdrElementVDofs(i, vdofs, doftrans);
+      if (!HasExternalDofs(vdofs)) { continue; }
+
+      const int bdr_attr = pmesh.GetBdrAttribute(i);
+      ElementTransformation *eltrans = pfes.GetBdrElementTransformation(i);
+      elmat.SetSize(0);
+      for (int k = 0; k < bbfi.Size(); k++)
+      {
+         if (bbfi_marker[k] && (*bbfi_marker[k])[bdr_attr-1] == 0)
+         {
+            continue;
+         }
+         bbfi[k]->AssembleElementMatrix(*pfes.GetBE(i), *eltrans, elemmat);
+         if (elmat.Size() == 0) { elmat = elemmat; }
+         else { elmat += elemmat; }
+      }
+      if (elmat.Size() == 0) { continue; }
+      doftrans.TransformDual(elmat);
+      AddExternalColumns(vdofs, elmat, ext_marker);
+   }
+   A_ext.Finalize();
+
+   xL.SetSize(P.Height());
+   yL.SetSize(P.Height());
+   xL.UseDevice(true);
+   yL.UseDevice(true);
+}
+
+void ParOverlapOperator::AddExternalColumns(const Array<int> &vdofs,
+                                            const DenseMatrix &elmat,
+                                            const Array<bool> &ext_marker)
+{
+   for (int jj = 0; jj < vdofs.Size(); jj++)
+   {
+      const int j = vdofs[jj] >= 0 ? vdofs[jj] : -1-vdofs[jj];
+      if (!ext_marker[j]) { continue; }
+      const real_t sj = vdofs[jj] >= 0 ? 1.0 : -1.0;
+      for (int ii = 0; ii < vdofs.Size(); ii++)
+      {
+         const int i = vdofs[ii] >= 0 ? vdofs[ii] : -1-vdofs[ii];
+         const real_t si = vdofs[ii] >= 0 ? 1.0 : -1.0;
+         const real_t val = si*sj*elmat(ii, jj);
+         if (val != 0.0) { A_ext.Add(i, j, val); }
+      }
+   }
+}
+
+void ParOverlapOperator::Mult(const Vector &x, Vector &y) const
+{
+   // Post the exchange, apply A with the external dofs set to zero, then add
+   // the contribution of the external dofs after they are received.
+   P.MultBegin(x, xL);
+   A.Mult(xL, yL);
+   P.MultEnd(xL);
+   A_ext.AddMult(xL, yL);
+   P.MultTranspose(yL, y);
+}
+
+void ParOverlapOperator::MultTranspose(const Vector &x, Vector &y) const
+{
+   P.Mult(x, xL);
+   A.MultTranspose(xL, yL);
+   P.MultTranspose(yL, y);
 }
 
 void ParMixedBilinearForm::pAllocMat()
@@ -739,6 +1073,8 @@ void ParMixedBilinearForm::AssembleSharedFaces(int skip_zeros)
 
 void ParMixedBilinearForm::Assemble(int skip_zeros)
 {
+   // Before allocating the matrix below
+   CheckFullAssemblySupport();
    if (interior_face_integs.Size())
    {
       trial_pfes->ExchangeFaceNbrData();
@@ -896,7 +1232,9 @@ void ParMixedBilinearForm::FormRectangularSystemMatrix(
    const Array<int> &test_tdof_list,
    OperatorHandle &A)
 {
-   if (ext)
+   // With full assembly, 'mat' is computed by the extension, see
+   // MixedBilinearForm::FormRectangularSystemMatrix()
+   if (ext && assembly != AssemblyLevel::FULL)
    {
       ext->FormRectangularSystemOperator(trial_tdof_list, test_tdof_list, A);
       return;
@@ -924,7 +1262,7 @@ void ParMixedBilinearForm::FormRectangularLinearSystem(
    Vector &b, OperatorHandle &A, Vector &X,
    Vector &B)
 {
-   if (ext)
+   if (ext && assembly != AssemblyLevel::FULL)
    {
       ext->FormRectangularLinearSystem(trial_tdof_list, test_tdof_list,
                                        x, b, A, X, B);
@@ -986,6 +1324,11 @@ void ParDiscreteLinearOperator::ParallelAssemble(OperatorHandle &A)
 
 void ParDiscreteLinearOperator::FormRectangularSystemMatrix(OperatorHandle &A)
 {
+   if (ext && assembly == AssemblyLevel::FULL)
+   {
+      A.Reset(ParallelAssemble());
+      return;
+   }
    if (ext)
    {
       Array<int> empty;
@@ -28,6 +28,7 @@ namespace mfem
 class ParBilinearForm : public BilinearForm
 {
    friend FABilinearFormExtension;
+   friend class ParOverlapOperator;
 protected:
    ParFiniteElementSpace *pfes; ///< Points to the same object as #fes
 
@@ -38,11 +39,34 @@ protected:
 
    bool keep_nbr_block;
 
+   /// See EnableCommunicationOverlap().
+   bool overlap_comm = false;
+
+   /** @brief Pairs (k, ke) as in #elim_map for the off-diagonal (offd) parts
+       of #p_mat and #p_mat_e. Used with values-only reassembly. */
+   Array<int> p_elim_offd_map;
+
    // Allocate mat - called when (mat == NULL && fbfi.Size() > 0)
    void pAllocMat();
 
+   /** @brief Build #elim_map, #elim_diag_map, and #p_elim_offd_map from #p_mat
+       and #p_mat_e, after eliminating @a ess_tdof_list. */
+   void BuildParallelEliminationMap(const Array<int> &ess_tdof_list);
+
+   /** @brief Assemble #mat into the existing #p_mat and perform the essential
+       BC elimination into the existing #p_mat_e, see
+       UseValuesOnlyReassembly(). */
+   /** If the sparsity of the new parallel matrix or the essential true dofs
+       differ from the ones of #p_mat, the parallel matrix is replaced and the
+       elimination is performed from scratch. */
+   void ParallelReassemble(const Array<int> &ess_tdof_list);
+
    void AssembleSharedFaces(int skip_zeros = 1);
 
+   /** @brief Return true if the system operator is a ParOverlapOperator, see
+       EnableCommunicationOverlap(). */
+   bool UseCommunicationOverlap() const;
+
 private:
    /// Copy construction is not supported; body is undefined.
    ParBilinearForm(const ParBilinearForm &);
@@ -76,6 +100,18 @@ public:
        those rows. Must be called before the first Assemble() call. */
    void KeepNbrBlock(bool knb = true) { keep_nbr_block = knb; }
 
+   /** @brief Overlap the exchange of the shared dofs with the element
+       computations in the operators returned by FormSystemMatrix() and
+       FormLinearSystem(), see ParOverlapOperator. */
+   /** Applies to AssemblyLevel::PARTIAL and AssemblyLevel::ELEMENT, without
+       hybridization, when the prolongation of the space is a
+       ConformingProlongationOperator, i.e. on conforming meshes with more than
+       one processor. Otherwise, the option is ignored; in particular, with
+       AssemblyLevel::FULL the system matrix remains a HypreParMatrix. Interior
+       and boundary face integrators are not supported. */
+   void EnableCommunicationOverlap(bool enable = true)
+   { overlap_comm = enable; }
+
    /** @brief Set the operator type id for the parallel matrix/operator when
        using AssemblyLevel::LEGACY. */
    /** If using static condensation or hybridization, call this method *after*
@@ -284,6 +320,52 @@ public:
    virtual ~ParBilinearForm() { }
 };
 
+/** @brief The operator P^t A P of a ParBilinearForm with an assembly level
+    other than AssemblyLevel::LEGACY, overlapping the exchange of the shared
+    dofs in the prolongation P with the application of the local operator A.
+
+    The elements are split at construction into the interior elements and the
+    rank-boundary elements, which contain dofs owned by other processors
+    (external dofs). The product P x is started with the external entries set
+    to zero, and A is applied while the messages are in flight, which gives
+    the exact result on the interior elements. When the exchange is complete,
+    the contribution of the external dofs is added with a sparse matrix
+    assembled from the element matrices of the rank-boundary elements,
+    restricted to the columns of the external dofs.
+
+    The result equals the one of the standard operator when the element
+    matrices of the integrators match their partial assembly, e.g. when both
+    use the same quadrature rules. See
+    ParBilinearForm::EnableCommunicationOverlap(). */
+class ParOverlapOperator : public Operator
+{
+protected:
+   const Operator &A; ///< The local operator, not owned
+   const ConformingProlongationOperator &P;
+   /// Columns of A on the external dofs, from the rank-boundary elements
+   SparseMatrix A_ext;
+   int num_bdr_elems;
+   mutable Vector xL, yL;
+
+   /// Add the external columns of @a elmat with dofs @a vdofs to #A_ext.
+   void AddExternalColumns(const Array<int> &vdofs, const DenseMatrix &elmat,
+                           const Array<bool> &ext_marker);
+
+public:
+   /** @brief Construct the operator for the assembled form @a a, which must
+       use an assembly level other than AssemblyLevel::LEGACY and a space
+       whose prolongation is a ConformingProlongationOperator. */
+   ParOverlapOperator(ParBilinearForm &a);
+
+   /// Return the number of elements containing external dofs.
+   int GetNumRankBoundaryElements() const { return num_bdr_elems; }
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// The transpose is applied without overlap.
+   void MultTranspose(const Vector &x, Vector &y) const override;
+};
+
 /// Class for parallel bilinear form using different test and trial FE spaces.
 class ParMixedBilinearForm : public MixedBilinearForm
 {
@@ -5197,6 +5197,13 @@ ConformingProlongationOperator::ConformingProlongationOperator(
 }
 
 void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void ConformingProlongationOperator::MultBegin(const Vector &x,
+                                               Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Width(), "");
    MFEM_ASSERT(y.Size() == Height(), "");
@@ -5206,11 +5213,7 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
    const int m = external_ldofs.Size();
 
    const int in_layout = 2; // 2 - input is ltdofs array
-   if (local)
-   {
-      y = 0.0;
-   }
-   else
+   if (!local)
    {
       gc.BcastBegin(const_cast<real_t*>(xdata), in_layout);
    }
@@ -5220,14 +5223,18 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
    {
       const int end = external_ldofs[i];
       if (end > j) { std::copy(xdata+j-i, xdata+end-i, ydata+j); }
+      ydata[end] = 0.0;
       j = end+1;
    }
    if (Width() > (j-m)) { std::copy(xdata+j-m, xdata+Width(), ydata+j); }
+}
 
+void ConformingProlongationOperator::MultEnd(Vector &y) const
+{
    const int out_layout = 0; // 0 - output is ldofs array
    if (!local)
    {
-      gc.BcastEnd(ydata, out_layout);
+      gc.BcastEnd(y.HostReadWrite(), out_layout);
    }
 }
 
@@ -5265,7 +5272,8 @@ void ConformingProlongationOperator::MultTranspose(
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
    const GroupCommunicator &gc_, const SparseMatrix *R, bool local_)
    : ConformingProlongationOperator(R->Width(), gc_, local_),
-     mpi_gpu_aware(Device::GetGPUAwareMPI())
+     mpi_gpu_aware(Device::GetGPUAwareMPI()),
+     num_bcast_requests(0)
 {
    MFEM_ASSERT(R->Finalized(), "");
    const int tdofs = R->Height();
@@ -5397,11 +5405,40 @@ void DeviceConformingProlongationOperator::BcastEndCopy(
    SetSubVector(ext_ldof, ext_buf, y);
 }
 
-void DeviceConformingProlongationOperator::Mult(const Vector &x,
-                                                Vector &y) const
+void DeviceConformingProlongationOperator::BcastPost(const Vector &x) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    int req_counter = 0;
+   BcastBeginCopy(x); // copy to 'shr_buf'
+   for (int nbr = 1; nbr < gtopo.GetNumNeighbors(); nbr++)
+   {
+      const int send_offset = shr_buf_offsets[nbr];
+      const int send_size = shr_buf_offsets[nbr+1] - send_offset;
+      if (send_size > 0)
+      {
+         auto send_buf = mpi_gpu_aware ? shr_buf.Read() : shr_buf.HostRead();
+         MPI_Isend(send_buf + send_offset, send_size,
+                   MPITypeMap<real_t>::mpi_type, gtopo.GetNeighborRank(nbr),
+                   41822,
+                   gtopo.GetComm(), &requests[req_counter++]);
+      }
+      const int recv_offset = ext_buf_offsets[nbr];
+      const int recv_size = ext_buf_offsets[nbr+1] - recv_offset;
+      if (recv_size > 0)
+      {
+         auto recv_buf = mpi_gpu_aware ? ext_buf.Write() : ext_buf.HostWrite();
+         MPI_Irecv(recv_buf + recv_offset, recv_size,
+                   MPITypeMap<real_t>::mpi_type, gtopo.GetNeighborRank(nbr),
+                   41822,
+                   gtopo.GetComm(), &requests[req_counter++]);
+      }
+   }
+   num_bcast_requests = req_counter;
+}
+
+void DeviceConformingProlongationOperator::Mult(const Vector &x,
+                                                Vector &y) const
+{
    // Make sure 'y' is marked as valid on device and for use on device.
    // This ensures that there is no unnecessary host to device copy when the
    // input 'y' is valid on host (in 'y.SetSubVector(ext_ldof, 0.0)' when local
@@ -5414,33 +5451,26 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
    }
    else
    {
-      BcastBeginCopy(x); // copy to 'shr_buf'
-      for (int nbr = 1; nbr < gtopo.GetNumNeighbors(); nbr++)
-      {
-         const int send_offset = shr_buf_offsets[nbr];
-         const int send_size = shr_buf_offsets[nbr+1] - send_offset;
-         if (send_size > 0)
-         {
-            auto send_buf = mpi_gpu_aware ? shr_buf.Read() : shr_buf.HostRead();
-            MPI_Isend(send_buf + send_offset, send_size, MPITypeMap<real_t>::mpi_type,
-                      gtopo.GetNeighborRank(nbr), 41822,
-                      gtopo.GetComm(), &requests[req_counter++]);
-         }
-         const int recv_offset = ext_buf_offsets[nbr];
-         const int recv_size = ext_buf_offsets[nbr+1] - recv_offset;
-         if (recv_size > 0)
-         {
-            auto recv_buf = mpi_gpu_aware ? ext_buf.Write() : ext_buf.HostWrite();
-            MPI_Irecv(recv_buf + recv_offset, recv_size, MPITypeMap<real_t>::mpi_type,
-                      gtopo.GetNeighborRank(nbr), 41822,
-                      gtopo.GetComm(), &requests[req_counter++]);
-         }
-      }
+      BcastPost(x);
    }
    BcastLocalCopy(x, y);
+   MultEnd(y);
+}
+
+void DeviceConformingProlongationOperator::MultBegin(const Vector &x,
+                                                     Vector &y) const
+{
+   y.Write();
+   y.SetSubVector(ext_ldof, 0.0);
+   if (!local) { BcastPost(x); }
+   BcastLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultEnd(Vector &y) const
+{
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_bcast_requests, requests, MPI_STATUSES_IGNORE);
       BcastEndCopy(y); // copy from 'ext_buf'
    }
 }
@@ -581,8 +581,23 @@ public:
 
    const GroupCommunicator &GetGroupCommunicator() const;
 
+   /// Return the sorted list of the ldofs owned by other processors.
+   const Array<int> &GetExternalLDofs() const { return external_ldofs; }
+
    void Mult(const Vector &x, Vector &y) const override;
 
+   /** @brief Start the computation of y = P x: set the owned entries of @a y,
+       set the external entries to zero and post the exchange of the shared
+       dofs. */
+   /** The computation must be completed with MultEnd() before any other
+       operation with this object. Until then, @a x and @a y can be read, e.g.
+       to apply an operator to @a y with its external entries set to zero. */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /** @brief Finish the computation of y = P x started with MultBegin(),
+       setting the external entries of @a y. */
+   virtual void MultEnd(Vector &y) const;
+
    void AbsMult(const Vector &x, Vector &y) const override
    { Mult(x,y); }
 
@@ -604,6 +619,11 @@ protected:
    Array<int> ltdof_ldof, unq_ltdof;
    Array<int> unq_shr_i, unq_shr_j;
    MPI_Request *requests;
+   mutable int num_bcast_requests;
+
+   // Copy the shared ltdofs of 'src' to 'shr_buf' and post the sends and the
+   // receives of the broadcast, setting num_bcast_requests.
+   void BcastPost(const Vector &src) const;
 
    // Kernel: copy ltdofs from 'src' to 'shr_buf' - prepare for send.
    //         shr_buf[i] = src[shr_ltdof[i]]
@@ -640,6 +660,10 @@ public:
 
    void Mult(const Vector &x, Vector &y) const override;
 
+   void MultBegin(const Vector &x, Vector &y) const override;
+
+   void MultEnd(Vector &y) const override;
+
    void AbsMult(const Vector &x, Vector &y) const override
    { Mult(x,y); }
 
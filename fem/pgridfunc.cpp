@@ -515,12 +515,13 @@ void ParGridFunction::GetDerivative(int comp, int der_comp,
    gcomm.Bcast(overlap);
 
    // Accumulate for all dofs.
-   gcomm.Reduce<real_t>(der.HostReadWrite(), GroupCommunicator::Sum);
-   gcomm.Bcast<real_t>(der.HostReadWrite());
+   gcomm.Reduce(der, GroupCommunicator::Sum);
+   gcomm.Bcast(der);
 
+   real_t *d_der = der.HostReadWrite();
    for (int i = 0; i < overlap.Size(); i++)
    {
-      der(i) /= overlap[i];
+      d_der[i] /= overlap[i];
    }
 }
 
@@ -818,17 +819,18 @@ void ParGridFunction::ProjectBdrCoefficient(
    GroupCommunicator &gcomm = pfes->GroupComm();
    gcomm.Reduce<int>(values_counter.HostReadWrite(), GroupCommunicator::Sum);
    // Accumulate the values globally.
-   gcomm.Reduce<real_t>(values.HostReadWrite(), GroupCommunicator::Sum);
+   gcomm.Reduce(values, GroupCommunicator::Sum);
 
+   real_t *d_this = HostReadWrite();
    for (int i = 0; i < values.Size(); i++)
    {
       if (values_counter[i])
       {
-         (*this)(i) = values(i)/values_counter[i];
+         d_this[i] = values(i)/values_counter[i];
       }
    }
    // Broadcast values to other processors to have a consistent GridFunction
-   gcomm.Bcast<real_t>((*this).HostReadWrite());
+   gcomm.Bcast(*this);
 
 #ifdef MFEM_DEBUG
    Array<int> ess_vdofs_marker;
@@ -874,17 +876,18 @@ void ParGridFunction::ProjectBdrCoefficientTangent(VectorCoefficient &vcoeff,
    GroupCommunicator &gcomm = pfes->GroupComm();
    gcomm.Reduce<int>(values_counter.HostReadWrite(), GroupCommunicator::Sum);
    // Accumulate the values globally.
-   gcomm.Reduce<real_t>(values.HostReadWrite(), GroupCommunicator::Sum);
+   gcomm.Reduce(values, GroupCommunicator::Sum);
 
+   real_t *d_this = HostReadWrite();
    for (int i = 0; i < values.Size(); i++)
    {
       if (values_counter[i])
       {
-         (*this)(i) = values(i)/values_counter[i];
+         d_this[i] = values(i)/values_counter[i];
       }
    }
    // Broadcast values to other processors to have a consistent GridFunction
-   gcomm.Bcast<real_t>((*this).HostReadWrite());
+   gcomm.Bcast(*this);
 
 #ifdef MFEM_DEBUG
    Array<int> ess_vdofs_marker;
@@ -1402,16 +1405,17 @@ void ParGridFunction::ComputeFlux(
    SumFluxAndCount(blfi, flux, count, wcoef, subdomain);
 
    // Accumulate flux and counts in parallel
-   ffes->GroupComm().Reduce<real_t>(flux.HostReadWrite(), GroupCommunicator::Sum);
-   ffes->GroupComm().Bcast<real_t>(flux.HostReadWrite());
+   ffes->GroupComm().Reduce(flux, GroupCommunicator::Sum);
+   ffes->GroupComm().Bcast(flux);
 
    ffes->GroupComm().Reduce<int>(count.HostReadWrite(), GroupCommunicator::Sum);
    ffes->GroupComm().Bcast<int>(count.HostReadWrite());
 
    // complete averaging
+   real_t *d_flux = flux.HostReadWrite();
    for (int i = 0; i < count.Size(); i++)
    {
-      if (count[i] != 0) { flux(i) /= count[i]; }
+      if (count[i] != 0) { d_flux[i] /= count[i]; }
    }
 
    if (ffes->Nonconforming())
@@ -12,6 +12,16 @@
 #include "binaryio.hpp"
 #include "error.hpp"
 
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace mfem
 {
 namespace bin_io
@@ -102,5 +112,142 @@ void DecodeBase64(const char *src, size_t len, std::vector<char> &buf)
 
 size_t NumBase64Chars(size_t nbytes) { return ((4*nbytes/3) + 3) & ~3; }
 
+MemoryStreamBuf::MemoryStreamBuf(const char *data, size_t size)
+{
+   char *begin = const_cast<char*>(data); // the buffer is only read
+   setg(begin, begin, begin + size);
+}
+
+MemoryStreamBuf::pos_type MemoryStreamBuf::seekoff(
+   off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+   if (!(which & std::ios_base::in)) { return pos_type(off_type(-1)); }
+   char *p = (dir == std::ios_base::beg) ? eback() :
+             (dir == std::ios_base::cur) ? gptr() : egptr();
+   if (off < eback() - p || off > egptr() - p) { return pos_type(off_type(-1)); }
+   setg(eback(), p + off, egptr());
+   return pos_type(gptr() - eback());
+}
+
+MemoryStreamBuf::pos_type MemoryStreamBuf::seekpos(
+   pos_type pos, std::ios_base::openmode which)
+{
+   return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+// The byte order mark of the binary formats
+static const uint32_t byte_order_mark = 0x01020304;
+
+BinaryWriter::BinaryWriter(std::ostream &os_) : os(os_)
+{
+   const std::streamoff p = os.tellp();
+   pos = (p >= 0) ? int64_t(p) : 0;
+}
+
+void BinaryWriter::WriteHeader()
+{
+   Write(byte_order_mark);
+   Write(uint8_t(sizeof(int)));
+   Write(uint8_t(sizeof(real_t)));
+   Write(uint16_t(0));
+}
+
+void BinaryWriter::WriteString(const std::string &str)
+{
+   Write(uint64_t(str.size()));
+   os.write(str.data(), str.size());
+   pos += str.size();
+}
+
+BinaryReader::BinaryReader(std::istream &is_)
+   : is(is_), mem(dynamic_cast<MemoryStreamBuf*>(is_.rdbuf())) { }
+
+void BinaryReader::ReadHeader()
+{
+   uint32_t bom;
+   ReadRaw(&bom, 1);
+   if (bom != byte_order_mark)
+   {
+      SwapBytes(&bom, 1);
+      MFEM_VERIFY(bom == byte_order_mark, "invalid binary data");
+      swap = true;
+   }
+   const int int_size = Read<uint8_t>();
+   real_size = Read<uint8_t>();
+   Read<uint16_t>(); // reserved
+   MFEM_VERIFY(int_size == sizeof(int32_t), "unsupported int size in binary "
+               "data: " << int_size);
+   MFEM_VERIFY(real_size == sizeof(float) || real_size == sizeof(double),
+               "unsupported floating point size in binary data: " << real_size);
+}
+
+void BinaryReader::SkipPadding()
+{
+   const uint8_t npad = Read<uint8_t>();
+   MFEM_VERIFY(npad < 8, "invalid binary data");
+   is.ignore(npad);
+}
+
+std::string BinaryReader::ReadString()
+{
+   const uint64_t n = Read<uint64_t>();
+   std::string str(n, '\0');
+   is.read(&str[0], n);
+   MFEM_VERIFY(is, "unexpected end of binary data");
+   return str;
+}
+
 } // namespace mfem::bin_io
+
+mapped_ifstream::mapped_ifstream(const std::string &filename)
+   : std::istream(nullptr)
+{
+   const char *begin = nullptr;
+#ifndef _WIN32
+   const int fd = ::open(filename.c_str(), O_RDONLY);
+   struct stat st;
+   if (fd >= 0 && ::fstat(fd, &st) == 0 && st.st_size > 0)
+   {
+      // Private writable mapping, so objects using the data in place can
+      // modify it without changing the file
+      void *p = ::mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED)
+      {
+         addr = p;
+         length = size_t(st.st_size);
+         begin = static_cast<const char*>(p);
+      }
+   }
+   if (fd >= 0) { ::close(fd); }
+#endif
+   if (!addr)
+   {
+      std::ifstream ifs(filename, std::ios::binary);
+      if (ifs)
+      {
+         data.assign(std::istreambuf_iterator<char>(ifs),
+                     std::istreambuf_iterator<char>());
+         length = data.size();
+         begin = data.data();
+      }
+      else
+      {
+         setstate(std::ios::failbit);
+      }
+   }
+   buf = new bin_io::MemoryStreamBuf(begin, length);
+   rdbuf(buf);
+   if (!begin) { setstate(std::ios::failbit); }
+}
+
+mapped_ifstream::~mapped_ifstream()
+{
+   rdbuf(nullptr);
+   delete buf;
+#ifndef _WIN32
+   if (addr) { ::munmap(addr, length); }
+#endif
+}
+
 } // namespace mfem
@@ -13,8 +13,13 @@
 #define MFEM_BINARYIO
 
 #include "../config/config.hpp"
+#include "error.hpp"
 
+#include <cstdint>
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace mfem
@@ -73,8 +78,193 @@ void DecodeBase64(const char *src, size_t len, std::vector<char> &buf);
 /// This is equal to 4*nbytes/3, rounded up to the nearest multiple of 4.
 size_t NumBase64Chars(size_t nbytes);
 
+/// @brief Stream buffer reading from a contiguous region of memory.
+///
+/// The binary readers use the data of such a stream in place when possible,
+/// see BinaryReader::MapArray() and mapped_ifstream.
+class MemoryStreamBuf : public std::streambuf
+{
+public:
+   MemoryStreamBuf(const char *data, size_t size);
+
+   /// Return a pointer to the current read position.
+   const char *Current() const { return gptr(); }
+
+   /// Return the number of bytes left to read.
+   size_t Remaining() const { return size_t(egptr() - gptr()); }
+
+protected:
+   pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                    std::ios_base::openmode which) override;
+   pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+/** @brief Writer of the native binary formats of MFEM, e.g. the one of
+    Mesh::PrintBinary().
+
+    The data starts with a header recording the byte order and the sizes of
+    int and real_t. Arrays are aligned to 8 bytes, relative to the initial
+    position of the stream (or to the start of the writer if the position is
+    not available), so they can be used in place from a memory-mapped file. */
+class BinaryWriter
+{
+   std::ostream &os;
+   int64_t pos;
+
+public:
+   explicit BinaryWriter(std::ostream &os);
+
+   /// Write the byte order mark and the sizes of int and real_t.
+   void WriteHeader();
+
+   /// Write a single value.
+   template <typename T>
+   void Write(T value) { write(os, value); pos += sizeof(T); }
+
+   /// Write the @a n entries of @a data, aligned to 8 bytes.
+   template <typename T>
+   void WriteArray(const T *data, size_t n)
+   {
+      static_assert(std::is_arithmetic<T>::value, "invalid array type");
+      const uint8_t npad = uint8_t((8 - (pos + 1) % 8) % 8);
+      const char zeros[8] = { };
+      Write(npad);
+      os.write(zeros, npad);
+      os.write(reinterpret_cast<const char*>(data), n*sizeof(T));
+      pos += npad + n*sizeof(T);
+   }
+
+   /// Write the length and the characters of @a str.
+   void WriteString(const std::string &str);
+};
+
+/** @brief Reader of the data written by BinaryWriter.
+
+    Data written on a platform with a different byte order or floating point
+    width is converted. If the stream reads from memory (see MemoryStreamBuf
+    and mapped_ifstream), arrays in the native format can be used in place,
+    see MapArray(). */
+class BinaryReader
+{
+   std::istream &is;
+   MemoryStreamBuf *mem;
+   bool swap = false;
+   int real_size = sizeof(real_t);
+
+   template <typename T>
+   static void SwapBytes(T *data, size_t n)
+   {
+      for (size_t i = 0; i < n; i++)
+      {
+         char *b = reinterpret_cast<char*>(data + i);
+         std::reverse(b, b + sizeof(T));
+      }
+   }
+
+   template <typename T>
+   void ReadRaw(T *data, size_t n)
+   {
+      is.read(reinterpret_cast<char*>(data), n*sizeof(T));
+      MFEM_VERIFY(is, "unexpected end of binary data");
+      if (swap) { SwapBytes(data, n); }
+   }
+
+   /// Size in the data of an entry of type @a T.
+   template <typename T>
+   size_t EntrySize() const
+   { return std::is_floating_point<T>::value ? real_size : sizeof(T); }
+
+   void SkipPadding();
+
+public:
+   explicit BinaryReader(std::istream &is);
+
+   /// Read and check the header written by BinaryWriter::WriteHeader().
+   void ReadHeader();
+
+   /// Read a single value.
+   template <typename T>
+   T Read()
+   {
+      T value;
+      ReadRaw(&value, 1);
+      return value;
+   }
+
+   /// Read an array of @a n entries, written by BinaryWriter::WriteArray().
+   template <typename T>
+   void ReadArray(T *data, size_t n)
+   {
+      static_assert(std::is_arithmetic<T>::value, "invalid array type");
+      SkipPadding();
+      if (EntrySize<T>() == sizeof(T)) { ReadRaw(data, n); return; }
+      if (real_size == sizeof(float))
+      {
+         std::vector<float> buf(n);
+         ReadRaw(buf.data(), n);
+         std::copy(buf.begin(), buf.end(), data);
+      }
+      else
+      {
+         std::vector<double> buf(n);
+         ReadRaw(buf.data(), n);
+         std::copy(buf.begin(), buf.end(), data);
+      }
+   }
+
+   /** @brief Return a pointer to the next array of @a n entries, and skip it,
+       if the data can be used in place: the stream reads from memory, the
+       data is in the native format and the array is properly aligned.
+       Otherwise, return nullptr and read nothing, and the array should be
+       read with ReadArray(). */
+   template <typename T>
+   const T *MapArray(size_t n)
+   {
+      if (!mem || swap || EntrySize<T>() != sizeof(T)) { return nullptr; }
+      if (mem->Remaining() < 1) { return nullptr; }
+      const size_t npad = uint8_t(*mem->Current());
+      if (mem->Remaining() < 1 + npad + n*sizeof(T)) { return nullptr; }
+      const char *data = mem->Current() + 1 + npad;
+      if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) { return nullptr; }
+      is.seekg(1 + npad + n*sizeof(T), std::ios_base::cur);
+      return reinterpret_cast<const T*>(data);
+   }
+
+   /// Read a string written by BinaryWriter::WriteString().
+   std::string ReadString();
+};
+
 } // namespace mfem::bin_io
 
+/** @brief Input stream reading a file through a memory mapping.
+
+    Objects read in the native binary formats from this stream, see e.g.
+    Mesh::PrintBinary() and GridFunction::SaveBinary(), use its data in place
+    when possible. For example, the vertex coordinates of a Mesh and the values
+    of a GridFunction are not copied but refer to the mapped file, so the
+    stream must outlive them. The mapping is private: modifications of the
+    data are not written to the file.
+
+    On platforms without mmap(), the file is read into memory. */
+class mapped_ifstream : public std::istream
+{
+   bin_io::MemoryStreamBuf *buf = nullptr;
+   void *addr = nullptr;
+   size_t length = 0;
+   std::vector<char> data;
+
+public:
+   explicit mapped_ifstream(const std::string &filename);
+
+   mapped_ifstream(const mapped_ifstream &) = delete;
+   mapped_ifstream &operator=(const mapped_ifstream &) = delete;
+
+   /// Return true if the file is memory-mapped.
+   bool IsMapped() const { return addr != nullptr; }
+
+   ~mapped_ifstream();
+};
+
 } // namespace mfem
 
 #endif
@@ -22,9 +22,12 @@
 #include "table.hpp"
 #include "sets.hpp"
 #include "communication.hpp"
+#include "binaryio.hpp"
 #include "text.hpp"
 #include "sort_pairs.hpp"
 #include "globals.hpp"
+#include "forall.hpp"
+#include "../linalg/vector.hpp"
 
 #ifdef MFEM_USE_STRUMPACK
 #include <StrumpackConfig.hpp> // STRUMPACK_USE_PTSCOTCH, etc.
@@ -329,6 +332,29 @@ void GroupTopology::Load(istream &in)
    Create(integer_sets, 823);
 }
 
+void GroupTopology::Save(bin_io::BinaryWriter &writer) const
+{
+   group_lproc.Save(writer);
+   for (const Array<int> *a : {&groupmaster_lproc, &lproc_proc, &group_mgroup})
+   {
+      writer.Write(int32_t(a->Size()));
+      writer.WriteArray(a->GetData(), a->Size());
+   }
+}
+
+void GroupTopology::Load(bin_io::BinaryReader &reader)
+{
+   // The data is used as is, so this must be the MPI rank that saved it
+   group_lproc.Load(reader);
+   for (Array<int> *a : {&groupmaster_lproc, &lproc_proc, &group_mgroup})
+   {
+      a->SetSize(reader.Read<int32_t>());
+      reader.ReadArray(a->GetData(), a->Size());
+   }
+   MFEM_VERIFY(lproc_proc.Size() > 0 && lproc_proc[0] == MyRank(),
+               "invalid group topology data");
+}
+
 void GroupTopology::Copy(GroupTopology& copy) const
 {
    copy.SetComm(MyComm);
@@ -375,6 +401,8 @@ GroupCommunicator::GroupCommunicator(const GroupTopology &gt, Mode m)
    num_requests = 0;
    request_marker = NULL;
    buf_offsets = NULL;
+   persistent = false;
+   dev_exchange = NULL;
 }
 
 void GroupCommunicator::Create(const Array<int> &ldof_group)
@@ -612,6 +640,290 @@ void GroupCommunicator::GetNeighborLDofTable(Table &nbr_ldof) const
    nbr_ldof.ShiftUpI();
 }
 
+void GroupCommunicator::UsePersistentRequests(bool use)
+{
+   MFEM_VERIFY(!use || mode == byNeighbor,
+               "persistent requests require the byNeighbor mode");
+   MFEM_VERIFY(comm_lock == 0, "object is in use");
+   if (!use)
+   {
+      FreePersistentRequests(bcast_preq);
+      FreePersistentRequests(reduce_preq);
+   }
+   persistent = use;
+}
+
+MPI_Request *GroupCommunicator::GetPersistentRequests(int op,
+                                                      MPI_Datatype type) const
+{
+   PersistentRequests &preq = (op == 0) ? bcast_preq : reduce_preq;
+   char *buf = group_buf.GetData();
+   if (preq.type == type && preq.buf == buf) { return preq.requests.data(); }
+
+   // The requests are bound to the buffer, so they are created again when
+   // the buffer is reallocated, e.g. for a larger data type.
+   FreePersistentRequests(preq);
+   int type_size;
+   MPI_Type_size(type, &type_size);
+   auto MessageSize = [&](const Table &nbr_groups, int nbr)
+   {
+      int size = 0;
+      const int *grp_list = nbr_groups.GetRow(nbr);
+      for (int i = 0; i < nbr_groups.RowSize(nbr); i++)
+      {
+         size += group_ldof.RowSize(grp_list[i]);
+      }
+      return size;
+   };
+
+   // Same messages and buffer layout as in BcastBegin() and ReduceBegin(). In
+   // the Reduce operation: send_groups <--> recv_groups
+   const Table &send_groups = (op == 0) ? nbr_send_groups : nbr_recv_groups;
+   const Table &recv_groups = (op == 0) ? nbr_recv_groups : nbr_send_groups;
+   const int tag = (op == 0) ? 40822 : 43822;
+   MPI_Request req;
+   for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+   {
+      if (send_groups.RowSize(nbr) > 0)
+      {
+         const int send_size = MessageSize(send_groups, nbr);
+         MPI_Send_init(buf, send_size, type, gtopo.GetNeighborRank(nbr), tag,
+                       gtopo.GetComm(), &req);
+         preq.requests.push_back(req);
+         buf += send_size*type_size;
+      }
+      if (recv_groups.RowSize(nbr) > 0)
+      {
+         const int recv_size = MessageSize(recv_groups, nbr);
+         MPI_Recv_init(buf, recv_size, type, gtopo.GetNeighborRank(nbr), tag,
+                       gtopo.GetComm(), &req);
+         preq.requests.push_back(req);
+         buf += recv_size*type_size;
+      }
+   }
+   preq.type = type;
+   preq.buf = group_buf.GetData();
+   return preq.requests.data();
+}
+
+void GroupCommunicator::FreePersistentRequests(PersistentRequests &preq) const
+{
+   if (!Mpi::IsFinalized())
+   {
+      for (MPI_Request &req : preq.requests) { MPI_Request_free(&req); }
+   }
+   preq.requests.clear();
+   preq.type = MPI_DATATYPE_NULL;
+   preq.buf = nullptr;
+}
+
+struct GroupCommunicator::DeviceExchange
+{
+   /// Offsets of the neighbors in the lists and buffers below (nbr 0 = me).
+   Array<int> own_offsets, nbr_offsets;
+   /** The ldofs in the groups of which this rank is the master, sent by Bcast
+       and received by Reduce, and the ldofs in the groups of the neighbors,
+       received by Bcast and sent by Reduce. */
+   Array<int> own_ldofs, nbr_ldofs;
+   /** The unique entries of #own_ldofs and, for each one, its positions in
+       #own_buf, in CSR format. Used by Reduce to avoid write conflicts. */
+   Array<int> unq_ldofs, unq_i, unq_j;
+   Vector own_buf, nbr_buf;
+};
+
+/** List, by neighbor, the ldofs in the groups of @a nbr_groups, in the order
+    of the messages of the byNeighbor mode. */
+static void GetNeighborLDofs(const Table &nbr_groups, const Table &group_ldof,
+                             Array<int> &offsets, Array<int> &ldofs)
+{
+   const int num_nbrs = nbr_groups.Size();
+   offsets.SetSize(num_nbrs + 1);
+   offsets[0] = offsets[1] = 0;
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      int size = 0;
+      const int *grp_list = nbr_groups.GetRow(nbr);
+      for (int i = 0; i < nbr_groups.RowSize(nbr); i++)
+      {
+         size += group_ldof.RowSize(grp_list[i]);
+      }
+      offsets[nbr+1] = offsets[nbr] + size;
+   }
+   ldofs.SetSize(offsets[num_nbrs]);
+   int k = 0;
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      const int *grp_list = nbr_groups.GetRow(nbr);
+      for (int i = 0; i < nbr_groups.RowSize(nbr); i++)
+      {
+         const int *gr_ldofs = group_ldof.GetRow(grp_list[i]);
+         for (int j = 0; j < group_ldof.RowSize(grp_list[i]); j++)
+         {
+            ldofs[k++] = gr_ldofs[j];
+         }
+      }
+   }
+}
+
+GroupCommunicator::DeviceExchange &GroupCommunicator::GetDeviceExchange()
+const
+{
+   if (dev_exchange) { return *dev_exchange; }
+
+   DeviceExchange &dx = *(dev_exchange = new DeviceExchange);
+   GetNeighborLDofs(nbr_send_groups, group_ldof, dx.own_offsets, dx.own_ldofs);
+   GetNeighborLDofs(nbr_recv_groups, group_ldof, dx.nbr_offsets, dx.nbr_ldofs);
+
+   // An ldof is received from all ranks sharing it, so Reduce accumulates the
+   // received values of each unique ldof in a single kernel thread
+   dx.unq_ldofs = dx.own_ldofs;
+   dx.unq_ldofs.Sort();
+   dx.unq_ldofs.Unique();
+   Table unq_to_buf;
+   unq_to_buf.MakeI(dx.unq_ldofs.Size());
+   for (int k = 0; k < dx.own_ldofs.Size(); k++)
+   {
+      unq_to_buf.AddAColumnInRow(dx.unq_ldofs.FindSorted(dx.own_ldofs[k]));
+   }
+   unq_to_buf.MakeJ();
+   for (int k = 0; k < dx.own_ldofs.Size(); k++)
+   {
+      unq_to_buf.AddConnection(dx.unq_ldofs.FindSorted(dx.own_ldofs[k]), k);
+   }
+   unq_to_buf.ShiftUpI();
+   dx.unq_i.SetSize(dx.unq_ldofs.Size() + 1);
+   dx.unq_i.CopyFrom(unq_to_buf.GetI());
+   dx.unq_j.SetSize(dx.own_ldofs.Size());
+   dx.unq_j.CopyFrom(unq_to_buf.GetJ());
+
+   dx.own_buf.SetSize(dx.own_ldofs.Size());
+   dx.nbr_buf.SetSize(dx.nbr_ldofs.Size());
+   return dx;
+}
+
+void GroupCommunicator::ExchangeDeviceBuffers(int op, bool use_dev) const
+{
+   DeviceExchange &dx = *dev_exchange;
+   const bool mpi_gpu_aware = use_dev && Device::GetGPUAwareMPI();
+   // If the packing kernel is executed asynchronously, we should wait for it
+   // to complete
+   if (mpi_gpu_aware) { MFEM_STREAM_SYNC; }
+
+   // Bcast: own_buf --> nbr_buf, Reduce: nbr_buf --> own_buf
+   Vector &send_buf = (op == 0) ? dx.own_buf : dx.nbr_buf;
+   Vector &recv_buf = (op == 0) ? dx.nbr_buf : dx.own_buf;
+   const Array<int> &send_offsets = (op == 0) ? dx.own_offsets : dx.nbr_offsets;
+   const Array<int> &recv_offsets = (op == 0) ? dx.nbr_offsets : dx.own_offsets;
+   const real_t *send_data = mpi_gpu_aware ? send_buf.Read() :
+                             send_buf.HostRead();
+   real_t *recv_data = mpi_gpu_aware ? recv_buf.Write() : recv_buf.HostWrite();
+   const int tag = (op == 0) ? 40822 : 43822;
+   int request_counter = 0;
+   for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+   {
+      const int send_size = send_offsets[nbr+1] - send_offsets[nbr];
+      if (send_size > 0)
+      {
+         MPI_Isend(send_data + send_offsets[nbr], send_size,
+                   MPITypeMap<real_t>::mpi_type, gtopo.GetNeighborRank(nbr),
+                   tag, gtopo.GetComm(), &requests[request_counter++]);
+      }
+      const int recv_size = recv_offsets[nbr+1] - recv_offsets[nbr];
+      if (recv_size > 0)
+      {
+         MPI_Irecv(recv_data + recv_offsets[nbr], recv_size,
+                   MPITypeMap<real_t>::mpi_type, gtopo.GetNeighborRank(nbr),
+                   tag, gtopo.GetComm(), &requests[request_counter++]);
+      }
+   }
+   MPI_Waitall(request_counter, requests, MPI_STATUSES_IGNORE);
+}
+
+void GroupCommunicator::Bcast(Vector &ldata) const
+{
+   MFEM_VERIFY(comm_lock == 0, "object is already in use");
+   if (group_buf_size == 0) { return; }
+   if (mode != byNeighbor)
+   {
+      Bcast<real_t>(ldata.HostReadWrite());
+      return;
+   }
+
+   DeviceExchange &dx = GetDeviceExchange();
+   const bool use_dev = ldata.UseDevice();
+
+   // own_buf[i] = ldata[own_ldofs[i]]
+   const int num_own = dx.own_ldofs.Size();
+   const auto own_ldofs = dx.own_ldofs.Read(use_dev);
+   const auto x = ldata.Read(use_dev);
+   auto own_buf = dx.own_buf.Write(use_dev);
+   mfem::forall_switch(use_dev, num_own, [=] MFEM_HOST_DEVICE (int i)
+   {
+      own_buf[i] = x[own_ldofs[i]];
+   });
+
+   ExchangeDeviceBuffers(0, use_dev);
+
+   // ldata[nbr_ldofs[i]] = nbr_buf[i], the ldofs are unique
+   const int num_nbr = dx.nbr_ldofs.Size();
+   const auto nbr_ldofs = dx.nbr_ldofs.Read(use_dev);
+   const auto nbr_buf = dx.nbr_buf.Read(use_dev);
+   auto y = ldata.ReadWrite(use_dev);
+   mfem::forall_switch(use_dev, num_nbr, [=] MFEM_HOST_DEVICE (int i)
+   {
+      y[nbr_ldofs[i]] = nbr_buf[i];
+   });
+}
+
+void GroupCommunicator::Reduce(Vector &ldata,
+                               void (*Op)(OpData<real_t>)) const
+{
+   MFEM_VERIFY(comm_lock == 0, "object is already in use");
+   if (group_buf_size == 0) { return; }
+   const int op = (Op == Sum<real_t>) ? 0 : (Op == Min<real_t>) ? 1 :
+                  (Op == Max<real_t>) ? 2 : -1;
+   if (mode != byNeighbor || op < 0)
+   {
+      Reduce<real_t>(ldata.HostReadWrite(), Op);
+      return;
+   }
+
+   DeviceExchange &dx = GetDeviceExchange();
+   const bool use_dev = ldata.UseDevice();
+
+   // nbr_buf[i] = ldata[nbr_ldofs[i]]
+   const int num_nbr = dx.nbr_ldofs.Size();
+   const auto nbr_ldofs = dx.nbr_ldofs.Read(use_dev);
+   const auto x = ldata.Read(use_dev);
+   auto nbr_buf = dx.nbr_buf.Write(use_dev);
+   mfem::forall_switch(use_dev, num_nbr, [=] MFEM_HOST_DEVICE (int i)
+   {
+      nbr_buf[i] = x[nbr_ldofs[i]];
+   });
+
+   ExchangeDeviceBuffers(1, use_dev);
+
+   // ldata[unq_ldofs[i]] = Op(ldata[unq_ldofs[i]], own_buf[unq_j[j]]) for
+   // unq_i[i] <= j < unq_i[i+1]
+   const int num_unq = dx.unq_ldofs.Size();
+   const auto unq_ldofs = dx.unq_ldofs.Read(use_dev);
+   const auto unq_i = dx.unq_i.Read(use_dev);
+   const auto unq_j = dx.unq_j.Read(use_dev);
+   const auto own_buf = dx.own_buf.Read(use_dev);
+   auto y = ldata.ReadWrite(use_dev);
+   mfem::forall_switch(use_dev, num_unq, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t val = y[unq_ldofs[i]];
+      for (int j = unq_i[i]; j < unq_i[i+1]; j++)
+      {
+         const real_t b = own_buf[unq_j[j]];
+         val = (op == 0) ? val + b :
+               (op == 1) ? (b < val ? b : val) : (b > val ? b : val);
+      }
+      y[unq_ldofs[i]] = val;
+   });
+}
+
 template <class T>
 T *GroupCommunicator::CopyGroupToBuffer(const T *ldata, T *buf, int group,
                                         int layout) const
@@ -811,13 +1123,16 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
                {
                   buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
                }
-               MPI_Isend(buf_start,
-                         buf - buf_start,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         40822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
+               if (!persistent)
+               {
+                  MPI_Isend(buf_start,
+                            buf - buf_start,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            40822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+               }
                request_marker[request_counter] = -1; // mark as send request
                request_counter++;
             }
@@ -835,13 +1150,16 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
                {
                   recv_size += group_ldof.RowSize(grp_list[i]);
                }
-               MPI_Irecv(buf,
-                         recv_size,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         40822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
+               if (!persistent)
+               {
+                  MPI_Irecv(buf,
+                            recv_size,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            40822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+               }
                request_marker[request_counter] = nbr;
                request_counter++;
                buf_offsets[nbr] = buf - (T*)group_buf.GetData();
@@ -849,6 +1167,11 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
             }
          }
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
+         if (persistent)
+         {
+            MPI_Startall(request_counter,
+                         GetPersistentRequests(0, MPITypeMap<T>::mpi_type));
+         }
          break;
       }
    }
@@ -892,9 +1215,11 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
+         MPI_Request *reqs = persistent ?
+                             bcast_preq.requests.data() : requests;
          // copy the received data from the buffer to ldata, as it arrives
          int idx;
-         while (MPI_Waitany(num_requests, requests, &idx, MPI_STATUS_IGNORE),
+         while (MPI_Waitany(num_requests, reqs, &idx, MPI_STATUS_IGNORE),
                 idx != MPI_UNDEFINED)
          {
             int nbr = request_marker[idx];
@@ -995,13 +1320,16 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
                   const int layout = 0; // ldata is an array on all ldofs
                   buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
                }
-               MPI_Isend(buf_start,
-                         buf - buf_start,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         43822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
+               if (!persistent)
+               {
+                  MPI_Isend(buf_start,
+                            buf - buf_start,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            43822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+               }
                request_marker[request_counter] = -1; // mark as send request
                request_counter++;
             }
@@ -1016,13 +1344,16 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
                {
                   recv_size += group_ldof.RowSize(grp_list[i]);
                }
-               MPI_Irecv(buf,
-                         recv_size,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         43822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
+               if (!persistent)
+               {
+                  MPI_Irecv(buf,
+                            recv_size,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            43822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+               }
                request_marker[request_counter] = nbr;
                request_counter++;
                buf_offsets[nbr] = buf - (T*)group_buf.GetData();
@@ -1030,6 +1361,11 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
             }
          }
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
+         if (persistent)
+         {
+            MPI_Startall(request_counter,
+                         GetPersistentRequests(1, MPITypeMap<T>::mpi_type));
+         }
          break;
       }
    }
@@ -1083,7 +1419,9 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
-         MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+         MPI_Waitall(num_requests,
+                     persistent ? reduce_preq.requests.data() : requests,
+                     MPI_STATUSES_IGNORE);
 
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
@@ -1304,6 +1642,9 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
 
 GroupCommunicator::~GroupCommunicator()
 {
+   FreePersistentRequests(bcast_preq);
+   FreePersistentRequests(reduce_preq);
+   delete dev_exchange;
    delete [] buf_offsets;
    delete [] request_marker;
    // delete [] statuses;
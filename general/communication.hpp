@@ -22,6 +22,7 @@
 #include "globals.hpp"
 #include <mpi.h>
 #include <cstdint>
+#include <vector>
 
 // can't directly use MPI_CXX_BOOL because Microsoft's MPI implementation
 // doesn't include MPI_CXX_BOOL. Fallback to MPI_C_BOOL if unavailable.
@@ -34,6 +35,8 @@
 namespace mfem
 {
 
+class Vector;
+
 /** @brief A simple singleton class that calls MPI_Init() at construction and
     MPI_Finalize() at destruction. It also provides easy access to
     MPI_COMM_WORLD's rank and size. */
@@ -218,6 +221,14 @@ public:
    /// Load the data from a stream.
    void Load(std::istream &in);
 
+   /** @brief Save the data in a binary stream, including the neighbor and
+       master data, so Load(bin_io::BinaryReader&) needs no communication. */
+   void Save(bin_io::BinaryWriter &writer) const;
+
+   /** @brief Load the data saved with Save(bin_io::BinaryWriter&) by the same
+       MPI rank. The communicator should be set with SetComm(). */
+   void Load(bin_io::BinaryReader &reader);
+
    /// Copy the internal data to the external 'copy'.
    void Copy(GroupTopology & copy) const;
 
@@ -256,6 +267,35 @@ protected:
    int *buf_offsets; // size = max(number of groups, number of neighbors)
    Table nbr_send_groups, nbr_recv_groups; // nbr 0 = me
 
+   /// Persistent requests of one operation, see UsePersistentRequests().
+   struct PersistentRequests
+   {
+      std::vector<MPI_Request> requests;
+      MPI_Datatype type = MPI_DATATYPE_NULL;
+      const char *buf = nullptr; ///< The buffer the requests are bound to
+   };
+   bool persistent;
+   mutable PersistentRequests bcast_preq, reduce_preq;
+
+   /** @brief Return the persistent requests of Bcast (@a op = 0) or Reduce
+       (@a op = 1) for the data @a type in the current #group_buf, creating
+       them if needed. */
+   MPI_Request *GetPersistentRequests(int op, MPI_Datatype type) const;
+
+   /// Free the persistent requests in @a preq.
+   void FreePersistentRequests(PersistentRequests &preq) const;
+
+   /// Index lists and buffers of the Vector Bcast() and Reduce().
+   struct DeviceExchange;
+   mutable DeviceExchange *dev_exchange;
+
+   /// Return the #dev_exchange data, creating it at the first call.
+   DeviceExchange &GetDeviceExchange() const;
+
+   /** @brief Exchange the buffers of #dev_exchange for the Vector Bcast()
+       (@a op = 0) or Reduce() (@a op = 1) and wait for the messages. */
+   void ExchangeDeviceBuffers(int op, bool use_dev) const;
+
 public:
    /// Construct a GroupCommunicator object.
    /** The object must be initialized before it can be used to perform any
@@ -285,6 +325,17 @@ public:
        data layout 2, see CopyGroupToBuffer() for layout descriptions. */
    void SetLTDofTable(const Array<int> &ldof_ltdof);
 
+   /** @brief Use persistent MPI requests (MPI_Send_init(), MPI_Recv_init())
+       for the Bcast and Reduce operations, started with MPI_Startall(). */
+   /** The communication pattern is fixed once the object is finalized, so the
+       requests are created at the first operation with a given data type and
+       reused by the following ones, which saves the cost of posting the
+       messages in every operation. Requires the byNeighbor mode. */
+   void UsePersistentRequests(bool use = true);
+
+   /// Return true if persistent MPI requests are used.
+   bool UsesPersistentRequests() const { return persistent; }
+
    /// Get a reference to the associated GroupTopology object
    const GroupTopology &GetGroupTopology() { return gtopo; }
 
@@ -369,6 +420,15 @@ public:
    template <class T> void Bcast(Array<T> &ldata) const
    { Bcast<T>((T *)ldata); }
 
+   /** @brief Broadcast within each group where the master is the root, for
+       the Vector @a ldata on all ldofs (layout 0). */
+   /** The shared entries are packed and unpacked with mfem::forall kernels,
+       on the device if @a ldata.UseDevice() is true. If
+       Device::GetGPUAwareMPI() is true, the device buffers are given directly
+       to MPI, otherwise each buffer is moved to the host with a single
+       transfer. In the byGroup mode, the data is moved to the host. */
+   void Bcast(Vector &ldata) const;
+
    /** @brief Begin reduction operation within each group where the master is
        the root. */
    /** The input data layout is an array on all ldofs, i.e. layout 0, see
@@ -408,6 +468,12 @@ public:
    template <class T> void Reduce(Array<T> &ldata, void (*Op)(OpData<T>)) const
    { Reduce<T>((T *)ldata, Op); }
 
+   /** @brief Reduce within each group where the master is the root, for the
+       Vector @a ldata on all ldofs (layout 0). */
+   /** The operations Sum, Min and Max are performed as described in
+       Bcast(Vector&) const, other operations are performed on the host. */
+   void Reduce(Vector &ldata, void (*Op)(OpData<real_t>)) const;
+
    /// Reduce operation Sum, instantiated for int and double
    template <class T> static void Sum(OpData<T>);
    /// Reduce operation Min, instantiated for int and double
@@ -105,6 +105,15 @@ Device::Device()
          // Device::UpdateMemoryTypeAndClass().
          device_mem_type = MemoryType::HOST_UMPIRE;
       }
+      else if (mem_backend == "pool")
+      {
+         mem_host_env = true;
+         host_mem_type = MemoryType::HOST_POOL;
+         // Note: device_mem_type will be set to MemoryType::DEVICE_POOL only
+         // when an actual device is configured -- this is done later in
+         // Device::UpdateMemoryTypeAndClass().
+         device_mem_type = MemoryType::HOST_POOL;
+      }
       else if (mem_backend == "debug")
       {
          mem_host_env = true;
@@ -386,6 +395,9 @@ void Device::UpdateMemoryTypeAndClass(const std::string &device_option)
                case MemoryType::HOST_DEBUG:
                   device_mem_type = MemoryType::DEVICE_DEBUG;
                   break;
+               case MemoryType::HOST_POOL:
+                  device_mem_type = MemoryType::DEVICE_POOL;
+                  break;
                default:
                   device_mem_type = MemoryType::DEVICE;
             }
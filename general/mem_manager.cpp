@@ -17,6 +17,9 @@
 #include <unordered_map>
 #include <algorithm> // std::max
 #include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
 
 // Uncomment to try _WIN32 platform
 //#define _WIN32
@@ -679,6 +682,192 @@ public:
 #endif // MFEM_USE_CUDA || MFEM_USE_HIP
 #endif // MFEM_USE_UMPIRE
 
+/// Caching pool of memory blocks, used by HOST_POOL and DEVICE_POOL
+/** The requested sizes are rounded up to one of four size classes per power
+    of two, with a minimum of 256 bytes, so the internal fragmentation is at
+    most 25%. Freed blocks are kept in per-class free lists and reused by later
+    allocations from the same class, up to a total cached size of cache_limit
+    bytes. */
+class MemoryPool
+{
+public:
+   typedef void *(*AllocFn)(size_t bytes);
+   typedef void (*DeallocFn)(void *ptr);
+
+private:
+   static constexpr int min_log2 = 8; // the smallest class has 256 bytes
+
+   AllocFn upstream_alloc;
+   DeallocFn upstream_dealloc;
+   std::mutex mtx;
+   std::vector<std::vector<void*>> free_blocks; // indexed by size class
+   std::unordered_map<void*, int> in_use; // block -> size class
+   size_t cache_limit;
+   MemoryPoolStats stats;
+
+   /// Return the size class of a block with at least @a bytes bytes.
+   static int SizeClass(size_t bytes)
+   {
+      if (bytes <= (size_t(1) << min_log2)) { return 0; }
+      // Find k such that 2^k < bytes <= 2^(k+1)
+      int k = min_log2;
+      while ((size_t(2) << k) < bytes) { k++; }
+      // Classes (5,6,7,8)*2^(k-2)
+      const size_t step = size_t(1) << (k - 2);
+      const int m = static_cast<int>((bytes + step - 1) / step);
+      return 1 + 4*(k - min_log2) + (m - 5);
+   }
+
+   /// Return the size in bytes of the blocks in the class @a c.
+   static size_t ClassBytes(int c)
+   {
+      if (c == 0) { return size_t(1) << min_log2; }
+      const int k = min_log2 + (c - 1)/4;
+      return size_t(5 + (c - 1)%4) << (k - 2);
+   }
+
+   void ReleaseUnlocked()
+   {
+      for (size_t c = 0; c < free_blocks.size(); c++)
+      {
+         for (void *ptr : free_blocks[c]) { upstream_dealloc(ptr); }
+         free_blocks[c].clear();
+      }
+      stats.bytes_cached = 0;
+   }
+
+public:
+   MemoryPool(AllocFn alloc, DeallocFn dealloc)
+      : upstream_alloc(alloc), upstream_dealloc(dealloc),
+        cache_limit(std::numeric_limits<size_t>::max()) { }
+
+   void *Alloc(size_t bytes)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      const int c = SizeClass(bytes);
+      const size_t c_bytes = ClassBytes(c);
+      if (free_blocks.size() <= size_t(c)) { free_blocks.resize(c+1); }
+      void *ptr;
+      stats.allocations++;
+      if (!free_blocks[c].empty())
+      {
+         ptr = free_blocks[c].back();
+         free_blocks[c].pop_back();
+         stats.bytes_cached -= c_bytes;
+         stats.hits++;
+      }
+      else
+      {
+         ptr = upstream_alloc(c_bytes);
+         if (ptr == nullptr)
+         {
+            // Return the cached blocks to the system and try again
+            ReleaseUnlocked();
+            ptr = upstream_alloc(c_bytes);
+            if (ptr == nullptr) { throw ::std::bad_alloc(); }
+         }
+      }
+      in_use.emplace(ptr, c);
+      stats.bytes_in_use += c_bytes;
+      stats.peak_bytes = std::max(stats.peak_bytes,
+                                  stats.bytes_in_use + stats.bytes_cached);
+      return ptr;
+   }
+
+   void Dealloc(void *ptr)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      auto it = in_use.find(ptr);
+      MFEM_VERIFY(it != in_use.end(),
+                  "the pointer " << ptr << " was not allocated by the pool");
+      const int c = it->second;
+      const size_t c_bytes = ClassBytes(c);
+      in_use.erase(it);
+      stats.deallocations++;
+      stats.bytes_in_use -= c_bytes;
+      if (stats.bytes_cached + c_bytes <= cache_limit)
+      {
+         free_blocks[c].push_back(ptr);
+         stats.bytes_cached += c_bytes;
+      }
+      else
+      {
+         upstream_dealloc(ptr);
+      }
+   }
+
+   void Release() { std::lock_guard<std::mutex> lock(mtx); ReleaseUnlocked(); }
+
+   void SetCacheLimit(size_t bytes)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      cache_limit = bytes;
+      // Free the largest cached blocks first
+      for (size_t c = free_blocks.size(); stats.bytes_cached > cache_limit; )
+      {
+         if (free_blocks[c-1].empty()) { c--; continue; }
+         upstream_dealloc(free_blocks[c-1].back());
+         free_blocks[c-1].pop_back();
+         stats.bytes_cached -= ClassBytes(int(c-1));
+      }
+   }
+
+   MemoryPoolStats GetStats()
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      return stats;
+   }
+
+   // Blocks still in use at this point are leaked, as with the other spaces.
+   ~MemoryPool() { ReleaseUnlocked(); }
+};
+
+static void *PoolHostAlloc(size_t bytes)
+{
+   void *ptr;
+   return (mfem_memalign(&ptr, 64, bytes) == 0) ? ptr : nullptr;
+}
+
+static void PoolHostDealloc(void *ptr) { mfem_aligned_free(ptr); }
+
+/// The pooled host memory space, with 64-byte aligned blocks
+class PoolHostMemorySpace : public HostMemorySpace
+{
+public:
+   MemoryPool pool;
+   PoolHostMemorySpace(): pool(PoolHostAlloc, PoolHostDealloc) { }
+   void Alloc(void **ptr, size_t bytes) override { *ptr = pool.Alloc(bytes); }
+   void Dealloc(void *ptr) override { pool.Dealloc(ptr); }
+};
+
+#if defined(MFEM_USE_CUDA)
+typedef CudaDeviceMemorySpace PoolDeviceMemorySpaceBase;
+static void *PoolDeviceAlloc(size_t bytes)
+{ void *ptr; CuMemAlloc(&ptr, bytes); return ptr; }
+static void PoolDeviceDealloc(void *ptr) { CuMemFree(ptr); }
+#elif defined(MFEM_USE_HIP)
+typedef HipDeviceMemorySpace PoolDeviceMemorySpaceBase;
+static void *PoolDeviceAlloc(size_t bytes)
+{ void *ptr; HipMemAlloc(&ptr, bytes); return ptr; }
+static void PoolDeviceDealloc(void *ptr) { HipMemFree(ptr); }
+#else
+// Without CUDA and HIP, the 'device' memory is host memory, as with the
+// std:: device memory space used with the 'debug' device
+typedef StdDeviceMemorySpace PoolDeviceMemorySpaceBase;
+static void *PoolDeviceAlloc(size_t bytes) { return std::malloc(bytes); }
+static void PoolDeviceDealloc(void *ptr) { std::free(ptr); }
+#endif
+
+/// The pooled device memory space
+class PoolDeviceMemorySpace : public PoolDeviceMemorySpaceBase
+{
+public:
+   MemoryPool pool;
+   PoolDeviceMemorySpace(): pool(PoolDeviceAlloc, PoolDeviceDealloc) { }
+   void Alloc(Memory &base) override { base.d_ptr = pool.Alloc(base.bytes); }
+   void Dealloc(Memory &base) override { pool.Dealloc(base.d_ptr); }
+};
+
 /// Memory space controller class
 class Ctrl
 {
@@ -707,6 +896,7 @@ public:
       // HOST_DEBUG is delayed, as it reroutes signals
       host[static_cast<int>(MT::HOST_DEBUG)] = nullptr;
       host[static_cast<int>(MT::HOST_UMPIRE)] = nullptr;
+      host[static_cast<int>(MT::HOST_POOL)] = nullptr;
       host[static_cast<int>(MT::MANAGED)] = new UvmHostMemorySpace();
 
       // Filling the device memory backends, shifting with the device size
@@ -725,6 +915,7 @@ public:
       device[static_cast<int>(MT::DEVICE_DEBUG)-shift] = nullptr;
       device[static_cast<int>(MT::DEVICE_UMPIRE)-shift] = nullptr;
       device[static_cast<int>(MT::DEVICE_UMPIRE_2)-shift] = nullptr;
+      device[static_cast<int>(MT::DEVICE_POOL)-shift] = nullptr;
    }
 
    HostMemorySpace* Host(const MemoryType mt)
@@ -746,6 +937,22 @@ public:
       return device[mt_i];
    }
 
+   /// Return the pool used by @a mt, or nullptr if it has not been created.
+   MemoryPool *Pool(const MemoryType mt)
+   {
+      if (mt == MT::HOST_POOL)
+      {
+         auto space = static_cast<PoolHostMemorySpace*>(
+                         host[static_cast<int>(mt)]);
+         return space ? &space->pool : nullptr;
+      }
+      MFEM_VERIFY(mt == MT::DEVICE_POOL, "invalid pool memory type: "
+                  << MemoryTypeName[static_cast<int>(mt)]);
+      auto space = static_cast<PoolDeviceMemorySpace*>(
+                      device[static_cast<int>(mt) - DeviceMemoryType]);
+      return space ? &space->pool : nullptr;
+   }
+
    ~Ctrl()
    {
       constexpr int mt_h = HostMemoryType;
@@ -768,6 +975,7 @@ private:
          case MT::HOST_UMPIRE: return new NoHostMemorySpace();
 #endif
          case MT::HOST_PINNED: return new HostPinnedMemorySpace();
+         case MT::HOST_POOL: return new PoolHostMemorySpace();
          default: MFEM_ABORT("Unknown host memory controller!");
       }
       return nullptr;
@@ -789,6 +997,7 @@ private:
          case MT::DEVICE_UMPIRE_2: return new NoDeviceMemorySpace();
 #endif
          case MT::DEVICE_DEBUG: return new MmuDeviceMemorySpace();
+         case MT::DEVICE_POOL: return new PoolDeviceMemorySpace();
          case MT::DEVICE:
          {
 #if defined(MFEM_USE_CUDA)
@@ -1064,6 +1273,7 @@ bool MemoryManager::MemoryClassCheck_(MemoryClass mc, void *h_ptr,
                      d_mt == MemoryType::DEVICE_DEBUG ||
                      d_mt == MemoryType::DEVICE_UMPIRE ||
                      d_mt == MemoryType::DEVICE_UMPIRE_2 ||
+                     d_mt == MemoryType::DEVICE_POOL ||
                      d_mt == MemoryType::MANAGED,"");
          return true;
       }
@@ -1652,6 +1862,26 @@ void MemoryManager::Configure(const MemoryType host_mt,
    configured = true;
 }
 
+MemoryPoolStats MemoryManager::GetPoolStats(MemoryType mt)
+{
+   internal::MemoryPool *pool = exists ? ctrl->Pool(mt) : nullptr;
+   return pool ? pool->GetStats() : MemoryPoolStats();
+}
+
+void MemoryManager::ReleasePool(MemoryType mt)
+{
+   internal::MemoryPool *pool = exists ? ctrl->Pool(mt) : nullptr;
+   if (pool) { pool->Release(); }
+}
+
+void MemoryManager::SetPoolCacheLimit(MemoryType mt, std::size_t bytes)
+{
+   MFEM_VERIFY(exists, "the MemoryManager has not been initialized!");
+   if (mt == MemoryType::HOST_POOL) { ctrl->Host(mt); }
+   else if (mt == MemoryType::DEVICE_POOL) { ctrl->Device(mt); }
+   ctrl->Pool(mt)->SetCacheLimit(bytes);
+}
+
 void MemoryManager::Destroy()
 {
    MFEM_VERIFY(exists, "MemoryManager has already been destroyed!");
@@ -1800,11 +2030,13 @@ MemoryType MemoryManager::dual_map[MemoryTypeSize] =
    /* HOST_DEBUG      */  MemoryType::DEVICE_DEBUG,
    /* HOST_UMPIRE     */  MemoryType::DEVICE_UMPIRE,
    /* HOST_PINNED     */  MemoryType::DEVICE,
+   /* HOST_POOL       */  MemoryType::DEVICE_POOL,
    /* MANAGED         */  MemoryType::MANAGED,
    /* DEVICE          */  MemoryType::HOST,
    /* DEVICE_DEBUG    */  MemoryType::HOST_DEBUG,
    /* DEVICE_UMPIRE   */  MemoryType::HOST_UMPIRE,
-   /* DEVICE_UMPIRE_2 */  MemoryType::HOST_UMPIRE
+   /* DEVICE_UMPIRE_2 */  MemoryType::HOST_UMPIRE,
+   /* DEVICE_POOL     */  MemoryType::HOST_POOL
 };
 
 #ifdef MFEM_USE_UMPIRE
@@ -1817,6 +2049,7 @@ const char * MemoryManager::d_umpire_2_name = "MFEM_DEVICE_2";
 const char *MemoryTypeName[MemoryTypeSize] =
 {
    "host-std", "host-32", "host-64", "host-debug", "host-umpire", "host-pinned",
+   "host-pool",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
@@ -1838,6 +2071,13 @@ const char *MemoryTypeName[MemoryTypeSize] =
    "device-umpire",
    "device-umpire-2",
 #endif
+#if defined(MFEM_USE_CUDA)
+   "cuda-pool",
+#elif defined(MFEM_USE_HIP)
+   "hip-pool",
+#else
+   "device-pool",
+#endif
 };
 
 } // namespace mfem
@@ -44,6 +44,9 @@ enum class MemoryType
    HOST_UMPIRE,    /**< Host memory; using an Umpire allocator which can be set
                         with MemoryManager::SetUmpireHostAllocatorName */
    HOST_PINNED,    ///< Host memory: pinned (page-locked)
+   HOST_POOL,      /**< Host memory; using MFEM's caching pool of 64-byte
+                        aligned blocks, see MemoryManager::GetPoolStats().
+                        Like all host types, it must precede MANAGED. */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -53,6 +56,10 @@ enum class MemoryType
                         set with MemoryManager::SetUmpireDeviceAllocatorName */
    DEVICE_UMPIRE_2, /**< Device memory; using a second Umpire allocator settable
                          with MemoryManager::SetUmpireDevice2AllocatorName */
+   DEVICE_POOL,    /**< Device memory; using MFEM's caching pool of CUDA or HIP
+                        device memory, or of host memory when MFEM is built
+                        without CUDA and HIP, e.g. for use with the "debug"
+                        device, see MemoryManager::GetPoolStats() */
    SIZE,           ///< Number of host and device memory types
 
    PRESERVE,       /**< Pseudo-MemoryType used as default value for MemoryType
@@ -80,11 +87,12 @@ extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, HOST_PINNED, MANAGED } */
+                                 HOST_UMPIRE, HOST_PINNED, HOST_POOL,
+                                 MANAGED } */
    HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
    HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
    DEVICE,  /**< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE,
-                                 DEVICE_UMPIRE_2, MANAGED } */
+                                 DEVICE_UMPIRE_2, DEVICE_POOL, MANAGED } */
    MANAGED  ///< Memory types: { MANAGED }
 };
 
@@ -113,6 +121,24 @@ bool MemoryClassContainsType(MemoryClass mc, MemoryType mt);
     HOST < HOST_32 < HOST_64 < DEVICE < MANAGED. */
 MemoryClass operator*(MemoryClass mc1, MemoryClass mc2);
 
+/** @brief Usage statistics of the caching pools used by MemoryType::HOST_POOL
+    and MemoryType::DEVICE_POOL, see MemoryManager::GetPoolStats(). */
+struct MemoryPoolStats
+{
+   /// Number of allocations requested from the pool.
+   std::size_t allocations = 0;
+   /// Number of allocations served from a cached block.
+   std::size_t hits = 0;
+   /// Number of blocks returned to the pool.
+   std::size_t deallocations = 0;
+   /// Total size of the blocks currently handed out by the pool.
+   std::size_t bytes_in_use = 0;
+   /// Total size of the free blocks cached by the pool.
+   std::size_t bytes_cached = 0;
+   /// Maximum of bytes_in_use + bytes_cached over the lifetime of the pool.
+   std::size_t peak_bytes = 0;
+};
+
 /// Class used by MFEM to store pointers to host and/or device memory.
 /** The template class parameter, T, must be a plain-old-data (POD) type.
 
@@ -141,7 +167,7 @@ MemoryClass operator*(MemoryClass mc1, MemoryClass mc2);
 
     A Memory object stores up to two different pointers: one host pointer (with
     MemoryType from MemoryClass::HOST) and one device pointer (currently one of
-    MemoryType: DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE or MANAGED).
+    MemoryType: DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE, DEVICE_POOL or MANAGED).
 
     A Memory object can hold (wrap) an externally allocated pointer with any
     given MemoryType.
@@ -811,11 +837,13 @@ public:
        HOST_DEBUG      | DEVICE_DEBUG
        HOST_UMPIRE     | DEVICE_UMPIRE
        HOST_PINNED     | DEVICE
+       HOST_POOL       | DEVICE_POOL
        MANAGED         | MANAGED
        DEVICE          | HOST
        DEVICE_DEBUG    | HOST_DEBUG
        DEVICE_UMPIRE   | HOST_UMPIRE
        DEVICE_UMPIRE_2 | HOST_UMPIRE
+       DEVICE_POOL     | HOST_POOL
 
        The dual types can be modified before device configuration using the
        method SetDualMemoryType() or by calling Device::SetMemoryTypes(). */
@@ -855,6 +883,23 @@ public:
    static const char * GetUmpireDevice2AllocatorName() { return d_umpire_2_name; }
 #endif
 
+   /** @brief Return the usage statistics of the caching pool used by the
+       MemoryType @a mt, which must be HOST_POOL or DEVICE_POOL. */
+   /** The pools reuse freed blocks for later allocations of similar size
+       (rounded up to one of four size classes per power of two), which avoids
+       the cost of repeated host or device allocations of temporaries, e.g. in
+       the work vectors of iterative solvers. If the pool has not been used,
+       all statistics are zero. */
+   static MemoryPoolStats GetPoolStats(MemoryType mt);
+
+   /// Free all cached (unused) blocks of the pool used by the MemoryType @a mt.
+   static void ReleasePool(MemoryType mt);
+
+   /** @brief Set the maximum total size of the free blocks cached by the pool
+       used by the MemoryType @a mt; blocks freed beyond this limit are returned
+       to the system. The default is no limit. */
+   static void SetPoolCacheLimit(MemoryType mt, std::size_t bytes);
+
    /// Free all the device memories
    void Destroy();
 
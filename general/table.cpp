@@ -14,6 +14,7 @@
 #include "array.hpp"
 #include "table.hpp"
 #include "error.hpp"
+#include "binaryio.hpp"
 
 #include "../general/mem_manager.hpp"
 #include <iostream>
@@ -417,6 +418,24 @@ void Table::Load(std::istream &in)
    }
 }
 
+void Table::Save(bin_io::BinaryWriter &writer) const
+{
+   writer.Write(int32_t(size));
+   if (size < 0) { return; }
+   writer.WriteArray(I.GetData(), size+1);
+   writer.WriteArray(J.GetData(), I[size]);
+}
+
+void Table::Load(bin_io::BinaryReader &reader)
+{
+   size = reader.Read<int32_t>();
+   if (size < 0) { Clear(); return; }
+   I.SetSize(size+1);
+   reader.ReadArray(I.GetData(), size+1);
+   J.SetSize(I[size]);
+   reader.ReadArray(J.GetData(), J.Size());
+}
+
 void Table::Clear()
 {
    I.DeleteAll();
@@ -23,6 +23,12 @@
 namespace mfem
 {
 
+namespace bin_io
+{
+class BinaryWriter;
+class BinaryReader;
+}
+
 /// Helper struct for defining a connectivity table, see Table::MakeFromList.
 struct Connection
 {
@@ -190,6 +196,11 @@ public:
    void Save(std::ostream &out) const;
    void Load(std::istream &in);
 
+   /// Save the table in the binary format of bin_io::BinaryWriter.
+   void Save(bin_io::BinaryWriter &writer) const;
+   /// Load a table saved with Save(bin_io::BinaryWriter&).
+   void Load(bin_io::BinaryReader &reader);
+
    void Copy(Table & copy) const;
    void Swap(Table & other);
 
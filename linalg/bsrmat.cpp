@@ -0,0 +1,397 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Implementation of the block compressed sparse row matrix
+
+#include "bsrmat.hpp"
+#include "simd.hpp"
+#include "../general/forall.hpp"
+
+#include <algorithm>
+
+namespace mfem
+{
+
+// Host kernel for y += a * A * x (or y += a * A^t * x when TRANSPOSE is true)
+// with blocks of size T_BS (or bs_ when T_BS = 0). The vectors are accessed
+// through node and component strides: x[j*xns + c*xcs] is component c of
+// block column j, and similarly for y.
+template <int T_BS, bool TRANSPOSE>
+static void BSRAddMultHost(const int nbr, const int bs_,
+                           const int *I, const int *J, const real_t *A,
+                           const real_t *x, const int xns, const int xcs,
+                           real_t *y, const int yns, const int ycs,
+                           const real_t a)
+{
+   if constexpr (T_BS > 0)
+   {
+      constexpr int BS = T_BS;
+      typedef AutoSIMD<real_t, BS, sizeof(real_t)> vreal_t;
+      for (int i = 0; i < nbr; i++)
+      {
+         vreal_t yi, xi;
+         if (TRANSPOSE)
+         {
+            for (int r = 0; r < BS; r++) { xi[r] = a*x[i*xns + r*xcs]; }
+         }
+         else { yi = 0.0; }
+         const int end = I[i+1];
+         for (int k = I[i]; k < end; k++)
+         {
+            const real_t *blk = A + k*BS*BS;
+            const int j = J[k];
+            for (int c = 0; c < BS; c++)
+            {
+               vreal_t col;
+               for (int r = 0; r < BS; r++) { col[r] = blk[r + c*BS]; }
+               if (TRANSPOSE)
+               {
+                  col *= xi;
+                  real_t d = 0.0;
+                  for (int r = 0; r < BS; r++) { d += col[r]; }
+                  y[j*yns + c*ycs] += d;
+               }
+               else
+               {
+                  yi.fma(col, x[j*xns + c*xcs]);
+               }
+            }
+         }
+         if (!TRANSPOSE)
+         {
+            for (int r = 0; r < BS; r++) { y[i*yns + r*ycs] += a*yi[r]; }
+         }
+      }
+   }
+   else
+   {
+      const int bs = bs_;
+      for (int i = 0; i < nbr; i++)
+      {
+         const int end = I[i+1];
+         for (int k = I[i]; k < end; k++)
+         {
+            const real_t *blk = A + k*bs*bs;
+            const int j = J[k];
+            for (int c = 0; c < bs; c++)
+            {
+               for (int r = 0; r < bs; r++)
+               {
+                  if (TRANSPOSE)
+                  {
+                     y[j*yns + c*ycs] += a*blk[r + c*bs]*x[i*xns + r*xcs];
+                  }
+                  else
+                  {
+                     y[i*yns + r*ycs] += a*blk[r + c*bs]*x[j*xns + c*xcs];
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+BSRMatrix::BSRMatrix(int height_, int width_, int bs_,
+                     Ordering::Type ordering_)
+   : Operator(height_, width_), bs(bs_), ordering(ordering_), At(nullptr)
+{
+   MFEM_VERIFY(bs > 0, "invalid block size: " << bs);
+   MFEM_VERIFY(height % bs == 0 && width % bs == 0,
+               "the matrix size (" << height << " x " << width
+               << ") is not a multiple of the block size " << bs);
+}
+
+BSRMatrix::BSRMatrix(const SparseMatrix &S, int block_size,
+                     Ordering::Type ordering_)
+   : BSRMatrix(S.Height(), S.Width(), block_size, ordering_)
+{
+   MFEM_VERIFY(S.Finalized(), "the SparseMatrix must be finalized");
+
+   const bool by_vdim = (ordering == Ordering::byVDIM);
+   const int nbr = NumBlockRows(), nbc = NumBlockCols();
+   // Scalar row of component r of block row i is i*rns + r*rcs
+   const int rns = by_vdim ? bs : 1, rcs = by_vdim ? 1 : nbr;
+
+   const int *Si = S.HostReadI();
+   const int *Sj = S.HostReadJ();
+   const real_t *Sa = S.HostReadData();
+
+   // First pass: count the nonzero blocks in each block row
+   Array<int> marker(nbc);
+   marker = -1;
+   I.SetSize(nbr+1);
+   I[0] = 0;
+   for (int i = 0; i < nbr; i++)
+   {
+      int nnzb = 0;
+      for (int r = 0; r < bs; r++)
+      {
+         const int row = i*rns + r*rcs;
+         for (int k = Si[row]; k < Si[row+1]; k++)
+         {
+            const int jb = by_vdim ? Sj[k] / bs : Sj[k] % nbc;
+            if (marker[jb] != i) { marker[jb] = i; nnzb++; }
+         }
+      }
+      I[i+1] = I[i] + nnzb;
+   }
+
+   // Second pass: fill in the sorted block columns and the block values. Here
+   // marker[jb] is the position of block column jb in the current block row.
+   const int bs2 = bs*bs;
+   J.SetSize(I[nbr]);
+   A.SetSize(I[nbr]*bs2);
+   A = 0.0;
+   marker = -1;
+   for (int i = 0; i < nbr; i++)
+   {
+      const int start = I[i];
+      int pos = start;
+      for (int r = 0; r < bs; r++)
+      {
+         const int row = i*rns + r*rcs;
+         for (int k = Si[row]; k < Si[row+1]; k++)
+         {
+            const int jb = by_vdim ? Sj[k] / bs : Sj[k] % nbc;
+            if (marker[jb] < start) { marker[jb] = pos; J[pos++] = jb; }
+         }
+      }
+      std::sort(J.GetData() + start, J.GetData() + pos);
+      for (int p = start; p < pos; p++) { marker[J[p]] = p; }
+      for (int r = 0; r < bs; r++)
+      {
+         const int row = i*rns + r*rcs;
+         for (int k = Si[row]; k < Si[row+1]; k++)
+         {
+            const int jb = by_vdim ? Sj[k] / bs : Sj[k] % nbc;
+            const int c = by_vdim ? Sj[k] % bs : Sj[k] / nbc;
+            A[marker[jb]*bs2 + r + c*bs] += Sa[k];
+         }
+      }
+   }
+   A.UseDevice(true);
+}
+
+void BSRMatrix::HostAddMult(const Vector &x, Vector &y, const real_t a,
+                            bool transpose) const
+{
+   const bool by_vdim = (ordering == Ordering::byVDIM);
+   const int nbr = NumBlockRows(), nbc = NumBlockCols();
+   const int rns = by_vdim ? bs : 1, rcs = by_vdim ? 1 : nbr;
+   const int cns = by_vdim ? bs : 1, ccs = by_vdim ? 1 : nbc;
+
+   const int *h_I = I.HostRead();
+   const int *h_J = J.HostRead();
+   const real_t *h_A = A.HostRead();
+   const real_t *h_x = x.HostRead();
+   real_t *h_y = y.HostReadWrite();
+
+   const auto run = [&](auto kernel)
+   {
+      if (transpose)
+      {
+         kernel(nbr, bs, h_I, h_J, h_A, h_x, rns, rcs, h_y, cns, ccs, a);
+      }
+      else
+      {
+         kernel(nbr, bs, h_I, h_J, h_A, h_x, cns, ccs, h_y, rns, rcs, a);
+      }
+   };
+   if (transpose)
+   {
+      switch (bs)
+      {
+         case 2: run(BSRAddMultHost<2,true>); break;
+         case 3: run(BSRAddMultHost<3,true>); break;
+         case 4: run(BSRAddMultHost<4,true>); break;
+         default: run(BSRAddMultHost<0,true>); break;
+      }
+   }
+   else
+   {
+      switch (bs)
+      {
+         case 2: run(BSRAddMultHost<2,false>); break;
+         case 3: run(BSRAddMultHost<3,false>); break;
+         case 4: run(BSRAddMultHost<4,false>); break;
+         default: run(BSRAddMultHost<0,false>); break;
+      }
+   }
+}
+
+void BSRMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void BSRMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
+{
+   MFEM_ASSERT(width == x.Size(), "Input vector size (" << x.Size()
+               << ") must match matrix width (" << width << ")");
+   MFEM_ASSERT(height == y.Size(), "Output vector size (" << y.Size()
+               << ") must match matrix height (" << height << ")");
+
+   if (!Device::Allows(~Backend::CPU_MASK))
+   {
+      HostAddMult(x, y, a, false);
+      return;
+   }
+
+   const bool by_vdim = (ordering == Ordering::byVDIM);
+   const int bs = this->bs;
+   const int nbr = NumBlockRows(), nbc = NumBlockCols();
+   const int yns = by_vdim ? bs : 1, ycs = by_vdim ? 1 : nbr;
+   const int xns = by_vdim ? bs : 1, xcs = by_vdim ? 1 : nbc;
+
+   const auto d_I = I.Read();
+   const auto d_J = J.Read();
+   const auto d_A = A.Read();
+   const auto d_x = x.Read();
+   auto d_y = y.ReadWrite();
+   mfem::forall(nbr, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int end = d_I[i+1];
+      for (int r = 0; r < bs; r++)
+      {
+         real_t d = 0.0;
+         for (int k = d_I[i]; k < end; k++)
+         {
+            const real_t *blk = d_A + k*bs*bs;
+            const int j = d_J[k];
+            for (int c = 0; c < bs; c++)
+            {
+               d += blk[r + c*bs]*d_x[j*xns + c*xcs];
+            }
+         }
+         d_y[i*yns + r*ycs] += a*d;
+      }
+   });
+}
+
+void BSRMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y.UseDevice(true);
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void BSRMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                 const real_t a) const
+{
+   MFEM_ASSERT(height == x.Size(), "Input vector size (" << x.Size()
+               << ") must match matrix height (" << height << ")");
+   MFEM_ASSERT(width == y.Size(), "Output vector size (" << y.Size()
+               << ") must match matrix width (" << width << ")");
+
+   if (!Device::Allows(~Backend::CPU_MASK))
+   {
+      HostAddMult(x, y, a, true);
+      return;
+   }
+
+   if (At == nullptr)
+   {
+      const int nbr = NumBlockRows(), nbc = NumBlockCols();
+      const int bs2 = bs*bs;
+      const int nnzb = NumNonZeroBlocks();
+      const int *h_I = I.HostRead();
+      const int *h_J = J.HostRead();
+      const real_t *h_A = A.HostRead();
+
+      At = new BSRMatrix(width, height, bs, ordering);
+      At->I.SetSize(nbc+1);
+      At->I = 0;
+      for (int k = 0; k < nnzb; k++) { At->I[h_J[k]+1]++; }
+      At->I.PartialSum();
+      At->J.SetSize(nnzb);
+      At->A.SetSize(nnzb*bs2);
+      Array<int> pos(nbc);
+      for (int j = 0; j < nbc; j++) { pos[j] = At->I[j]; }
+      for (int i = 0; i < nbr; i++)
+      {
+         for (int k = h_I[i]; k < h_I[i+1]; k++)
+         {
+            const int p = pos[h_J[k]]++;
+            At->J[p] = i;
+            for (int c = 0; c < bs; c++)
+            {
+               for (int r = 0; r < bs; r++)
+               {
+                  At->A[p*bs2 + c + r*bs] = h_A[k*bs2 + r + c*bs];
+               }
+            }
+         }
+      }
+      At->A.UseDevice(true);
+   }
+   At->AddMult(x, y, a);
+}
+
+void BSRMatrix::ResetTranspose() const
+{
+   delete At;
+   At = nullptr;
+}
+
+SparseMatrix *BSRMatrix::ToSparseMatrix() const
+{
+   const bool by_vdim = (ordering == Ordering::byVDIM);
+   const int nbr = NumBlockRows(), nbc = NumBlockCols();
+   const int rns = by_vdim ? bs : 1, rcs = by_vdim ? 1 : nbr;
+   const int cns = by_vdim ? bs : 1, ccs = by_vdim ? 1 : nbc;
+   const int bs2 = bs*bs;
+
+   const int *h_I = I.HostRead();
+   const int *h_J = J.HostRead();
+   const real_t *h_A = A.HostRead();
+
+   int *Si = Memory<int>(height+1);
+   Si[0] = 0;
+   for (int i = 0; i < nbr; i++)
+   {
+      for (int r = 0; r < bs; r++)
+      {
+         Si[i*rns + r*rcs + 1] = (h_I[i+1] - h_I[i])*bs;
+      }
+   }
+   for (int row = 0; row < height; row++) { Si[row+1] += Si[row]; }
+
+   int *Sj = Memory<int>(Si[height]);
+   real_t *Sa = Memory<real_t>(Si[height]);
+   for (int i = 0; i < nbr; i++)
+   {
+      for (int r = 0; r < bs; r++)
+      {
+         int p = Si[i*rns + r*rcs];
+         for (int k = h_I[i]; k < h_I[i+1]; k++)
+         {
+            for (int c = 0; c < bs; c++, p++)
+            {
+               Sj[p] = h_J[k]*cns + c*ccs;
+               Sa[p] = h_A[k*bs2 + r + c*bs];
+            }
+         }
+      }
+   }
+   SparseMatrix *S = new SparseMatrix(Si, Sj, Sa, height, width);
+   S->SortColumnIndices();
+   return S;
+}
+
+BSRMatrix::~BSRMatrix()
+{
+   delete At;
+}
+
+} // namespace mfem
@@ -0,0 +1,138 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BSRMAT_HPP
+#define MFEM_BSRMAT_HPP
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "operator.hpp"
+#include "ordering.hpp"
+#include "sparsemat.hpp"
+
+namespace mfem
+{
+
+/// Sparse matrix in block compressed sparse row (BSR) format.
+/** The matrix is partitioned into dense square blocks of a fixed size, e.g.
+    the vdim x vdim nodal coupling blocks of a matrix assembled on a vector
+    finite element space such as the one used with ElasticityIntegrator. Only
+    one column index is stored per block, and the blocks are stored
+    contiguously in column-major order, so the products with the matrix and
+    its transpose can be vectorized over the block rows using the AutoSIMD
+    types from linalg/simd.hpp.
+
+    The mapping between the scalar rows/columns and the (node, component)
+    pairs is given by an Ordering::Type, see FiniteElementSpace::GetOrdering().
+    With Ordering::byVDIM, block i covers the consecutive scalar indices
+    i*bs,...,i*bs+bs-1, while with Ordering::byNODES it covers the indices
+    i, i+n, ..., i+(bs-1)*n, where n is the number of block rows (or columns).
+
+    A BSRMatrix is created from a finalized SparseMatrix and does not support
+    changing its sparsity pattern. */
+class BSRMatrix : public Operator
+{
+protected:
+   /// Size of the square blocks.
+   int bs;
+
+   /// Ordering of the components within the scalar rows and columns.
+   Ordering::Type ordering;
+
+   /// Block row offsets, size NumBlockRows()+1.
+   Array<int> I;
+
+   /// Block column indices, size NumNonZeroBlocks().
+   Array<int> J;
+
+   /// Block values, size NumNonZeroBlocks()*bs*bs, column-major blocks.
+   Vector A;
+
+   /// Transpose, used to perform MultTranspose() on devices. Owned.
+   mutable BSRMatrix *At;
+
+   BSRMatrix(int height_, int width_, int bs_, Ordering::Type ordering_);
+
+   /// Compute y += a * A * x, or y += a * A^t * x, on the host.
+   void HostAddMult(const Vector &x, Vector &y, const real_t a,
+                    bool transpose) const;
+
+public:
+   /** @brief Convert the finalized SparseMatrix @a S to BSR format with
+       square blocks of size @a block_size. */
+   /** The height and width of @a S must be multiples of @a block_size. Blocks
+       which contain at least one entry of @a S are stored in full, with the
+       remaining entries set to zero. */
+   BSRMatrix(const SparseMatrix &S, int block_size,
+             Ordering::Type ordering = Ordering::byVDIM);
+
+   BSRMatrix(const BSRMatrix &) = delete;
+   BSRMatrix &operator=(const BSRMatrix &) = delete;
+
+   /// Return the size of the square blocks.
+   int GetBlockSize() const { return bs; }
+
+   /// Return the ordering of the scalar rows and columns.
+   Ordering::Type GetOrdering() const { return ordering; }
+
+   /// Return the number of block rows.
+   int NumBlockRows() const { return height / bs; }
+
+   /// Return the number of block columns.
+   int NumBlockCols() const { return width / bs; }
+
+   /// Return the number of stored (nonzero) blocks.
+   int NumNonZeroBlocks() const { return J.Size(); }
+
+   /// Return the block row offsets.
+   const Array<int> &GetBlockI() const { return I; }
+
+   /// Return the block column indices.
+   const Array<int> &GetBlockJ() const { return J; }
+
+   /// Return the column-major values of all stored blocks.
+   const Vector &GetBlockData() const { return A; }
+
+   /** @brief Return the column-major values of all stored blocks. The entries
+       may be modified, but not the sparsity pattern. */
+   Vector &GetBlockData() { ResetTranspose(); return A; }
+
+   MemoryClass GetMemoryClass() const override
+   { return Device::GetDeviceMemoryClass(); }
+
+   /// y = A * x
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// y += a * A * x
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   /// y = A^t * x
+   /** On non-CPU backends, an internal transpose is built on the first call,
+       see also ResetTranspose(). */
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   /// y += a * A^t * x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+
+   /// Delete the internal transpose, if built.
+   void ResetTranspose() const;
+
+   /// Convert back to a (finalized) SparseMatrix, including the stored zeros.
+   SparseMatrix *ToSparseMatrix() const;
+
+   ~BSRMatrix() override;
+};
+
+} // namespace mfem
+
+#endif // MFEM_BSRMAT_HPP
@@ -0,0 +1,382 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mixedprecision.hpp"
+#include "../general/forall.hpp"
+#include "../general/reducers.hpp"
+
+#include <iomanip>
+
+namespace mfem
+{
+
+using namespace std;
+
+SinglePrecisionSparseMatrix::SinglePrecisionSparseMatrix(
+   const SparseMatrix &mat_)
+   : Operator(mat_.Height(), mat_.Width()), mat(mat_)
+{
+   MFEM_VERIFY(mat.Finalized(), "the matrix must be finalized");
+   const int nnz = mat.NumNonZeroElems();
+   values.New(nnz);
+   const real_t *A = mat.HostReadData();
+   float *A_s = HostWrite(values, nnz);
+   for (int k = 0; k < nnz; k++) { A_s[k] = static_cast<float>(A[k]); }
+}
+
+void SinglePrecisionSparseMatrix::Mult(const Vector &x, Vector &y) const
+{
+   MFEM_ASSERT(x.Size() == width && y.Size() == height, "invalid sizes");
+   const bool use_dev = x.UseDevice() || y.UseDevice();
+   const auto I = mat.ReadI(use_dev);
+   const auto J = mat.ReadJ(use_dev);
+   const auto A = Read(values, values.Capacity(), use_dev);
+   const auto X = x.Read(use_dev);
+   auto Y = y.Write(use_dev);
+   mfem::forall_switch(use_dev, height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t sum = 0.0;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         sum += static_cast<real_t>(A[k])*X[J[k]];
+      }
+      Y[i] = sum;
+   });
+}
+
+void SinglePrecisionSparseMatrix::AssembleDiagonal(Vector &diag) const
+{
+   MFEM_VERIFY(height == width, "the matrix must be square");
+   diag.SetSize(height);
+   const bool use_dev = diag.UseDevice();
+   const auto I = mat.ReadI(use_dev);
+   const auto J = mat.ReadJ(use_dev);
+   const auto A = Read(values, values.Capacity(), use_dev);
+   auto D = diag.Write(use_dev);
+   mfem::forall_switch(use_dev, height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      real_t d = 0.0;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         if (J[k] == i) { d = static_cast<real_t>(A[k]); }
+      }
+      D[i] = d;
+   });
+}
+
+SinglePrecisionSparseMatrix::~SinglePrecisionSparseMatrix()
+{
+   values.Delete();
+}
+
+static Array<float> &single_workspace()
+{
+   static Array<float> instance;
+   return instance;
+}
+
+// Return the inner product of the first n entries of x and y, in single
+// precision.
+static float DotSingle(int n, const Memory<float> &x, const Memory<float> &y,
+                       bool use_dev)
+{
+   const auto X = Read(x, n, use_dev);
+   const auto Y = Read(y, n, use_dev);
+   float res = 0.0f;
+   reduce(n, res, [=] MFEM_HOST_DEVICE (int i, float &r)
+   {
+      r += X[i]*Y[i];
+   },
+   SumReducer<float> {}, use_dev, single_workspace());
+   return res;
+}
+
+void SinglePrecisionCGSolver::MultSingle(const Memory<float> &p,
+                                         Memory<float> &q, bool use_dev) const
+{
+   const auto I = mat->ReadI(use_dev);
+   const auto J = mat->ReadJ(use_dev);
+   const auto A = Read(*values, values->Capacity(), use_dev);
+   const auto P = Read(p, height, use_dev);
+   auto Q = Write(q, height, use_dev);
+   mfem::forall_switch(use_dev, height, [=] MFEM_HOST_DEVICE (int i)
+   {
+      float sum = 0.0f;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         sum += A[k]*P[J[k]];
+      }
+      Q[i] = sum;
+   });
+}
+
+void SinglePrecisionCGSolver::SetOperator(const Operator &op)
+{
+   if (auto *single_mat = dynamic_cast<const SinglePrecisionSparseMatrix*>(&op))
+   {
+      mat = &single_mat->GetMatrix();
+      values = &single_mat->GetMemoryValues();
+   }
+#ifdef MFEM_USE_SINGLE
+   else if (auto *sp_mat = dynamic_cast<const SparseMatrix*>(&op))
+   {
+      MFEM_VERIFY(sp_mat->Finalized(), "the matrix must be finalized");
+      mat = sp_mat;
+      values = &sp_mat->GetMemoryData();
+   }
+#endif
+   else
+   {
+      MFEM_ABORT("the operator must be a SinglePrecisionSparseMatrix");
+   }
+   MFEM_VERIFY(op.Height() == op.Width(), "the matrix must be square");
+   height = width = op.Height();
+
+   for (Memory<float> *v : {&diag_inv, &x_s, &r_s, &z_s, &p_s, &q_s})
+   {
+      v->Delete();
+      v->New(height);
+   }
+   const int *I = mat->HostReadI();
+   const int *J = mat->HostReadJ();
+   const float *A = HostRead(*values, values->Capacity());
+   float *D = HostWrite(diag_inv, height);
+   for (int i = 0; i < height; i++)
+   {
+      float d = 0.0f;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         if (J[k] == i) { d = A[k]; }
+      }
+      MFEM_VERIFY(d != 0.0f, "zero diagonal entry in row " << i);
+      D[i] = 1.0f/d;
+   }
+}
+
+void SinglePrecisionCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(mat != nullptr, "the operator is not set");
+   MFEM_ASSERT(b.Size() == height && x.Size() == width, "invalid sizes");
+   const int n = height;
+   const bool use_dev = b.UseDevice() || x.UseDevice();
+
+   // x_s = x or 0, r = b - A x_s
+   const bool iter_mode = iterative_mode;
+   {
+      auto X_s = Write(x_s, n, use_dev);
+      const auto X = iter_mode ? x.Read(use_dev) : nullptr;
+      mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+      {
+         X_s[i] = iter_mode ? static_cast<float>(X[i]) : 0.0f;
+      });
+   }
+   if (iter_mode) { MultSingle(x_s, q_s, use_dev); }
+   {
+      const auto B = b.Read(use_dev);
+      const auto Q = iter_mode ? Read(q_s, n, use_dev) : nullptr;
+      const auto D = Read(diag_inv, n, use_dev);
+      auto R = Write(r_s, n, use_dev);
+      auto Z = Write(z_s, n, use_dev);
+      auto P = Write(p_s, n, use_dev);
+      mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+      {
+         const float r = static_cast<float>(B[i]) - (iter_mode ? Q[i] : 0.0f);
+         R[i] = r;
+         Z[i] = D[i]*r;
+         P[i] = Z[i];
+      });
+   }
+
+   float nom = DotSingle(n, r_s, z_s, use_dev);
+   MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+   const float r0 = static_cast<float>(
+                       std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol));
+   converged = nom <= r0;
+   final_iter = 0;
+   for (int it = 1; !converged && it <= max_iter; it++)
+   {
+      MultSingle(p_s, q_s, use_dev);
+      const float den = DotSingle(n, p_s, q_s, use_dev);
+      if (!(den > 0.0f)) { break; } // the operator is not positive definite
+      const float alpha = nom/den;
+      {
+         const auto P = Read(p_s, n, use_dev);
+         const auto Q = Read(q_s, n, use_dev);
+         const auto D = Read(diag_inv, n, use_dev);
+         auto X_s = ReadWrite(x_s, n, use_dev);
+         auto R = ReadWrite(r_s, n, use_dev);
+         auto Z = Write(z_s, n, use_dev);
+         mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+         {
+            X_s[i] += alpha*P[i];
+            R[i] -= alpha*Q[i];
+            Z[i] = D[i]*R[i];
+         });
+      }
+      const float betanom = DotSingle(n, r_s, z_s, use_dev);
+      final_iter = it;
+      converged = betanom <= r0;
+      if (converged) { nom = betanom; break; }
+      const float beta = betanom/nom;
+      nom = betanom;
+      {
+         const auto Z = Read(z_s, n, use_dev);
+         auto P = ReadWrite(p_s, n, use_dev);
+         mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+         {
+            P[i] = Z[i] + beta*P[i];
+         });
+      }
+   }
+   final_norm = std::sqrt(std::max(nom, 0.0f));
+
+   const auto X_s = Read(x_s, n, use_dev);
+   auto X = x.Write(use_dev);
+   mfem::forall_switch(use_dev, n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      X[i] = static_cast<real_t>(X_s[i]);
+   });
+}
+
+SinglePrecisionCGSolver::~SinglePrecisionCGSolver()
+{
+   for (Memory<float> *v : {&diag_inv, &x_s, &r_s, &z_s, &p_s, &q_s})
+   {
+      v->Delete();
+   }
+}
+
+void MixedPrecisionSolver::UpdateInnerSolver()
+{
+   if (inner_solver && inner_oper)
+   {
+      inner_solver->SetOperator(*inner_oper);
+      inner_solver->iterative_mode = false;
+   }
+}
+
+void MixedPrecisionSolver::SetOperator(const Operator &op)
+{
+   IterativeSolver::SetOperator(op);
+#ifndef MFEM_USE_SINGLE
+   const SparseMatrix *mat = dynamic_cast<const SparseMatrix*>(&op);
+#else
+   // The values of the matrix are already stored in single precision.
+   const SparseMatrix *mat = nullptr;
+#endif
+   single_mat.reset(mat ? new SinglePrecisionSparseMatrix(*mat) : nullptr);
+   inner_oper = mat ? single_mat.get() : &op;
+   UpdateInnerSolver();
+
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+   r.SetSize(height, mt);
+   r.UseDevice(true);
+   d.SetSize(width, mt);
+   d.UseDevice(true);
+}
+
+void MixedPrecisionSolver::SetInnerSolver(Solver &solver)
+{
+   inner_solver = &solver;
+   UpdateInnerSolver();
+}
+
+void MixedPrecisionSolver::SetInnerOperator(const Operator &op)
+{
+   MFEM_VERIFY(oper == nullptr ||
+               (op.Height() == height && op.Width() == width),
+               "incompatible inner operator");
+   inner_oper = &op;
+   UpdateInnerSolver();
+}
+
+const Operator &MixedPrecisionSolver::GetInnerOperator() const
+{
+   MFEM_VERIFY(inner_oper, "the operator is not set");
+   return *inner_oper;
+}
+
+void MixedPrecisionSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(oper != nullptr, "the operator is not set");
+   MFEM_VERIFY(inner_solver != nullptr, "the inner solver is not set");
+#ifndef MFEM_USE_SINGLE
+   if (print_options.warnings && inner_oper == oper)
+   {
+      mfem::out << "MixedPrecision: The inner solver uses the full precision "
+                "operator, see SetInnerOperator().\n";
+   }
+#endif
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+   real_t nom = Norm(r);
+   initial_norm = nom;
+   const real_t r0 = std::max(nom*rel_tol, abs_tol);
+
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
+   {
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      if (print_options.iterations ||
+          (i == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  ||r|| = "
+                   << nom << ((i == 0 && print_options.first_and_last &&
+                               !print_options.iterations) ? " ...\n" : "\n");
+      }
+      if (Monitor(i, nom, r, x) || nom <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+      if (i == max_iter) { break; }
+
+      // Correction with the inner solver, update and residual in full
+      // precision
+      inner_solver->Mult(r, d);
+      x += d;
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+      nom = Norm(r);
+   }
+
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  ||r|| = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "MixedPrecision: Number of iterations: " << final_iter
+                << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "MixedPrecision: No convergence!" << '\n';
+   }
+
+   final_norm = nom;
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+} // namespace mfem
@@ -0,0 +1,171 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MIXEDPRECISION
+#define MFEM_MIXEDPRECISION
+
+#include "../config/config.hpp"
+#include "sparsemat.hpp"
+#include "solvers.hpp"
+#include <memory>
+
+namespace mfem
+{
+
+/** @brief Copy of a finalized SparseMatrix with the values stored in single
+    precision, applied to real_t vectors.
+
+    The sparsity pattern is shared with the original matrix, which must be
+    kept alive and unchanged. In Mult(), the values are converted to real_t
+    and the products are accumulated in real_t. With double precision real_t
+    and int column indices, the matrix-vector product reads 8 instead of 12
+    bytes per nonzero, at the price of a relative perturbation of the matrix
+    of the order of the single precision unit roundoff. The single precision
+    values are also used directly by SinglePrecisionCGSolver. */
+class SinglePrecisionSparseMatrix : public Operator
+{
+protected:
+   const SparseMatrix &mat;
+   Memory<float> values;
+
+public:
+   /// Create the single precision copy of the finalized matrix @a mat.
+   SinglePrecisionSparseMatrix(const SparseMatrix &mat);
+
+   /// Return the original matrix.
+   const SparseMatrix &GetMatrix() const { return mat; }
+
+   /// Return the single precision values, in the order of the original ones.
+   const Memory<float> &GetMemoryValues() const { return values; }
+
+   /// Matrix vector product y = A x with the single precision values.
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// Return the diagonal of the single precision matrix in @a diag.
+   void AssembleDiagonal(Vector &diag) const override;
+
+   ~SinglePrecisionSparseMatrix();
+};
+
+/** @brief Jacobi preconditioned conjugate gradient solver computing in single
+    precision.
+
+    The operator must be a SinglePrecisionSparseMatrix or, with
+    MFEM_USE_SINGLE, a SparseMatrix. The Krylov vectors, the inverse of the
+    diagonal, the matrix-vector products and the inner products are all in
+    single precision; only the right-hand side and the solution are converted
+    from and to real_t in Mult(). The iteration stops when the preconditioned
+    residual norm, (r, D^{-1} r)^{1/2}, is reduced by the relative tolerance or
+    is below the absolute tolerance. It is intended as the inner solver of
+    MixedPrecisionSolver, with a loose relative tolerance. */
+class SinglePrecisionCGSolver : public Solver
+{
+protected:
+   const SparseMatrix *mat = nullptr;
+   const Memory<float> *values = nullptr;
+   Memory<float> diag_inv;
+   mutable Memory<float> x_s, r_s, z_s, p_s, q_s;
+   real_t rel_tol = 0.0, abs_tol = 0.0;
+   int max_iter = 10;
+   mutable int final_iter = -1;
+   mutable bool converged = false;
+   mutable real_t final_norm = -1.0;
+
+   /// q = A p, in single precision.
+   void MultSingle(const Memory<float> &p, Memory<float> &q,
+                   bool use_dev) const;
+
+public:
+   SinglePrecisionCGSolver() { }
+
+   void SetRelTol(real_t rtol) { rel_tol = rtol; }
+   void SetAbsTol(real_t atol) { abs_tol = atol; }
+   void SetMaxIter(int max_it) { max_iter = max_it; }
+
+   /// Set the matrix and compute the single precision Jacobi diagonal.
+   void SetOperator(const Operator &op) override;
+
+   /// Solve A x = b with single precision Jacobi preconditioned CG.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   int GetNumIterations() const { return final_iter; }
+   bool GetConverged() const { return converged; }
+   /// Return the final preconditioned residual norm.
+   real_t GetFinalNorm() const { return final_norm; }
+
+   ~SinglePrecisionCGSolver();
+};
+
+/** @brief Mixed-precision iterative refinement, x <- x + B (b - A x).
+
+    The residual r = b - A x and the solution update are computed in full
+    (real_t) precision with the operator given to SetOperator(), while the
+    correction B r is computed by an inner solver with a loose relative
+    tolerance, applied to a reduced precision copy of A. If A is a
+    SparseMatrix, the inner operator is a SinglePrecisionSparseMatrix. With a
+    SinglePrecisionCGSolver as the inner solver, the whole inner solve runs in
+    single precision; a CGSolver or GMRESSolver only reads the matrix values in
+    single precision and keeps its vectors in real_t. Other operators, e.g.
+    HypreParMatrix or partially assembled forms, have no reduced precision
+    copy: unless an inner operator is set with SetInnerOperator(), the inner
+    solver uses A itself, the whole iteration runs in full precision and
+    Mult() prints a warning (if print_options.warnings is set). When real_t is
+    float (MFEM_USE_SINGLE), the inner operator is always A.
+
+    The accuracy of the inner solve only affects the convergence rate: the
+    iteration converges to the full precision solution as long as the inner
+    solver reduces the residual, typically in a few outer iterations. The
+    tolerances, maximum number of iterations, print options and monitor of
+    IterativeSolver apply to the outer iteration and to the norm of the true
+    residual, ||b - A x||. */
+class MixedPrecisionSolver : public IterativeSolver
+{
+protected:
+   Solver *inner_solver = nullptr;
+   const Operator *inner_oper = nullptr;
+   std::unique_ptr<SinglePrecisionSparseMatrix> single_mat;
+   mutable Vector r, d;
+
+   /// Give the inner operator to the inner solver, if both are set.
+   void UpdateInnerSolver();
+
+public:
+   MixedPrecisionSolver() { }
+
+#ifdef MFEM_USE_MPI
+   MixedPrecisionSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /** @brief Set the full precision operator A. If it is a SparseMatrix, its
+       single precision copy becomes the inner operator, otherwise A is the
+       inner operator until SetInnerOperator() is called. */
+   void SetOperator(const Operator &op) override;
+
+   /** @brief Set the solver computing the corrections. Its operator is set to
+       GetInnerOperator() and its iterative mode is disabled. */
+   void SetInnerSolver(Solver &solver);
+
+   /** @brief Set the operator used by the inner solver, instead of the
+       default one, e.g. an operator assembled with a lower accuracy. The
+       default is restored by SetOperator(). */
+   void SetInnerOperator(const Operator &op);
+
+   /// Return the operator used by the inner solver.
+   const Operator &GetInnerOperator() const;
+
+   /** @brief Iterative solution of the linear system using mixed-precision
+       iterative refinement. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+} // namespace mfem
+
+#endif
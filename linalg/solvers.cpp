@@ -19,6 +19,7 @@
 #include <iomanip>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <set>
 
 namespace mfem
@@ -73,6 +74,31 @@ real_t IterativeSolver::Dot(const Vector &x, const Vector &y) const
 #endif
 }
 
+void IterativeSolver::GlobalSumBegin(real_t *buf, int n) const
+{
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+      MFEM_ASSERT(sum_request == MPI_REQUEST_NULL, "a sum is in progress");
+      MPI_Iallreduce(MPI_IN_PLACE, buf, n, MPITypeMap<real_t>::mpi_type,
+                     MPI_SUM, comm, &sum_request);
+   }
+#else
+   MFEM_CONTRACT_VAR(buf);
+   MFEM_CONTRACT_VAR(n);
+#endif
+}
+
+void IterativeSolver::GlobalSumEnd() const
+{
+#ifdef MFEM_USE_MPI
+   if (sum_request != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&sum_request, MPI_STATUS_IGNORE);
+   }
+#endif
+}
+
 void IterativeSolver::SetPrintLevel(int print_lvl)
 {
    print_options = FromLegacyPrintLevel(print_lvl);
@@ -1080,6 +1106,184 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
    pcg.Mult(b, x);
 }
 
+void PipelinedCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &u, &w, &m, &n, &z, &q, &s, &p})
+   {
+      v->SetSize(width, mt);
+      v->UseDevice(true);
+   }
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(dot_oper == nullptr,
+               "PipelinedCGSolver does not support custom inner products");
+
+   // Pipelined CG following Algorithm 4 of P. Ghysels and W. Vanroose, "Hiding
+   // global synchronization latency in the preconditioned Conjugate Gradient
+   // algorithm", Parallel Computing 40 (2014). Here u = B r, w = A u, and the
+   // vectors p, s = A p, q = B s, z = A q are updated by recurrences.
+   const int N = width;
+   real_t dots[2], gamma = 0.0, gamma_old = 0.0, alpha = 0.0, nom0 = 0.0;
+   real_t r0 = 0.0;
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+   // Without a preconditioner u = r and m = w
+   const Vector &ur = prec ? u : r;
+   const Vector &mw = prec ? m : w;
+   const Vector &sq = prec ? q : s;
+   if (prec) { prec->Mult(r, u); } // u = B r
+   oper->Mult(ur, w);               // w = A u
+   z = 0.0; q = 0.0; s = 0.0; p = 0.0;
+
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
+   {
+      // The only global reduction of the iteration is overlapped with the
+      // application of the preconditioner and the operator
+      dots[0] = r * ur;
+      dots[1] = w * ur;
+      GlobalSumBegin(dots, 2);
+      if (prec) { prec->Mult(w, m); } // m = B w
+      oper->Mult(mw, n);              // n = A m
+      GlobalSumEnd();
+      gamma = dots[0];
+      const real_t delta = dots[1];
+      MFEM_VERIFY(IsFinite(gamma), "gamma = " << gamma);
+      MFEM_VERIFY(IsFinite(delta), "delta = " << delta);
+
+      if (i == 0)
+      {
+         nom0 = gamma;
+         initial_norm = (gamma >= 0.0) ? sqrt(gamma) : gamma;
+         r0 = std::max(gamma*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      if (print_options.iterations ||
+          (i == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << gamma << ((i == 0 && print_options.first_and_last &&
+                                 !print_options.iterations) ? " ...\n" : "\n");
+      }
+      if (gamma < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << gamma << '\n';
+         }
+         final_iter = i;
+         break;
+      }
+      if (Monitor(i, gamma, r, x) || gamma <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+      if (i == max_iter) { break; }
+
+      const real_t beta = (i == 0) ? 0.0 : gamma/gamma_old;
+      const real_t den = (i == 0) ? delta : delta - beta*gamma/alpha;
+      if (den <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The operator is not positive definite. "
+                      "(Ap, p) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      alpha = gamma/den;
+      gamma_old = gamma;
+
+      const bool has_prec = (prec != nullptr);
+      const auto d_n = n.Read();
+      const auto d_m = mw.Read();
+      const auto d_w = w.ReadWrite();
+      const auto d_z = z.ReadWrite();
+      const auto d_q = q.ReadWrite();
+      const auto d_s = s.ReadWrite();
+      const auto d_p = p.ReadWrite();
+      const auto d_x = x.ReadWrite();
+      const auto d_r = r.ReadWrite();
+      const auto d_u = u.ReadWrite();
+      mfem::forall(N, [=] MFEM_HOST_DEVICE (int k)
+      {
+         const real_t z_k = d_n[k] + beta*d_z[k];
+         const real_t s_k = d_w[k] + beta*d_s[k];
+         const real_t r_k = d_r[k] - alpha*s_k;
+         const real_t u_k = has_prec ? d_u[k] : d_r[k];
+         const real_t p_k = u_k + beta*d_p[k];
+         d_z[k] = z_k;
+         d_s[k] = s_k;
+         d_p[k] = p_k;
+         d_x[k] += alpha*p_k;
+         d_r[k] = r_k;
+         d_w[k] -= alpha*z_k;
+         if (has_prec)
+         {
+            const real_t q_k = d_m[k] + beta*d_q[k];
+            d_q[k] = q_k;
+            d_u[k] = u_k - alpha*q_k;
+         }
+      });
+
+      if (replace_period > 0 && (i + 1) % replace_period == 0)
+      {
+         oper->Mult(x, r);
+         subtract(b, r, r);                  // r = b - A x
+         if (prec) { prec->Mult(r, u); }     // u = B r
+         oper->Mult(ur, w);                  // w = A u
+         oper->Mult(p, s);                   // s = A p
+         if (prec) { prec->Mult(s, q); }     // q = B s
+         oper->Mult(sq, z);                  // z = A q
+      }
+   }
+
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << gamma << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PipelinedCG: Number of iterations: " << final_iter << '\n';
+   }
+   if ((print_options.summary || print_options.iterations ||
+        print_options.first_and_last) && final_iter > 0 && nom0 > 0.0)
+   {
+      const auto arf = pow(gamma/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PipelinedCG: No convergence!" << '\n';
+   }
+
+   final_norm = (gamma >= 0.0) ? sqrt(gamma) : gamma;
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
 
 inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
                                   real_t &cs, real_t &sn)
@@ -1549,6 +1753,361 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
    Monitor(final_iter, final_norm, r, x, true);
 }
 
+void SStepGMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(dot_oper == nullptr,
+               "SStepGMRESSolver does not support custom inner products");
+   MFEM_VERIFY(s > 0 && m > 0, "invalid step size or restart length");
+
+   // The Krylov basis v[0..mm] is built in blocks of s vectors. For a block
+   // starting at v[j], the monomial vectors w_l = (B A / sigma)^l v[j],
+   // l = 1..s, are stored in v[j+1..j+s] and orthonormalized with one block
+   // Gram-Schmidt step and a Cholesky QR, using the inner products
+   //    C = v[0..j]^t [w_1..w_s],  G = [w_1..w_s]^t [w_1..w_s],
+   // computed in a single reduction. With R the Cholesky factor of G - C^t C,
+   // [v[j], w_1, ..., w_s] = V Rh where Rh = [e_j, [C; R]], and the Arnoldi
+   // relation B A V = V H gives the new columns of the Hessenberg matrix
+   //    H(:,j..j+s-1) = (sigma Rh(:,1..s) - H(:,0..j-1) Rh(0..j-1,0..s-1))
+   //                    Rh(j..j+s-1,0..s-1)^{-1}.
+   const int n = width;
+   const int mm = ((m + s - 1)/s)*s;
+   // The block is orthogonalized a second time if the norm of a column is
+   // reduced by more than a factor sqrt(2) ("twice is enough"), and the basis
+   // has lost rank if a norm is still reduced below eps^{1/4} times the
+   // original norm after the second pass (the tolerances apply to squares)
+   const real_t reorth_tol = 0.5;
+   const real_t rank_tol = sqrt(std::numeric_limits<real_t>::epsilon());
+
+   DenseMatrix H(mm+1, mm), Hr(mm+1, mm), C, Ct, P(s), X;
+   Vector g(mm+1), cs(mm+1), sn(mm+1), gdiag(s), dots;
+   Vector r(n), w(n), x_monitor;
+   Array<Vector *> v(mm+1);
+
+   b.UseDevice(true);
+   x.UseDevice(true);
+   r.UseDevice(true);
+   w.UseDevice(true);
+
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(n);
+      x_monitor.UseDevice(true);
+   }
+   else
+   {
+      x_monitor.MakeRef(x, 0, n);
+   }
+
+   // vout = B A vin / sigma
+   const auto apply = [&](const Vector &vin, Vector &vout, real_t sigma)
+   {
+      if (prec)
+      {
+         oper->Mult(vin, w);
+         prec->Mult(w, vout);
+      }
+      else
+      {
+         oper->Mult(vin, vout);
+      }
+      if (sigma != 1.0) { vout *= 1.0/sigma; }
+   };
+
+   // Inner products C (j+1 x s) and G = P (s x s) of the block starting at
+   // v[j], in one global reduction
+   const auto gram = [&](int j)
+   {
+      dots.SetSize((j+1)*s + s*(s+1)/2);
+      int k = 0;
+      for (int c = 0; c < s; c++)
+      {
+         for (int l = 0; l <= j; l++) { dots(k++) = (*v[l]) * (*v[j+1+c]); }
+         for (int l = 0; l <= c; l++) { dots(k++) = (*v[j+1+l]) * (*v[j+1+c]); }
+      }
+      GlobalSumBegin(dots.GetData(), dots.Size());
+      GlobalSumEnd();
+      C.SetSize(j+1, s);
+      k = 0;
+      for (int c = 0; c < s; c++)
+      {
+         for (int l = 0; l <= j; l++) { C(l,c) = dots(k++); }
+         for (int l = 0; l <= c; l++) { P(l,c) = P(c,l) = dots(k++); }
+      }
+   };
+
+   // Cholesky factorization of P - C^t C = R^t R, with R stored in the upper
+   // triangle of P. Returns the number of columns whose squared pivot is above
+   // tol times the squared norms in gdiag; the first failed pivot is set to
+   // zero.
+   const auto cholesky = [&](real_t tol)
+   {
+      for (int c = 0; c < s; c++)
+      {
+         for (int d = 0; d <= c; d++)
+         {
+            for (int l = 0; l < C.Height(); l++) { P(d,c) -= C(l,d)*C(l,c); }
+         }
+      }
+      for (int c = 0; c < s; c++)
+      {
+         for (int l = 0; l <= c; l++)
+         {
+            real_t d = P(l,c);
+            for (int k = 0; k < l; k++) { d -= P(k,l)*P(k,c); }
+            if (l < c) { P(l,c) = d/P(l,l); continue; }
+            if (d <= tol*gdiag(c)) { P(c,c) = 0.0; return c; }
+            P(c,c) = sqrt(d);
+         }
+      }
+      return s;
+   };
+
+   int i = 0, it = 0;
+   real_t sigma = 1.0;
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+   }
+   else
+   {
+      x = 0.0;
+   }
+   if (prec)
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         prec->Mult(b, r);
+      }
+   }
+   else
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, r);
+      }
+      else
+      {
+         r = b;
+      }
+   }
+   real_t beta = initial_norm = Norm(r);  // beta = ||r||
+   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+
+   final_norm = std::max(rel_tol*beta, abs_tol);
+
+   if (Monitor(0, beta, r, x) || beta <= final_norm)
+   {
+      final_norm = beta;
+      final_iter = 0;
+      converged = true;
+      goto finish;
+   }
+
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << 1
+                << "   Iteration : " << setw(3) << 0
+                << "  ||B r|| = " << beta
+                << (print_options.first_and_last ? " ...\n" : "\n");
+   }
+
+   for (int l = 0; l <= mm; l++)
+   {
+      v[l] = new Vector(n);
+      v[l]->UseDevice(true);
+   }
+
+   for (it = 1; it <= max_iter; )
+   {
+      v[0]->Set(1.0/beta, r);
+      g = 0.0; g(0) = beta;
+      H = 0.0;
+      i = 0;
+
+      for (int j = 0; j < mm && it <= max_iter; j += s)
+      {
+         // Monomial basis, no inner products
+         for (int l = 1; l <= s; l++) { apply(*v[j+l-1], *v[j+l], sigma); }
+
+         // Block Gram-Schmidt and Cholesky QR, with a second pass if needed
+         gram(j);
+         for (int c = 0; c < s; c++) { gdiag(c) = P(c,c); }
+         Ct = C;
+         int sc = cholesky(reorth_tol);
+         if (sc < s)
+         {
+            for (int c = 0; c < s; c++)
+            {
+               for (int l = 0; l <= j; l++) { v[j+1+c]->Add(-C(l,c), *v[l]); }
+            }
+            gram(j);
+            Ct += C;
+            sc = cholesky(rank_tol);
+         }
+         // v[j+1..j+sc] = (w - V C) R^{-1}
+         for (int c = 0; c < sc; c++)
+         {
+            for (int l = 0; l <= j; l++) { v[j+1+c]->Add(-C(l,c), *v[l]); }
+            for (int l = 0; l < c; l++) { v[j+1+c]->Add(-P(l,c), *v[j+1+l]); }
+            *v[j+1+c] *= 1.0/P(c,c);
+         }
+         // Number of new columns of H. If w_{sc+1} is in the span of the
+         // basis, the column j+sc is also known, with a zero subdiagonal.
+         const int nc = std::min(sc + 1, s);
+
+         // X = T U^{-1} with T = sigma Rh(:,1..nc) - H(:,0..j-1) Cp, where Cp
+         // is Rh(0..j-1,0..nc-1) and U is Rh(j..j+nc-1,0..nc-1)
+         X.SetSize(j+nc+1, nc);
+         X = 0.0;
+         for (int c = 0; c < nc; c++)
+         {
+            for (int l = 0; l <= j; l++) { X(l,c) = sigma*Ct(l,c); }
+            for (int l = 0; l <= c; l++) { X(j+1+l,c) = sigma*P(l,c); }
+            if (c == 0) { continue; } // Rh(0..j-1,0) = 0
+            for (int k = 0; k < j; k++)
+            {
+               const real_t cp = Ct(k,c-1);
+               for (int l = 0; l <= k+1; l++) { X(l,c) -= H(l,k)*cp; }
+            }
+         }
+         for (int c = 0; c < nc; c++)
+         {
+            // U(0,0) = 1, U(0,c) = Ct(j,c-1), U(l,c) = R(l-1,c-1)
+            for (int l = 0; l < c; l++)
+            {
+               const real_t u = (l == 0) ? Ct(j,c-1) : P(l-1,c-1);
+               for (int k = 0; k <= j+nc; k++) { X(k,c) -= X(k,l)*u; }
+            }
+            const real_t ucc = (c == 0) ? 1.0 : P(c-1,c-1);
+            for (int k = 0; k <= j+c+1; k++) { H(k,j+c) = X(k,c)/ucc; }
+            for (int k = 0; k <= j+nc; k++) { X(k,c) /= ucc; }
+         }
+         if (sigma == 1.0 && it == 1)
+         {
+            // Scale the following blocks by an estimate of ||B A||
+            real_t hmax = 0.0;
+            for (int c = 0; c < nc; c++)
+            {
+               real_t col = 0.0;
+               for (int k = 0; k <= c+1; k++) { col += H(k,c)*H(k,c); }
+               hmax = std::max(hmax, sqrt(col));
+            }
+            if (hmax > 0.0) { sigma = hmax; }
+         }
+
+         // Least squares problem, one column at a time as in GMRESSolver
+         for (int c = 0; c < nc && it <= max_iter; c++, i++, it++)
+         {
+            for (int k = 0; k <= i+1; k++) { Hr(k,i) = H(k,i); }
+            for (int k = 0; k < i; k++)
+            {
+               ApplyPlaneRotation(Hr(k,i), Hr(k+1,i), cs(k), sn(k));
+            }
+            GeneratePlaneRotation(Hr(i,i), Hr(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(Hr(i,i), Hr(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(g(i), g(i+1), cs(i), sn(i));
+
+            const real_t resid = fabs(g(i+1));
+            MFEM_VERIFY(IsFinite(resid), "resid = " << resid);
+
+            if (ControllerRequiresUpdate())
+            {
+               x_monitor = x;
+               Update(x_monitor, i, Hr, g, v);
+            }
+
+            // After a loss of rank, the zero subdiagonal of the last column
+            // may be due to rounding: the true residual is checked at the
+            // restart instead
+            const bool breakdown = (sc < s && c == sc);
+            if (Monitor(it, resid, r, x_monitor) ||
+                (resid <= final_norm && !breakdown))
+            {
+               Update(x, i, Hr, g, v);
+               final_norm = resid;
+               final_iter = it;
+               converged = true;
+               goto finish;
+            }
+
+            if (print_options.iterations)
+            {
+               mfem::out << "   Pass : " << setw(2) << (it-1)/mm+1
+                         << "   Iteration : " << setw(3) << it
+                         << "  ||B r|| = " << resid << '\n';
+            }
+         }
+
+         if (sc < s)
+         {
+            if (print_options.warnings)
+            {
+               mfem::out << "SStepGMRES: Loss of rank of the monomial basis, "
+                         "restarting. Consider reducing the step size.\n";
+            }
+            break;
+         }
+      }
+
+      if (print_options.iterations && it <= max_iter)
+      {
+         mfem::out << "Restarting..." << '\n';
+      }
+
+      Update(x, i-1, Hr, g, v);
+
+      oper->Mult(x, r);
+      if (prec)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         subtract(b, r, r);
+      }
+      beta = Norm(r);         // beta = ||r||
+      MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+      if (beta <= final_norm)
+      {
+         final_norm = beta;
+         final_iter = it - 1;
+         converged = true;
+         goto finish;
+      }
+   }
+
+   final_norm = beta;
+   final_iter = max_iter;
+   converged = false;
+
+finish:
+   if ((print_options.iterations && converged) || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << (std::max(final_iter,1)-1)/mm+1
+                << "   Iteration : " << setw(3) << final_iter
+                << "  ||B r|| = " << final_norm << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepGMRES: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepGMRES: No convergence!\n";
+   }
+
+   Monitor(final_iter, final_norm, r, x, true);
+
+   for (int l = 0; l < v.Size(); l++) { delete v[l]; }
+}
+
 
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, real_t &tol, real_t atol, int printit)
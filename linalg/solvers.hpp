@@ -139,6 +139,7 @@ public:
 private:
    int dot_prod_type; // 0 - local, 1 - global over 'comm'
    MPI_Comm comm = MPI_COMM_NULL;
+   mutable MPI_Request sum_request = MPI_REQUEST_NULL;
 #endif
 
 protected:
@@ -205,6 +206,15 @@ protected:
    /// Return the inner product norm of @a x, using the inner product defined by Dot()
    real_t Norm(const Vector &x) const { return sqrt(Dot(x, x)); }
 
+   /** @brief Start the global sum of the @a n local values in @a buf, e.g.
+       local inner products, over the communicator of the solver. The sum is
+       done in place with a nonblocking reduction, and is complete after
+       GlobalSumEnd(). Does nothing if the inner products are local. */
+   void GlobalSumBegin(real_t *buf, int n) const;
+
+   /// Wait for the global sum started by GlobalSumBegin().
+   void GlobalSumEnd() const;
+
    /// Indicated if the controller requires an update of the solution
    bool ControllerRequiresUpdate() const { return controller && controller->RequiresUpdatedSolution(); }
 
@@ -655,6 +665,49 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
          int print_iter = 0, int max_num_iter = 1000,
          real_t RTOLERANCE = 1e-12, real_t ATOLERANCE = 1e-24);
 
+/** @brief Pipelined preconditioned conjugate gradient method.
+
+    This is the pipelined CG method of Ghysels and Vanroose, mathematically
+    equivalent to CGSolver. It needs a single global reduction per iteration,
+    started with a nonblocking MPI_Iallreduce() which is overlapped with the
+    application of the preconditioner and the operator. This reduces the cost
+    of the reductions when they dominate the iteration time, e.g. on many MPI
+    ranks, at the price of more vector updates per iteration.
+
+    The convergence criterion and the norm passed to the controller are the
+    same as in CGSolver, namely (B r, r). The recurrences used for the
+    residual can deviate from the true residual for tight tolerances; this can
+    be mitigated with SetResidualReplacement().
+
+    @note A custom inner product (see SetInnerProduct()) is not supported. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, m, n, z, q, s, p;
+   int replace_period = 0;
+
+   void UpdateVectors();
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Recompute the residual and the auxiliary vectors from their
+       definitions every @a period iterations, at the cost of four operator
+       and two preconditioner applications. The default, 0, disables it. */
+   void SetResidualReplacement(int period) { replace_period = period; }
+
+   /** @brief Iterative solution of the linear system using the pipelined
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 
 /// GMRES method
 class GMRESSolver : public IterativeSolver
@@ -695,6 +748,49 @@ public:
    void Mult(const Vector &b, Vector &x) const override;
 };
 
+/** @brief s-step (communication-avoiding) GMRES method.
+
+    Each group of s iterations first builds s Krylov vectors with the monomial
+    basis, without any inner products, and then orthonormalizes them against
+    the previous basis vectors and among themselves with a block Gram-Schmidt
+    step followed by a Cholesky QR. All the inner products of the group are
+    computed in a single global reduction, instead of the i+2 reductions of
+    iteration i of GMRESSolver. The Hessenberg matrix of the Arnoldi process
+    is recovered from the change of basis, so the iterates, the residual norms
+    and the convergence criterion are those of GMRESSolver, up to rounding.
+
+    The monomial basis is scaled by an estimate of the norm of the
+    (preconditioned) operator. Its conditioning grows quickly with s, so small
+    values (the default is 4) are recommended. If the orthogonalization
+    reduces the norm of a vector of the block by more than a factor sqrt(2),
+    the block is orthogonalized a second time, at the cost of another
+    reduction, which keeps the basis orthogonal to working precision.
+
+    @note A custom inner product (see SetInnerProduct()) is not supported. */
+class SStepGMRESSolver : public IterativeSolver
+{
+protected:
+   int m; // see SetKDim()
+   int s; // see SetStepSize()
+
+public:
+   SStepGMRESSolver() { m = 48; s = 4; }
+
+#ifdef MFEM_USE_MPI
+   SStepGMRESSolver(MPI_Comm comm_) : IterativeSolver(comm_) { m = 48; s = 4; }
+#endif
+
+   /** @brief Set the number of iterations to perform between restarts,
+       rounded up to a multiple of the step size. The default is 48. */
+   void SetKDim(int dim) { m = dim; }
+
+   /// Set the number of iterations @a s_ per global reduction, default is 4.
+   void SetStepSize(int s_) { s = s_; }
+
+   /// Iterative solution of the linear system using the s-step GMRES method
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 /// GMRES method. (tolerances are squared)
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, real_t &tol, real_t atol, int printit);
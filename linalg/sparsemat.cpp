@@ -24,6 +24,10 @@
 #include <limits>
 #include <cstring>
 
+#ifdef MFEM_USE_OPENMP
+#include <omp.h>
+#endif
+
 #if defined(MFEM_USE_CUDA)
 #define MFEM_cu_or_hip(stub) cu##stub
 #define MFEM_Cu_or_Hip(stub) Cu##stub
@@ -69,6 +73,121 @@ void * SparseMatrix::dBuffer = nullptr;
 #endif
 #endif // MFEM_USE_CUDA_OR_HIP
 
+#ifdef MFEM_USE_OPENMP
+// Compute the range of rows [begin, end) assigned to thread 'tid' out of 'nt'
+// threads, such that all threads get approximately the same number of nonzero
+// entries. The row offsets array 'I' has size height+1.
+static void OmpBalancedRows(const int *I, const int height,
+                            const int tid, const int nt,
+                            int &begin, int &end)
+{
+   const long long nnz = I[height];
+   const auto row_of = [&](int t)
+   {
+      if (t == 0) { return 0; }
+      if (t == nt) { return height; }
+      const int target = (int)((nnz * t) / nt);
+      return (int)(std::lower_bound(I, I + height + 1, target) - I);
+   };
+   begin = row_of(tid);
+   end = std::max(begin, row_of(tid + 1));
+}
+
+// y += a * A * x using nonzero-balanced row blocks, one per OpenMP thread.
+static void OmpAddMult(const int height, const int *I, const int *J,
+                       const real_t *A, const real_t *x, real_t *y,
+                       const real_t a)
+{
+   #pragma omp parallel
+   {
+      int begin, end;
+      OmpBalancedRows(I, height, omp_get_thread_num(), omp_get_num_threads(),
+                      begin, end);
+      for (int i = begin; i < end; i++)
+      {
+         real_t d = 0.0;
+         const int row_end = I[i+1];
+         for (int j = I[i]; j < row_end; j++)
+         {
+            d += A[j] * x[J[j]];
+         }
+         y[i] += a * d;
+      }
+   }
+}
+
+// y += a * A^t * x without an explicit transpose. Every thread scatters the
+// contributions of its nonzero-balanced row block into a private buffer which
+// only covers the range of columns referenced by that block. The buffers are
+// then summed into y in parallel over the columns, in thread order, so the
+// result is free of write conflicts and deterministic for a fixed number of
+// threads. The buffers are allocated in each call, so concurrent calls on the
+// same matrix do not share them.
+static void OmpAddMultTranspose(const int height, const int width,
+                                const int *I, const int *J, const real_t *A,
+                                const real_t *x, real_t *y, const real_t a)
+{
+   // First column of the window of each thread and offsets of the windows
+   Array<int> col_start;
+   Array<int> offsets;
+   Vector work;
+   #pragma omp parallel
+   {
+      const int nt = omp_get_num_threads();
+      const int tid = omp_get_thread_num();
+      #pragma omp single
+      {
+         col_start.SetSize(nt);
+         offsets.SetSize(nt+1);
+      }
+      int begin, end;
+      OmpBalancedRows(I, height, tid, nt, begin, end);
+      int col_min = width, col_max = -1;
+      for (int j = I[begin]; j < I[end]; j++)
+      {
+         col_min = std::min(col_min, J[j]);
+         col_max = std::max(col_max, J[j]);
+      }
+      if (col_max < col_min) { col_min = 0; col_max = -1; }
+      col_start[tid] = col_min;
+      offsets[tid+1] = col_max - col_min + 1;
+      #pragma omp barrier
+      #pragma omp single
+      {
+         offsets[0] = 0;
+         offsets.PartialSum();
+         work.SetSize(offsets[nt]);
+      }
+      real_t *w = work.GetData() + offsets[tid] - col_min;
+      for (int c = col_min; c <= col_max; c++) { w[c] = 0.0; }
+      for (int i = begin; i < end; i++)
+      {
+         const real_t xi = a * x[i];
+         const int row_end = I[i+1];
+         for (int j = I[i]; j < row_end; j++)
+         {
+            w[J[j]] += A[j] * xi;
+         }
+      }
+      #pragma omp barrier
+      #pragma omp for
+      for (int c = 0; c < width; c++)
+      {
+         real_t d = 0.0;
+         for (int t = 0; t < nt; t++)
+         {
+            const int c0 = col_start[t];
+            if (c >= c0 && c < c0 + offsets[t+1] - offsets[t])
+            {
+               d += work[offsets[t] + c - c0];
+            }
+         }
+         y[c] += d;
+      }
+   }
+}
+#endif // MFEM_USE_OPENMP
+
 void SparseMatrix::InitGPUSparse()
 {
    // Initialize cuSPARSE/hipSPARSE library
@@ -865,6 +984,14 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
 #endif // CUDA_VERSION >= 10010 || defined(MFEM_USE_HIP)
 #endif // MFEM_USE_CUDA_OR_HIP
    }
+#ifdef MFEM_USE_OPENMP
+   else if (Device::Allows(Backend::OMP) &&
+            !Device::Allows(Backend::DEVICE_MASK))
+   {
+      // Host-threaded version with nonzero-balanced row blocks
+      OmpAddMult(height, d_I, d_J, d_A, d_x, d_y, a);
+   }
+#endif
    else
    {
       // Native version
@@ -947,6 +1074,14 @@ void SparseMatrix::AddMultTranspose(const Vector &x, Vector &y,
       const int *Jp = HostRead(J, nnz);
       const real_t *Ap = HostRead(A, nnz);
 
+#ifdef MFEM_USE_OPENMP
+      if (Device::Allows(Backend::OMP))
+      {
+         OmpAddMultTranspose(height, width, Ip, Jp, Ap, xp, yp, a);
+         return;
+      }
+#endif
+
       for (int i = 0; i < height; i++)
       {
          const real_t xi = a * xp[i];
@@ -976,7 +1111,8 @@ void SparseMatrix::ResetTranspose() const
 
 void SparseMatrix::EnsureMultTranspose() const
 {
-   if (Device::Allows(~Backend::CPU_MASK))
+   // Backend::OMP uses a threaded kernel that does not need the transpose
+   if (Device::Allows(~(Backend::CPU_MASK | Backend::OMP)))
    {
       BuildTranspose();
    }
@@ -2782,6 +2918,53 @@ void SparseMatrix::AddSubMatrix(const Array<int> &rows, const Array<int> &cols,
    }
 }
 
+void SparseMatrix::AddSubMatrixThreadSafe(const Array<int> &rows,
+                                          const Array<int> &cols,
+                                          const DenseMatrix &subm)
+{
+   MFEM_ASSERT(Finalized() && ColumnsAreSorted(),
+               "the matrix must be finalized with sorted columns");
+
+   // Decoded column indices, sorted, paired with their position in 'cols'
+   const int nc = cols.Size();
+   Array<Pair<int,int>> sorted_cols(nc);
+   for (int j = 0; j < nc; j++)
+   {
+      const int gj = cols[j];
+      sorted_cols[j] = Pair<int,int>((gj < 0) ? -1-gj : gj, j);
+   }
+   SortPairs<int,int>(sorted_cols.GetData(), nc);
+
+   const int *Ip = I, *Jp = J;
+   real_t *Ap = A;
+   for (int i = 0; i < rows.Size(); i++)
+   {
+      int gi = rows[i], s = 1;
+      if (gi < 0) { gi = -1-gi; s = -1; }
+      MFEM_ASSERT(gi < height,
+                  "Trying to insert a row " << gi << " outside the matrix height "
+                  << height);
+      // Merge the sorted columns with the sorted entries of row gi
+      int k = Ip[gi];
+      const int end = Ip[gi+1];
+      for (int jj = 0; jj < nc; jj++)
+      {
+         const int gj = sorted_cols[jj].one;
+         const int j = sorted_cols[jj].two;
+         const real_t a = subm(i, j);
+         while (k < end && Jp[k] < gj) { k++; }
+         if (k == end || Jp[k] != gj)
+         {
+            if (a == 0.0) { continue; }
+            MFEM_ABORT("Could not find entry for row = " << gi << ", col = "
+                       << gj);
+         }
+         const int t = (cols[j] < 0) ? -s : s;
+         Ap[k] += (t < 0) ? -a : a;
+      }
+   }
+}
+
 void SparseMatrix::Set(const int i, const int j, const real_t val)
 {
    real_t a = val;
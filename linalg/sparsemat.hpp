@@ -354,6 +354,8 @@ public:
    }
 
    /// Matrix vector multiplication.
+   /** When Backend::OMP is enabled, the rows are split among the OpenMP
+       threads in blocks with approximately equal numbers of nonzeros. */
    void Mult(const Vector &x, Vector &y) const override;
 
    /// y += A * x (default)  or  y += a * A * x
@@ -385,12 +387,13 @@ public:
        (optionally) a call to this method. If the internal transpose is already
        built, this method has no effect.
 
-       When any non-serial-CPU backend is enabled, i.e. the call
-       Device::Allows(~ Backend::CPU_MASK) returns true, the above methods
-       require the internal transpose to be built. If that is not the case (i.e.
-       the internal transpose is not built), these methods will automatically
-       call EnsureMultTranspose(). When using any backend from
-       Backend::CPU_MASK, calling this method is optional.
+       When any non-serial-CPU backend other than Backend::OMP is enabled,
+       i.e. the call Device::Allows(~(Backend::CPU_MASK | Backend::OMP))
+       returns true, the above methods require the internal transpose to be
+       built. If that is not the case (i.e. the internal transpose is not
+       built), these methods will automatically call EnsureMultTranspose().
+       When using any backend from Backend::CPU_MASK, or Backend::OMP which
+       uses a threaded transpose kernel, calling this method is optional.
 
        This method can only be used when the sparse matrix is finalized.
 
@@ -403,14 +406,15 @@ public:
 
    /** @brief Ensures that the matrix is capable of performing MultTranspose(),
        AddMultTranspose(), and AbsMultTranspose(). */
-   /** For non-serial-CPU backends (e.g. GPU, OpenMP), multiplying by the
+   /** For non-serial-CPU backends (e.g. GPU, RAJA), multiplying by the
        transpose requires that the internal transpose matrix be already built.
        When such a backend is enabled, this function will build the internal
        transpose matrix, see BuildTranspose().
 
-       For the serial CPU backends, the internal transpose is not required, and
-       this function is a no-op. This allows for significant memory savings
-       when the internal transpose matrix is not required. */
+       For the serial CPU backends and for Backend::OMP, the internal
+       transpose is not required, and this function is a no-op. This allows
+       for significant memory savings when the internal transpose matrix is
+       not required. */
    void EnsureMultTranspose() const;
 
    void PartMult(const Array<int> &rows, const Vector &x, Vector &y) const;
@@ -622,6 +626,19 @@ public:
    void AddSubMatrix(const Array<int> &rows, const Array<int> &cols,
                      const DenseMatrix &subm, int skip_zeros = 1);
 
+   /** @brief Add the DenseMatrix into the finalized SparseMatrix at the
+       specified rows and columns, without modifying any internal state. */
+   /** The matrix must be finalized with sorted column indices, and its
+       sparsity pattern must contain all entries corresponding to nonzero
+       entries of @a subm; zero entries outside of the pattern are skipped.
+       Unlike AddSubMatrix(), this method does not use the "current row"
+       workspace (see SetColPtr()), so concurrent calls from multiple threads
+       are safe as long as they update disjoint sets of rows. The host data of
+       the matrix must be valid, e.g. by calling HostReadWriteData(), before
+       the concurrent calls. */
+   void AddSubMatrixThreadSafe(const Array<int> &rows, const Array<int> &cols,
+                               const DenseMatrix &subm);
+
    bool RowIsEmpty(const int row) const;
 
    /// Extract all column indices and values from a given row.
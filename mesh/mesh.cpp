@@ -4985,6 +4985,10 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       }
       ReadMFEMMesh(input, mfem_version, curved);
    }
+   else if (mesh_type == "MFEM binary mesh v1.0")
+   {
+      ReadMFEMBinaryMesh(input, curved);
+   }
    else if (mfem_nc_version)
    {
       MFEM_ASSERT(ncmesh == NULL, "internal error");
@@ -9006,7 +9010,8 @@ void FindPartitioningComponents(Table &elem_elem,
                                 Array<int> &component,
                                 Array<int> &num_comp);
 
-int *Mesh::GeneratePartitioning(int nparts, int part_method)
+int *Mesh::GeneratePartitioning(int nparts, int part_method,
+                                const Vector *elem_weights)
 {
 #ifdef MFEM_USE_METIS
 
@@ -9048,7 +9053,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
    {
       idx_t *I, *J, n;
 #ifndef MFEM_USE_METIS_5
-      idx_t wgtflag = 0;
+      idx_t wgtflag = elem_weights ? 2 : 0;
       idx_t numflag = 0;
       idx_t options[5];
 #else
@@ -9082,6 +9087,24 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
          mpartitioning = new idx_t[n];
          freedata = true;
       }
+      // Integer vertex weights for METIS, scaled such that the largest one is
+      // 1000 and all are positive
+      idx_t *vwgt = NULL;
+      if (elem_weights)
+      {
+         MFEM_VERIFY(elem_weights->Size() == NumOfElements,
+                     "the number of weights must match the number of elements");
+         MFEM_VERIFY(elem_weights->Min() > 0.0,
+                     "the element weights must be positive");
+         const real_t wmax = elem_weights->Max();
+         vwgt = new idx_t[n];
+         for (int k = 0; k < n; k++)
+         {
+            const real_t w = std::round(1000.0*(*elem_weights)(k)/wmax);
+            vwgt[k] = std::max((idx_t) 1, (idx_t) w);
+         }
+      }
+
 #ifndef MFEM_USE_METIS_5
       options[0] = 0;
 #else
@@ -9119,7 +9142,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
          METIS_PartGraphRecursive(&n,
                                   I,
                                   J,
-                                  NULL,
+                                  vwgt,
                                   NULL,
                                   &wgtflag,
                                   &numflag,
@@ -9132,7 +9155,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
                                             &ncon,
                                             I,
                                             J,
-                                            NULL,
+                                            vwgt,
                                             NULL,
                                             NULL,
                                             &mparts,
@@ -9157,7 +9180,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
          METIS_PartGraphKway(&n,
                              I,
                              J,
-                             NULL,
+                             vwgt,
                              NULL,
                              &wgtflag,
                              &numflag,
@@ -9170,7 +9193,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
                                        &ncon,
                                        I,
                                        J,
-                                       NULL,
+                                       vwgt,
                                        NULL,
                                        NULL,
                                        &mparts,
@@ -9195,7 +9218,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
          METIS_PartGraphVKway(&n,
                               I,
                               J,
-                              NULL,
+                              vwgt,
                               NULL,
                               &wgtflag,
                               &numflag,
@@ -9209,7 +9232,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
                                        &ncon,
                                        I,
                                        J,
-                                       NULL,
+                                       vwgt,
                                        NULL,
                                        NULL,
                                        &mparts,
@@ -9247,6 +9270,7 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
          delete[] J;
          delete[] mpartitioning;
       }
+      delete[] vwgt;
    }
 
    delete el_to_el;
@@ -12361,6 +12385,72 @@ void Mesh::Printer(std::ostream &os, std::string section_delimiter,
    }
 }
 
+void Mesh::PrintBinaryElements(bin_io::BinaryWriter &writer,
+                               const Array<Element*> &elems)
+{
+   const int n = elems.Size();
+   std::vector<uint8_t> geom(n);
+   std::vector<int32_t> attr(n), conn;
+   for (int i = 0; i < n; i++)
+   {
+      geom[i] = uint8_t(elems[i]->GetGeometryType());
+      attr[i] = elems[i]->GetAttribute();
+      const int *v = elems[i]->GetVertices();
+      conn.insert(conn.end(), v, v + elems[i]->GetNVertices());
+   }
+   writer.Write(int64_t(conn.size()));
+   writer.WriteArray(geom.data(), geom.size());
+   writer.WriteArray(attr.data(), attr.size());
+   writer.WriteArray(conn.data(), conn.size());
+}
+
+void Mesh::PrintBinary(std::ostream &os) const
+{
+   MFEM_VERIFY(!NURBSext && !Nonconforming(),
+               "the binary mesh format supports conforming meshes only");
+
+   const bool set_names = attribute_sets.SetsExist() ||
+                          bdr_attribute_sets.SetsExist();
+
+   os << "MFEM binary mesh v1.0\n";
+   bin_io::BinaryWriter writer(os);
+   writer.WriteHeader();
+   writer.Write(int32_t(Dim));
+   writer.Write(int32_t(spaceDim));
+   writer.Write(int32_t(NumOfElements));
+   writer.Write(int32_t(NumOfBdrElements));
+   writer.Write(int32_t(NumOfVertices));
+   writer.Write(int32_t(Nodes != NULL));
+   writer.Write(int32_t(set_names));
+   writer.Write(int32_t(0)); // reserved
+
+   PrintBinaryElements(writer, elements);
+   PrintBinaryElements(writer, boundary);
+
+   if (set_names)
+   {
+      std::ostringstream sets;
+      attribute_sets.Print(sets);
+      writer.WriteString(sets.str());
+      sets.str("");
+      bdr_attribute_sets.Print(sets);
+      writer.WriteString(sets.str());
+   }
+
+   if (Nodes == NULL)
+   {
+      // Same layout as the Vertex objects, so they can be used in place
+      static_assert(sizeof(Vertex) == 3*sizeof(real_t), "invalid Vertex layout");
+      writer.WriteArray(reinterpret_cast<const real_t*>(vertices.GetData()),
+                        3*size_t(NumOfVertices));
+   }
+   else
+   {
+      Nodes->SaveBinary(os);
+   }
+   os.flush();
+}
+
 void Mesh::PrintTopo(std::ostream &os, const Array<int> &e_to_k,
                      const int version, const std::string &comments) const
 {
@@ -12685,15 +12775,33 @@ void Mesh::PrintBdrVTU(std::string fname,
 
 void Mesh::PrintVTU(std::ostream &os, int ref, VTKFormat format,
                     bool high_order_output, int compression_level,
-                    bool bdr_elements)
+                    bool bdr_elements, VTKAppendedData *appended)
 {
    RefinedGeometry *RefG;
    DenseMatrix pmat;
 
-   const char *fmt_str = (format == VTKFormat::ASCII) ? "ascii" : "binary";
+   MFEM_VERIFY(!appended || format != VTKFormat::ASCII,
+               "appended data requires a binary format");
+   const std::string fmt_attr = (format == VTKFormat::ASCII) ?
+                                "format=\"ascii\"" : "format=\"binary\"";
    const char *type_str = (format != VTKFormat::BINARY32) ? "Float64" : "Float32";
    std::vector<char> buf;
 
+   // Format attribute of the next data array
+   auto format_attr = [&]()
+   {
+      return appended ? appended->Attributes() : fmt_attr;
+   };
+   // Write the binary data of the current array, inline or appended
+   auto end_array = [&]()
+   {
+      if (appended) { appended->AppendAndClear(buf); }
+      else if (format != VTKFormat::ASCII)
+      {
+         WriteBase64WithSizeAndClear(os, buf, compression_level);
+      }
+   };
+
    auto get_geom = [&](int i)
    {
       if (bdr_elements) { return GetBdrElementGeometry(i); }
@@ -12715,55 +12823,114 @@ void Mesh::PrintVTU(std::ostream &os, int ref, VTKFormat format,
    os << "<Piece NumberOfPoints=\"" << np << "\" NumberOfCells=\""
       << (high_order_output ? ne : nc_ref) << "\">\n";
 
-   // print out the points
-   os << "<Points>\n";
-   os << "<DataArray type=\"" << type_str
-      << "\" NumberOfComponents=\"3\" format=\"" << fmt_str << "\">\n";
-   for (int i = 0; i < ne; i++)
+   // Evaluate the coordinates of the points. In the binary formats, the
+   // elements are processed in parallel when the transformations use scalar
+   // finite elements.
+   const int sdim = SpaceDimension();
+   std::vector<real_t> points;
+   const FiniteElementSpace *nodes_fes = Nodes ? Nodes->FESpace() : NULL;
+   bool evaluated = false;
+   if (format != VTKFormat::ASCII &&
+       (!nodes_fes || !nodes_fes->GetNURBSext()))
    {
-      RefG = GlobGeometryRefiner.Refine(get_geom(i), ref, 1);
-
-      if (bdr_elements)
+      auto get_fe = [&](int i) -> const FiniteElement*
       {
-         GetBdrElementTransformation(i)->Transform(RefG->RefPts, pmat);
-      }
-      else
+         if (nodes_fes)
+         {
+            return bdr_elements ? nodes_fes->GetBE(i) : nodes_fes->GetFE(i);
+         }
+         return GetTransformationFEforElementType(
+                   bdr_elements ? GetBdrElementType(i) : GetElementType(i));
+      };
+      // 'work' holds the vdofs of the nodes, or the vertices of the element
+      auto get_dofs = [&](int i, Array<int> &work, Vector &dofs)
       {
-         GetElementTransformation(i)->Transform(RefG->RefPts, pmat);
-      }
-
-      for (int j = 0; j < pmat.Width(); j++)
+         if (nodes_fes)
+         {
+            DofTransformation doftrans;
+            if (bdr_elements)
+            {
+               nodes_fes->GetBdrElementVDofs(i, work, doftrans);
+            }
+            else { nodes_fes->GetElementVDofs(i, work, doftrans); }
+            Nodes->GetSubVector(work, dofs);
+            doftrans.InvTransformPrimal(dofs);
+            return;
+         }
+         if (bdr_elements) { GetBdrElementVertices(i, work); }
+         else { GetElementVertices(i, work); }
+         const int nv = work.Size();
+         dofs.SetSize(nv*sdim);
+         for (int k = 0; k < nv; k++)
+         {
+            const real_t *v = GetVertex(work[k]);
+            for (int c = 0; c < sdim; c++) { dofs(k + c*nv) = v[c]; }
+         }
+      };
+      if (Nodes) { Nodes->HostRead(); }
+      evaluated = EvalVTKRefinedField(ne, ref, sdim, get_geom, get_fe,
+                                      get_dofs, points);
+   }
+   if (!evaluated)
+   {
+      points.resize(std::size_t(sdim)*np);
+      real_t *pt = points.data();
+      for (int i = 0; i < ne; i++)
       {
-         WriteBinaryOrASCII(os, buf, pmat(0,j), " ", format);
-         if (pmat.Height() > 1)
+         RefG = GlobGeometryRefiner.Refine(get_geom(i), ref, 1);
+         if (bdr_elements)
          {
-            WriteBinaryOrASCII(os, buf, pmat(1,j), " ", format);
+            GetBdrElementTransformation(i)->Transform(RefG->RefPts, pmat);
          }
          else
          {
-            WriteBinaryOrASCII(os, buf, 0.0, " ", format);
+            GetElementTransformation(i)->Transform(RefG->RefPts, pmat);
          }
-         if (pmat.Height() > 2)
+         for (int j = 0; j < pmat.Width(); j++)
          {
-            WriteBinaryOrASCII(os, buf, pmat(2,j), "", format);
+            for (int c = 0; c < sdim; c++) { *(pt++) = pmat(c,j); }
          }
-         else
+      }
+   }
+   if (sdim < 3)
+   {
+      // VTK points always have three coordinates
+      std::vector<real_t> points3(3*std::size_t(np), 0.0);
+      for (int j = 0; j < np; j++)
+      {
+         for (int c = 0; c < sdim; c++)
          {
-            WriteBinaryOrASCII(os, buf, 0.0, "", format);
+            points3[3*j + c] = points[sdim*j + c];
          }
-         if (format == VTKFormat::ASCII) { os << '\n'; }
       }
+      points.swap(points3);
    }
-   if (format != VTKFormat::ASCII)
+
+   // print out the points
+   os << "<Points>\n";
+   os << "<DataArray type=\"" << type_str
+      << "\" NumberOfComponents=\"3\" " << format_attr() << ">\n";
+   if (format == VTKFormat::ASCII)
    {
-      WriteBase64WithSizeAndClear(os, buf, compression_level);
+      for (int j = 0; j < np; j++)
+      {
+         WriteBinaryOrASCII(os, buf, points[3*j], " ", format);
+         WriteBinaryOrASCII(os, buf, points[3*j+1], " ", format);
+         WriteBinaryOrASCII(os, buf, points[3*j+2], "", format);
+         os << '\n';
+      }
    }
+   else
+   {
+      AppendVTKBinary(buf, points.data(), points.size(), format);
+   }
+   end_array();
    os << "</DataArray>" << std::endl;
    os << "</Points>" << std::endl;
 
    os << "<Cells>" << std::endl;
-   os << "<DataArray type=\"Int32\" Name=\"connectivity\" format=\""
-      << fmt_str << "\">" << std::endl;
+   os << "<DataArray type=\"Int32\" Name=\"connectivity\" "
+      << format_attr() << ">" << std::endl;
    // connectivity
    std::vector<int> offset;
 
@@ -12810,26 +12977,20 @@ void Mesh::PrintVTU(std::ostream &os, int ref, VTKFormat format,
          np += RefG->RefPts.GetNPoints();
       }
    }
-   if (format != VTKFormat::ASCII)
-   {
-      WriteBase64WithSizeAndClear(os, buf, compression_level);
-   }
+   end_array();
    os << "</DataArray>" << std::endl;
 
-   os << "<DataArray type=\"Int32\" Name=\"offsets\" format=\""
-      << fmt_str << "\">" << std::endl;
+   os << "<DataArray type=\"Int32\" Name=\"offsets\" "
+      << format_attr() << ">" << std::endl;
    // offsets
    for (size_t ii=0; ii<offset.size(); ii++)
    {
       WriteBinaryOrASCII(os, buf, offset[ii], "\n", format);
    }
-   if (format != VTKFormat::ASCII)
-   {
-      WriteBase64WithSizeAndClear(os, buf, compression_level);
-   }
+   end_array();
    os << "</DataArray>" << std::endl;
-   os << "<DataArray type=\"UInt8\" Name=\"types\" format=\""
-      << fmt_str << "\">" << std::endl;
+   os << "<DataArray type=\"UInt8\" Name=\"types\" "
+      << format_attr() << ">" << std::endl;
    // cell types
    const int *vtk_geom_map =
       high_order_output ? VTKGeometry::HighOrderMap : VTKGeometry::Map;
@@ -12855,16 +13016,13 @@ void Mesh::PrintVTU(std::ostream &os, int ref, VTKFormat format,
          }
       }
    }
-   if (format != VTKFormat::ASCII)
-   {
-      WriteBase64WithSizeAndClear(os, buf, compression_level);
-   }
+   end_array();
    os << "</DataArray>" << std::endl;
    os << "</Cells>" << std::endl;
 
    os << "<CellData Scalars=\"attribute\">" << std::endl;
-   os << "<DataArray type=\"Int32\" Name=\"attribute\" format=\""
-      << fmt_str << "\">" << std::endl;
+   os << "<DataArray type=\"Int32\" Name=\"attribute\" "
+      << format_attr() << ">" << std::endl;
    for (int i = 0; i < ne; i++)
    {
       int attr = bdr_elements ? GetBdrAttribute(i) : GetAttribute(i);
@@ -12883,10 +13041,7 @@ void Mesh::PrintVTU(std::ostream &os, int ref, VTKFormat format,
          }
       }
    }
-   if (format != VTKFormat::ASCII)
-   {
-      WriteBase64WithSizeAndClear(os, buf, compression_level);
-   }
+   end_array();
    os << "</DataArray>" << std::endl;
    os << "</CellData>" << std::endl;
 }
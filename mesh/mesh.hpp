@@ -346,6 +346,10 @@ protected:
    // Readers for different mesh formats, used in the Load() method.
    // The implementations of these methods are in mesh_readers.cpp.
    void ReadMFEMMesh(std::istream &input, int version, int &curved);
+   void ReadMFEMBinaryMesh(std::istream &input, int &curved);
+   // Read @a n elements written by PrintBinaryElements().
+   void ReadBinaryElements(bin_io::BinaryReader &reader,
+                           Array<Element*> &elems, int n);
    void ReadLineMesh(std::istream &input);
    void ReadNetgen2DMesh(std::istream &input, int &curved);
    void ReadNetgen3DMesh(std::istream &input);
@@ -363,6 +367,8 @@ protected:
                       bool spacing=false, bool nc=false);
    void ReadInlineMesh(std::istream &input, bool generate_edges = false);
    void ReadGmshMesh(std::istream &input, int &curved, int &read_gf);
+   // Read the Gmsh 4.1 binary format, following the $MeshFormat header
+   void ReadGmshV41BinaryMesh(std::istream &input);
 
    /* Note NetCDF (optional library) is used for reading cubit files */
 #ifdef MFEM_USE_NETCDF
@@ -639,6 +645,11 @@ protected:
                 std::string section_delimiter = "",
                 const std::string &comments = "") const;
 
+   /// Write the geometries, attributes and vertices of @a elems as contiguous
+   /// arrays, see PrintBinary().
+   static void PrintBinaryElements(bin_io::BinaryWriter &writer,
+                                   const Array<Element*> &elems);
+
    /// @brief Creates a mesh for the parallelepiped [0,sx]x[0,sy]x[0,sz],
    /// divided into nx*ny*nz hexahedra if @a type = HEXAHEDRON or into
    /// 6*nx*ny*nz tetrahedrons if @a type = TETRAHEDRON.
@@ -2262,8 +2273,16 @@ public:
 
    /// @note The returned array should be deleted by the caller.
    int *CartesianPartitioning(int nxyz[]);
-   /// @note The returned array should be deleted by the caller.
-   int *GeneratePartitioning(int nparts, int part_method = 1);
+   /** @brief Partition the mesh into @a nparts parts with METIS.
+
+       If @a elem_weights is given, the parts balance the sum of the weights
+       of their elements instead of their number of elements, e.g. with the
+       costs from FiniteElementSpace::GetElementCosts() for variable-order
+       spaces, or with measured per-element costs.
+
+       @note The returned array should be deleted by the caller. */
+   int *GeneratePartitioning(int nparts, int part_method = 1,
+                             const Vector *elem_weights = nullptr);
    /// @todo This method needs a proper description
    void CheckPartitioning(int *partitioning_);
 
@@ -2583,6 +2602,18 @@ public:
    /// used for ASCII output.
    virtual void Save(const std::string &fname, int precision=16) const;
 
+   /** @brief Print the mesh to the given stream using the binary MFEM mesh
+       format, which is read by the Mesh constructors and Load().
+
+       The element geometries, attributes and vertices, and the vertex
+       coordinates, are stored as contiguous arrays, together with the byte
+       order and the size of real_t. The nodes of curved meshes are saved with
+       GridFunction::SaveBinary(). When reading from a mapped_ifstream, the
+       vertex coordinates and the nodes are used in place, without copying.
+       Only conforming, non-NURBS meshes are supported. The stream should be
+       opened in binary mode. */
+   void PrintBinary(std::ostream &os) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &os) const;
@@ -2599,13 +2630,16 @@ public:
    /** Print the mesh in VTU format. The parameter ref > 0 specifies an element
        subdivision number (useful for high order fields and curved meshes).
        If @a bdr_elements is true, then output (only) the boundary elements,
-       otherwise output only the non-boundary elements. */
+       otherwise output only the non-boundary elements. If @a appended is not
+       NULL (binary formats only), the data arrays are stored in it instead of
+       inline, and the caller writes it after the UnstructuredGrid element. */
    void PrintVTU(std::ostream &os,
                  int ref=1,
                  VTKFormat format=VTKFormat::ASCII,
                  bool high_order_output=false,
                  int compression_level=0,
-                 bool bdr_elements=false);
+                 bool bdr_elements=false,
+                 VTKAppendedData *appended=nullptr);
    /** Print the mesh in VTU format with file name fname. */
    virtual void PrintVTU(std::string fname,
                          VTKFormat format=VTKFormat::ASCII,
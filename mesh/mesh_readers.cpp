@@ -17,7 +17,10 @@
 #include "../general/tinyxml2.h"
 #include "gmsh.hpp"
 
+#include <chrono>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <cstdio>
 #include <vector>
 #include <algorithm>
@@ -131,6 +134,93 @@ void Mesh::ReadMFEMMesh(std::istream &input, int version, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+void Mesh::ReadMFEMBinaryMesh(std::istream &input, int &curved)
+{
+   // Read MFEM binary mesh v1.0 format, see PrintBinary()
+   bin_io::BinaryReader reader(input);
+   reader.ReadHeader();
+   Dim = reader.Read<int32_t>();
+   spaceDim = reader.Read<int32_t>();
+   NumOfElements = reader.Read<int32_t>();
+   NumOfBdrElements = reader.Read<int32_t>();
+   NumOfVertices = reader.Read<int32_t>();
+   curved = reader.Read<int32_t>();
+   const bool set_names = reader.Read<int32_t>();
+   reader.Read<int32_t>(); // reserved
+
+   ReadBinaryElements(reader, elements, NumOfElements);
+   ReadBinaryElements(reader, boundary, NumOfBdrElements);
+
+   if (set_names)
+   {
+      for (AttributeSets *sets : {&attribute_sets, &bdr_attribute_sets})
+      {
+         std::istringstream iss(reader.ReadString());
+         sets->attr_sets.Load(iss);
+         sets->attr_sets.SortAll();
+         sets->attr_sets.UniqueAll();
+      }
+   }
+
+   if (!curved)
+   {
+      const size_t n = 3*size_t(NumOfVertices);
+      const real_t *data = reader.MapArray<real_t>(n);
+      if (data)
+      {
+         // Use the data in place, e.g. from a memory-mapped file
+         vertices.MakeRef(reinterpret_cast<Vertex*>(const_cast<real_t*>(data)),
+                          NumOfVertices);
+      }
+      else
+      {
+         vertices.SetSize(NumOfVertices);
+         reader.ReadArray(reinterpret_cast<real_t*>(vertices.GetData()), n);
+      }
+   }
+   else
+   {
+      // The nodes are read by Loader()
+      vertices.SetSize(NumOfVertices);
+   }
+
+   if (remove_unused_vertices) { RemoveUnusedVertices(); }
+}
+
+void Mesh::ReadBinaryElements(bin_io::BinaryReader &reader,
+                              Array<Element*> &elems, int n)
+{
+   // The arrays are used in place if possible, otherwise copied to 'buf'
+   const auto read_array = [&reader](auto &buf, size_t size)
+   {
+      using T = typename std::decay_t<decltype(buf)>::value_type;
+      const T *data = reader.template MapArray<T>(size);
+      if (data) { return data; }
+      buf.resize(size);
+      reader.ReadArray(buf.data(), size);
+      return static_cast<const T*>(buf.data());
+   };
+
+   const int64_t nconn = reader.Read<int64_t>();
+   std::vector<uint8_t> geom_buf;
+   std::vector<int32_t> attr_buf, conn_buf;
+   const uint8_t *geom = read_array(geom_buf, n);
+   const int32_t *attr = read_array(attr_buf, n);
+   const int32_t *conn = read_array(conn_buf, nconn);
+   elems.SetSize(n);
+   int64_t offset = 0;
+   for (int i = 0; i < n; i++)
+   {
+      MFEM_VERIFY(geom[i] < Geometry::NUM_GEOMETRIES, "invalid mesh file");
+      elems[i] = NewElement(geom[i]);
+      const int nv = elems[i]->GetNVertices();
+      MFEM_VERIFY(offset + nv <= nconn, "invalid mesh file");
+      elems[i]->SetVertices(conn + offset);
+      elems[i]->SetAttribute(attr[i]);
+      offset += nv;
+   }
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
@@ -1513,6 +1603,71 @@ void Mesh::ReadInlineMesh(std::istream &input, bool generate_edges)
    }
 }
 
+// Read the $PhysicalNames section of a Gmsh file: the names of the physical
+// groups by dimension and physical tag
+static void ReadGmshPhysicalNames(std::istream &input,
+                                  map<int,map<int,std::string> > &names)
+{
+   int num_names = 0;
+   int mdim,num;
+   string name;
+   input >> num_names;
+   for (int i=0; i < num_names; i++)
+   {
+      input >> mdim >> num;
+      getline(input, name);
+
+      // Trim leading white space
+      while (!name.empty() &&
+             (*name.begin() == ' ' || *name.begin() == '\t'))
+      { name.erase(0,1);}
+
+      // Trim trailing white space
+      while (!name.empty() &&
+             (*name.rbegin() == ' ' || *name.rbegin() == '\t' ||
+              *name.rbegin() == '\n' || *name.rbegin() == '\r'))
+      { name.resize(name.length()-1);}
+
+      // Remove enclosing quotes
+      if ( (*name.begin() == '"' || *name.begin() == '\'') &&
+           (*name.rbegin() == '"' || *name.rbegin() == '\''))
+      {
+         name = name.substr(1,name.length()-2);
+      }
+
+      names[mdim][num] = name;
+   }
+}
+
+// Create the attribute sets of the named physical groups of dimension dim
+// (elements) and dim-1 (boundary elements)
+static void AddGmshAttributeSets(map<int,map<int,std::string> > &names,
+                                 int dim, AttributeSets &attribute_sets,
+                                 AttributeSets &bdr_attribute_sets)
+{
+   if (names.empty()) { return; }
+
+   // Process boundary attribute set names
+   for (auto const &bdr_attr : names[dim-1])
+   {
+      if (!bdr_attribute_sets.AttributeSetExists(bdr_attr.second))
+      {
+         bdr_attribute_sets.CreateAttributeSet(bdr_attr.second);
+      }
+      bdr_attribute_sets.AddToAttributeSet(bdr_attr.second, bdr_attr.first);
+   }
+
+   // Process element attribute set names
+   for (auto const &attr : names[dim])
+   {
+      if (!attribute_sets.AttributeSetExists(attr.second))
+      {
+         attribute_sets.CreateAttributeSet(attr.second);
+      }
+      attribute_sets.AddToAttributeSet(attr.second, attr.first);
+   }
+}
+
 void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
 {
    string buff;
@@ -1523,6 +1678,14 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
    {
       MFEM_ABORT("Gmsh file version < 2.2");
    }
+   if (version >= 4.0)
+   {
+      MFEM_VERIFY(version > 4.05 && binary,
+                  "Gmsh file : version 4 is supported in the 4.1 binary "
+                  "format only, use the 2.2 format otherwise");
+      MFEM_VERIFY(dsize == sizeof(uint64_t),
+                  "Gmsh file : data-size != sizeof(uint64_t)");
+   }
    if (dsize != sizeof(double))
    {
       MFEM_ABORT("Gmsh file : dsize != sizeof(double)");
@@ -1538,6 +1701,11 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
          MFEM_ABORT("Gmsh file : wrong binary format");
       }
    }
+   if (version >= 4.0)
+   {
+      ReadGmshV41BinaryMesh(input);
+      return;
+   }
 
    // A map between a serial number of the vertex and its number in the file
    // (there may be gaps in the numbering, and also Gmsh enumerates vertices
@@ -2676,35 +2844,7 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
       } // section '$Elements'
       else if (buff == "$PhysicalNames") // Named element sets
       {
-         int num_names = 0;
-         int mdim,num;
-         string name;
-         input >> num_names;
-         for (int i=0; i < num_names; i++)
-         {
-            input >> mdim >> num;
-            getline(input, name);
-
-            // Trim leading white space
-            while (!name.empty() &&
-                   (*name.begin() == ' ' || *name.begin() == '\t'))
-            { name.erase(0,1);}
-
-            // Trim trailing white space
-            while (!name.empty() &&
-                   (*name.rbegin() == ' ' || *name.rbegin() == '\t' ||
-                    *name.rbegin() == '\n' || *name.rbegin() == '\r'))
-            { name.resize(name.length()-1);}
-
-            // Remove enclosing quotes
-            if ( (*name.begin() == '"' || *name.begin() == '\'') &&
-                 (*name.rbegin() == '"' || *name.rbegin() == '\''))
-            {
-               name = name.substr(1,name.length()-2);
-            }
-
-            phys_names_by_dim[mdim][num] = name;
-         }
+         ReadGmshPhysicalNames(input, phys_names_by_dim);
       }
       else if (buff == "$Periodic") // Reading master/slave node pairs
       {
@@ -2806,39 +2946,390 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
    } // we reach the end of the file
 
    // Process set names
-   if (phys_names_by_dim.size() > 0)
+   AddGmshAttributeSets(phys_names_by_dim, Dim, attribute_sets,
+                        bdr_attribute_sets);
+
+   this->RemoveUnusedVertices();
+   this->FinalizeTopology();
+
+   // If a high order coordinate field was created project it onto the mesh
+   if (mesh_order > 1)
+   {
+      SetCurvature(mesh_order, periodic, spaceDim, Ordering::byVDIM);
+
+      VectorGridFunctionCoefficient NodesCoef(&Nodes_gf);
+      Nodes->ProjectCoefficient(NodesCoef);
+   }
+}
+
+void Mesh::ReadGmshV41BinaryMesh(std::istream &input)
+{
+   // The sections are read in large chunks directly into pre-sized arrays,
+   // the node tags are resolved with a flat index and the elements of each
+   // entity block are created in parallel (with OpenMP). Only first order
+   // elements are supported, see ReadGmshMesh() for the 2.2 format.
+   using Clock = std::chrono::steady_clock;
+   const auto start = Clock::now();
+   size_t num_bytes = 0;
+   const auto read = [&](void *data, size_t bytes)
+   {
+      input.read(static_cast<char*>(data), bytes);
+      MFEM_VERIFY(input, "Gmsh file : unexpected end of binary data");
+      num_bytes += bytes;
+   };
+   const auto read_size = [&]()
+   {
+      uint64_t value;
+      read(&value, sizeof(value));
+      return value;
+   };
+   const auto read_int = [&]()
+   {
+      int32_t value;
+      read(&value, sizeof(value));
+      return int(value);
+   };
+   // Up to 'chunk' bytes of a section are read at once
+   const size_t chunk = size_t(1) << 26;
+
+   // Physical tag (attribute) of each entity, by entity dimension
+   map<int,int> entity_phys[4];
+   map<int,map<int,std::string> > phys_names_by_dim;
+
+   // Node tag to vertex index: a flat array if the tags are dense enough,
+   // otherwise the sorted (tag, index) pairs
+   uint64_t min_tag = 0, max_tag = 0;
+   vector<int> tag_index;
+   vector<pair<uint64_t,int>> sorted_tags;
+   const auto node_index = [&](uint64_t tag)
+   {
+      if (!tag_index.empty())
+      {
+         return (tag < min_tag || tag > max_tag) ? -1 : tag_index[tag - min_tag];
+      }
+      const auto it = std::lower_bound(sorted_tags.begin(), sorted_tags.end(),
+                                       make_pair(tag, -1));
+      return (it == sorted_tags.end() || it->first != tag) ? -1 : it->second;
+   };
+
+   // Element blocks of each dimension, with resolved vertex indices
+   struct ElementBlock
+   {
+      Geometry::Type geom;
+      int attr;
+      vector<int> vert;
+   };
+   vector<ElementBlock> blocks[4];
+   bool has_nonpositive_phys_domain = false;
+   bool has_positive_phys_domain = false;
+   size_t num_read_elements = 0;
+
+   string buff;
+   while (input >> buff)
    {
-      // Process boundary attribute set names
-      for (auto const &bdr_attr : phys_names_by_dim[Dim-1])
+      if (buff == "$PhysicalNames") // ASCII also in binary files
       {
-         if (!bdr_attribute_sets.AttributeSetExists(bdr_attr.second))
+         ReadGmshPhysicalNames(input, phys_names_by_dim);
+      }
+      else if (buff == "$Entities")
+      {
+         getline(input, buff);
+         uint64_t num_entities[4];
+         for (int d = 0; d < 4; d++) { num_entities[d] = read_size(); }
+         vector<int32_t> tags;
+         for (int d = 0; d < 4; d++)
          {
-            bdr_attribute_sets.CreateAttributeSet(bdr_attr.second);
+            for (uint64_t e = 0; e < num_entities[d]; e++)
+            {
+               const int tag = read_int();
+               double bbox[6];
+               read(bbox, (d == 0 ? 3 : 6)*sizeof(double));
+               tags.resize(read_size());
+               read(tags.data(), tags.size()*sizeof(int32_t));
+               // Use the first physical group, as in the 2.2 format
+               entity_phys[d][tag] = tags.empty() ? 0 : std::abs(tags[0]);
+               if (d > 0)
+               {
+                  // Skip the bounding entities
+                  tags.resize(read_size());
+                  read(tags.data(), tags.size()*sizeof(int32_t));
+               }
+            }
          }
-         bdr_attribute_sets.AddToAttributeSet(bdr_attr.second, bdr_attr.first);
       }
+      else if (buff == "$Nodes")
+      {
+         getline(input, buff);
+         const uint64_t num_blocks = read_size();
+         const uint64_t num_nodes = read_size();
+         min_tag = read_size();
+         max_tag = read_size();
+         MFEM_VERIFY(num_nodes < uint64_t(std::numeric_limits<int>::max()),
+                     "Gmsh file : too many nodes");
+         NumOfVertices = int(num_nodes);
+         vertices.SetSize(NumOfVertices);
+         vector<uint64_t> tags(num_nodes);
+         vector<double> buf;
+
+         size_t offset = 0;
+         for (uint64_t b = 0; b < num_blocks; b++)
+         {
+            const int entity_dim = read_int();
+            read_int(); // entity tag
+            const int parametric = read_int();
+            const size_t n = read_size();
+            MFEM_VERIFY(offset + n <= num_nodes, "Gmsh file : invalid $Nodes");
+            read(tags.data() + offset, n*sizeof(uint64_t));
+
+            // x, y, z, followed by the parametric coordinates, if any
+            const size_t stride = 3 + (parametric ? entity_dim : 0);
+            const size_t chunk_nodes = std::max<size_t>(
+                                          1, chunk/(stride*sizeof(double)));
+            for (size_t i0 = 0; i0 < n; i0 += chunk_nodes)
+            {
+               const size_t m = std::min(chunk_nodes, n - i0);
+               buf.resize(m*stride);
+               read(buf.data(), buf.size()*sizeof(double));
+               Vertex *v = vertices.GetData() + offset + i0;
+#ifdef MFEM_USE_OPENMP
+               #pragma omp parallel for
+#endif
+               for (long long i = 0; i < (long long)m; i++)
+               {
+                  v[i](0) = buf[i*stride+0];
+                  v[i](1) = buf[i*stride+1];
+                  v[i](2) = buf[i*stride+2];
+               }
+            }
+            offset += n;
+         }
+         MFEM_VERIFY(offset == num_nodes, "Gmsh file : invalid $Nodes");
 
-      // Process element attribute set names
-      for (auto const &attr : phys_names_by_dim[Dim])
+         // Flat index if the tags use at most a fourth of the range
+         if (max_tag - min_tag < 4*num_nodes + 1024)
+         {
+            tag_index.assign(max_tag - min_tag + 1, -1);
+            for (size_t i = 0; i < num_nodes; i++)
+            {
+               MFEM_VERIFY(tags[i] >= min_tag && tags[i] <= max_tag,
+                           "Gmsh file : invalid node tag");
+               int &index = tag_index[tags[i] - min_tag];
+               MFEM_VERIFY(index < 0,
+                           "Gmsh file : vertices indices are not unique");
+               index = int(i);
+            }
+         }
+         else
+         {
+            sorted_tags.resize(num_nodes);
+            for (size_t i = 0; i < num_nodes; i++)
+            {
+               sorted_tags[i] = make_pair(tags[i], int(i));
+            }
+            std::sort(sorted_tags.begin(), sorted_tags.end());
+            for (size_t i = 1; i < num_nodes; i++)
+            {
+               MFEM_VERIFY(sorted_tags[i].first != sorted_tags[i-1].first,
+                           "Gmsh file : vertices indices are not unique");
+            }
+         }
+      }
+      else if (buff == "$Elements")
       {
-         if (!attribute_sets.AttributeSetExists(attr.second))
+         MFEM_VERIFY(vertices.Size() == NumOfVertices && NumOfVertices > 0,
+                     "Gmsh file : $Nodes must precede $Elements");
+         getline(input, buff);
+         const uint64_t num_blocks = read_size();
+         read_size(); // number of elements
+         read_size(); // min element tag
+         read_size(); // max element tag
+         vector<uint64_t> buf;
+
+         for (uint64_t b = 0; b < num_blocks; b++)
          {
-            attribute_sets.CreateAttributeSet(attr.second);
+            const int entity_dim = read_int();
+            const int entity_tag = read_int();
+            const int type = read_int();
+            const size_t n = read_size();
+            MFEM_VERIFY(entity_dim >= 0 && entity_dim <= 3,
+                        "Gmsh file : invalid entity dimension");
+
+            Geometry::Type geom;
+            int nv;
+            switch (type)
+            {
+               case 15: geom = Geometry::POINT; nv = 1; break;
+               case 1: geom = Geometry::SEGMENT; nv = 2; break;
+               case 2: geom = Geometry::TRIANGLE; nv = 3; break;
+               case 3: geom = Geometry::SQUARE; nv = 4; break;
+               case 4: geom = Geometry::TETRAHEDRON; nv = 4; break;
+               case 5: geom = Geometry::CUBE; nv = 8; break;
+               case 6: geom = Geometry::PRISM; nv = 6; break;
+               case 7: geom = Geometry::PYRAMID; nv = 5; break;
+               default:
+                  MFEM_ABORT("Gmsh file : element type " << type << " is not"
+                             " supported in the 4.1 format, only first order"
+                             " elements are. Use the 2.2 format instead.");
+                  geom = Geometry::INVALID; nv = 0;
+            }
+
+            const auto phys = entity_phys[entity_dim].find(entity_tag);
+            int attr = (phys == entity_phys[entity_dim].end()) ? 0 :
+                       phys->second;
+            // Non-positive attributes are handled as in the 2.2 format
+            if (attr <= 0)
+            {
+               has_nonpositive_phys_domain = true;
+               attr = 1;
+            }
+            else
+            {
+               has_positive_phys_domain = true;
+            }
+
+            blocks[entity_dim].push_back({geom, attr, vector<int>(n*nv)});
+            int *vert = blocks[entity_dim].back().vert.data();
+            const size_t stride = 1 + nv; // element tag and node tags
+            const size_t chunk_elems = std::max<size_t>(
+                                          1, chunk/(stride*sizeof(uint64_t)));
+            for (size_t i0 = 0; i0 < n; i0 += chunk_elems)
+            {
+               const size_t m = std::min(chunk_elems, n - i0);
+               buf.resize(m*stride);
+               read(buf.data(), buf.size()*sizeof(uint64_t));
+               int *v = vert + i0*nv;
+               int missing = 0;
+#ifdef MFEM_USE_OPENMP
+               #pragma omp parallel for reduction(+:missing)
+#endif
+               for (long long i = 0; i < (long long)m; i++)
+               {
+                  for (int j = 0; j < nv; j++)
+                  {
+                     const int index = node_index(buf[i*stride+1+j]);
+                     if (index < 0) { missing++; }
+                     v[i*nv+j] = index;
+                  }
+               }
+               MFEM_VERIFY(missing == 0,
+                           "Gmsh file : vertex index doesn't exist");
+            }
+            num_read_elements += n;
+         }
+      }
+      else if (buff == "$Periodic" || buff == "$PartitionedEntities" ||
+               buff == "$Parametrizations")
+      {
+         MFEM_ABORT("Gmsh file : section " << buff << " is not supported in"
+                    " the 4.1 format");
+      }
+      else if (buff.size() > 1 && buff[0] == '$' &&
+               buff.compare(0, 4, "$End") != 0)
+      {
+         // Skip any other section, e.g. $NodeData, up to its end tag
+         const string end_tag = "$End" + buff.substr(1);
+         while (getline(input, buff))
+         {
+            filter_dos(buff);
+            if (buff == end_tag) { break; }
          }
-         attribute_sets.AddToAttributeSet(attr.second, attr.first);
       }
    }
 
+   if (has_positive_phys_domain && has_nonpositive_phys_domain)
+   {
+      MFEM_ABORT("Non-positive element attribute in Gmsh mesh!\n"
+                 "By default Gmsh sets element tags (attributes)"
+                 " to '0' but MFEM requires that they be"
+                 " positive integers.\n"
+                 "Use \"Physical Curve\", \"Physical Surface\","
+                 " or \"Physical Volume\" to set tags/attributes"
+                 " for all curves, surfaces, or volumes in your"
+                 " Gmsh geometry to values which are >= 1.");
+   }
+   else if (has_nonpositive_phys_domain)
+   {
+      mfem::out << "\nGmsh reader: all element attributes were zero.\n"
+                << "MFEM only supports positive element attributes.\n"
+                << "Setting element attributes to 1.\n\n";
+   }
+
+   // The elements of the highest dimension, and the boundary elements of the
+   // dimension below, discarding the others
+   Dim = 3;
+   while (Dim > 0 && blocks[Dim].empty()) { Dim--; }
+   MFEM_VERIFY(Dim > 0, "Gmsh file : no elements found");
+   const auto make_elements = [this](const vector<ElementBlock> &elem_blocks,
+                                     Array<Element*> &elems)
+   {
+      size_t n = 0;
+      for (const ElementBlock &b : elem_blocks)
+      {
+         n += b.vert.size()/Geometry::NumVerts[b.geom];
+      }
+      MFEM_VERIFY(n < size_t(std::numeric_limits<int>::max()),
+                  "Gmsh file : too many elements");
+      elems.SetSize(int(n));
+      int offset = 0;
+      for (const ElementBlock &b : elem_blocks)
+      {
+         const int nv = Geometry::NumVerts[b.geom];
+         const int nb = int(b.vert.size()/nv);
+         // The element memory pools are not thread-safe
+#if defined(MFEM_USE_OPENMP) && !defined(MFEM_USE_MEMALLOC)
+         #pragma omp parallel for
+#endif
+         for (int i = 0; i < nb; i++)
+         {
+            Element *el = NewElement(b.geom);
+            el->SetVertices(b.vert.data() + size_t(i)*nv);
+            el->SetAttribute(b.attr);
+            elems[offset + i] = el;
+         }
+         offset += nb;
+      }
+   };
+   make_elements(blocks[Dim], elements);
+   make_elements(blocks[Dim-1], boundary);
+   NumOfElements = elements.Size();
+   NumOfBdrElements = boundary.Size();
+
+   // Set spaceDim from the bounding box, see ReadGmshMesh()
+   real_t bb_min[3], bb_max[3];
+   for (int d = 0; d < 3; d++)
+   {
+      bb_min[d] = std::numeric_limits<real_t>::max();
+      bb_max[d] = std::numeric_limits<real_t>::lowest();
+   }
+   for (int i = 0; i < NumOfVertices; i++)
+   {
+      for (int d = 0; d < 3; d++)
+      {
+         bb_min[d] = std::min(bb_min[d], vertices[i](d));
+         bb_max[d] = std::max(bb_max[d], vertices[i](d));
+      }
+   }
+   const real_t bb_tol = 1e-14;
+   const real_t bb_size = std::max(bb_max[0] - bb_min[0],
+                                   std::max(bb_max[1] - bb_min[1],
+                                            bb_max[2] - bb_min[2]));
+   spaceDim = 1;
+   if (bb_max[1] - bb_min[1] > bb_size * bb_tol) { spaceDim++; }
+   if (bb_max[2] - bb_min[2] > bb_size * bb_tol) { spaceDim++; }
+
+   AddGmshAttributeSets(phys_names_by_dim, Dim, attribute_sets,
+                        bdr_attribute_sets);
+
    this->RemoveUnusedVertices();
    this->FinalizeTopology();
 
-   // If a high order coordinate field was created project it onto the mesh
-   if (mesh_order > 1)
+   if (GetEnv("MFEM_GMSH_STATS"))
    {
-      SetCurvature(mesh_order, periodic, spaceDim, Ordering::byVDIM);
-
-      VectorGridFunctionCoefficient NodesCoef(&Nodes_gf);
-      Nodes->ProjectCoefficient(NodesCoef);
+      const std::chrono::duration<double> time = Clock::now() - start;
+      mfem::out << "Gmsh reader: " << NumOfVertices << " nodes, "
+                << num_read_elements << " elements, " << num_bytes/1e6
+                << " MB of binary data in " << time.count() << " s ("
+                << num_bytes/1e6/time.count() << " MB/s)\n";
    }
 }
 
@@ -15,6 +15,7 @@
 
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
+#include "../general/binaryio.hpp"
 #include "../general/sets.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/text.hpp"
@@ -4044,6 +4045,26 @@ void ParMesh::Rebalance(const Array<int> &partition)
    RebalanceImpl(&partition);
 }
 
+void ParMesh::RebalanceDiffusive(real_t max_migration, int steps,
+                                 const Vector *elem_weights)
+{
+   MFEM_VERIFY(Nonconforming(), "Load balancing is currently not supported"
+               " for conforming meshes.");
+   Array<int> partition;
+   pncmesh->GetDiffusivePartition(max_migration, steps, partition,
+                                  elem_weights);
+   RebalanceImpl(&partition);
+}
+
+void ParMesh::RebalanceWeighted(const Vector &elem_weights)
+{
+   MFEM_VERIFY(Nonconforming(), "Load balancing is currently not supported"
+               " for conforming meshes.");
+   Array<int> partition;
+   pncmesh->GetWeightedPartition(elem_weights, partition);
+   RebalanceImpl(&partition);
+}
+
 void ParMesh::RebalanceImpl(const Array<int> *partition)
 {
    if (Conforming())
@@ -6432,6 +6453,233 @@ void ParMesh::ParPrint(ostream &os, const std::string &comments) const
    os << "\nmfem_mesh_end" << endl;
 }
 
+void ParMesh::SaveCheckpoint(std::ostream &os) const
+{
+   MFEM_VERIFY(!NURBSext && Conforming(),
+               "checkpoints support conforming meshes only");
+
+   const auto write_array = [](bin_io::BinaryWriter &writer,
+                               const Array<int> &a)
+   {
+      writer.Write(int32_t(a.Size()));
+      writer.WriteArray(a.GetData(), a.Size());
+   };
+
+   os << "MFEM binary parallel mesh v1.0\n";
+   {
+      bin_io::BinaryWriter writer(os);
+      writer.WriteHeader();
+      writer.Write(int32_t(NRanks));
+      writer.Write(int32_t(MyRank));
+      writer.Write(int32_t(meshgen)); // the global 'meshgen'
+      writer.Write(int32_t(have_face_nbr_data));
+   }
+
+   // The local mesh, including the nodes of curved meshes
+   PrintBinary(os);
+
+   bin_io::BinaryWriter writer(os);
+   writer.WriteHeader();
+   gtopo.Save(writer);
+
+   // The shared entities and their local indices
+   write_array(writer, svert_lvert);
+   write_array(writer, sedge_ledge);
+   write_array(writer, sface_lface);
+   group_svert.Save(writer);
+   group_sedge.Save(writer);
+   group_stria.Save(writer);
+   group_squad.Save(writer);
+   Array<int> sedge_vert(2*shared_edges.Size());
+   for (int i = 0; i < shared_edges.Size(); i++)
+   {
+      const int *v = shared_edges[i]->GetVertices();
+      sedge_vert[2*i] = v[0];
+      sedge_vert[2*i+1] = v[1];
+   }
+   write_array(writer, sedge_vert);
+   static_assert(sizeof(Vert3) == 3*sizeof(int) && sizeof(Vert4) == 4*sizeof(int),
+                 "invalid Vert3/Vert4 layout");
+   writer.Write(int32_t(shared_trias.Size()));
+   writer.WriteArray(reinterpret_cast<const int*>(shared_trias.GetData()),
+                     3*size_t(shared_trias.Size()));
+   writer.Write(int32_t(shared_quads.Size()));
+   writer.WriteArray(reinterpret_cast<const int*>(shared_quads.GetData()),
+                     4*size_t(shared_quads.Size()));
+
+   // The refinement flags of the tetrahedra, consistent across the processors,
+   // see MarkTetMeshForRefinement()
+   Array<int> tet_flags;
+   if (Dim == 3 && (meshgen & 1))
+   {
+      tet_flags.SetSize(NumOfElements);
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         tet_flags[i] = (elements[i]->GetType() == Element::TETRAHEDRON) ?
+                        static_cast<const Tetrahedron*>(elements[i])->
+                        GetRefinementFlag() : 0;
+      }
+   }
+   write_array(writer, tet_flags);
+
+   if (have_face_nbr_data)
+   {
+      write_array(writer, face_nbr_group);
+      write_array(writer, face_nbr_elements_offset);
+      write_array(writer, face_nbr_vertices_offset);
+      writer.Write(int32_t(face_nbr_elements.Size()));
+      PrintBinaryElements(writer, face_nbr_elements);
+      writer.Write(int32_t(face_nbr_vertices.Size()));
+      writer.WriteArray(reinterpret_cast<const real_t*>(face_nbr_vertices.GetData()),
+                        3*size_t(face_nbr_vertices.Size()));
+      send_face_nbr_elements.Save(writer);
+      send_face_nbr_vertices.Save(writer);
+      writer.Write(int32_t(face_nbr_el_ori != nullptr));
+      if (face_nbr_el_ori) { face_nbr_el_ori->Save(writer); }
+
+      // The face-neighbor element and orientation of the shared faces
+      const Array<int> &s2l_face = (Dim == 1) ? svert_lvert :
+                                   (Dim == 2) ? sedge_ledge : sface_lface;
+      Array<int> sface_info(2*s2l_face.Size());
+      for (int i = 0; i < s2l_face.Size(); i++)
+      {
+         const FaceInfo &face_info = faces_info[s2l_face[i]];
+         sface_info[2*i] = face_info.Elem2No;
+         sface_info[2*i+1] = face_info.Elem2Inf;
+      }
+      write_array(writer, sface_info);
+   }
+   os.flush();
+}
+
+ParMesh ParMesh::LoadCheckpoint(MPI_Comm comm, std::istream &input)
+{
+   ParMesh pmesh;
+   pmesh.MyComm = comm;
+   MPI_Comm_size(comm, &pmesh.NRanks);
+   MPI_Comm_rank(comm, &pmesh.MyRank);
+   pmesh.gtopo.SetComm(comm);
+   pmesh.ReadCheckpoint(input);
+   return pmesh;
+}
+
+void ParMesh::ReadCheckpoint(std::istream &input)
+{
+   const auto read_array = [](bin_io::BinaryReader &reader, Array<int> &a)
+   {
+      a.SetSize(reader.Read<int32_t>());
+      reader.ReadArray(a.GetData(), a.Size());
+   };
+
+   string ident;
+   skip_comment_lines(input, '#');
+   getline(input, ident);
+   filter_dos(ident);
+   MFEM_VERIFY(ident == "MFEM binary parallel mesh v1.0",
+               "input stream is not a ParMesh checkpoint");
+   int global_meshgen;
+   bool face_nbr_data;
+   {
+      bin_io::BinaryReader reader(input);
+      reader.ReadHeader();
+      const int nranks = reader.Read<int32_t>();
+      const int rank = reader.Read<int32_t>();
+      MFEM_VERIFY(nranks == NRanks && rank == MyRank,
+                  "the checkpoint of rank " << rank << " of " << nranks
+                  << " cannot be loaded by rank " << MyRank << " of " << NRanks);
+      global_meshgen = reader.Read<int32_t>();
+      face_nbr_data = reader.Read<int32_t>();
+   }
+
+   // The topology of the local mesh is finalized by Loader(). The mesh was
+   // finalized when it was saved, so Finalize() is not called.
+   Loader(input, 1);
+   meshgen = global_meshgen;
+
+   bin_io::BinaryReader reader(input);
+   reader.ReadHeader();
+   gtopo.Load(reader);
+
+   read_array(reader, svert_lvert);
+   read_array(reader, sedge_ledge);
+   read_array(reader, sface_lface);
+   group_svert.Load(reader);
+   group_sedge.Load(reader);
+   group_stria.Load(reader);
+   group_squad.Load(reader);
+   Array<int> sedge_vert;
+   read_array(reader, sedge_vert);
+   shared_edges.SetSize(sedge_vert.Size()/2);
+   for (int i = 0; i < shared_edges.Size(); i++)
+   {
+      shared_edges[i] = new Segment(sedge_vert[2*i], sedge_vert[2*i+1], 1);
+   }
+   shared_trias.SetSize(reader.Read<int32_t>());
+   reader.ReadArray(reinterpret_cast<int*>(shared_trias.GetData()),
+                    3*size_t(shared_trias.Size()));
+   shared_quads.SetSize(reader.Read<int32_t>());
+   reader.ReadArray(reinterpret_cast<int*>(shared_quads.GetData()),
+                    4*size_t(shared_quads.Size()));
+   MFEM_VERIFY(sedge_ledge.Size() == shared_edges.Size() &&
+               sface_lface.Size() == shared_trias.Size() + shared_quads.Size(),
+               "invalid checkpoint");
+
+   Array<int> tet_flags;
+   read_array(reader, tet_flags);
+   MFEM_VERIFY(tet_flags.Size() == 0 || tet_flags.Size() == NumOfElements,
+               "invalid checkpoint");
+   for (int i = 0; i < tet_flags.Size(); i++)
+   {
+      if (elements[i]->GetType() == Element::TETRAHEDRON)
+      {
+         static_cast<Tetrahedron*>(elements[i])->SetRefinementFlag(tet_flags[i]);
+      }
+   }
+
+   // Must be called before setting the face-neighbor data, which it deletes
+   EnsureParNodes();
+
+   if (face_nbr_data)
+   {
+      read_array(reader, face_nbr_group);
+      read_array(reader, face_nbr_elements_offset);
+      read_array(reader, face_nbr_vertices_offset);
+      ReadBinaryElements(reader, face_nbr_elements, reader.Read<int32_t>());
+      face_nbr_vertices.SetSize(reader.Read<int32_t>());
+      reader.ReadArray(reinterpret_cast<real_t*>(face_nbr_vertices.GetData()),
+                       3*size_t(face_nbr_vertices.Size()));
+      send_face_nbr_elements.Load(reader);
+      send_face_nbr_vertices.Load(reader);
+      if (reader.Read<int32_t>())
+      {
+         face_nbr_el_ori.reset(new Table);
+         face_nbr_el_ori->Load(reader);
+      }
+
+      const Array<int> &s2l_face = (Dim == 1) ? svert_lvert :
+                                   (Dim == 2) ? sedge_ledge : sface_lface;
+      Array<int> sface_info;
+      read_array(reader, sface_info);
+      MFEM_VERIFY(sface_info.Size() == 2*s2l_face.Size(), "invalid checkpoint");
+      for (int i = 0; i < s2l_face.Size(); i++)
+      {
+         FaceInfo &face_info = faces_info[s2l_face[i]];
+         face_info.Elem2No = sface_info[2*i];
+         face_info.Elem2Inf = sface_info[2*i+1];
+      }
+      have_face_nbr_data = true;
+
+      if (Dim == 3)
+      {
+         BuildFaceNbrElementToFaceTable();
+      }
+      if (Nodes && GetNFaceNeighbors() > 0)
+      {
+         ExchangeFaceNbrNodes();
+      }
+   }
+}
+
 void ParMesh::PrintVTU(std::string pathname,
                        VTKFormat format,
                        bool high_order_output,
@@ -311,6 +311,9 @@ protected:
 
    void LoadSharedEntities(std::istream &input);
 
+   /// Read the data written by SaveCheckpoint(), see LoadCheckpoint().
+   void ReadCheckpoint(std::istream &input);
+
    /// If the mesh is curved, make sure 'Nodes' is ParGridFunction.
    /** Note that this method is not related to the public 'Mesh::EnsureNodes`.*/
    void EnsureParNodes();
@@ -715,11 +718,50 @@ public:
        i < GetNE(). */
    void Rebalance(const Array<int> &partition);
 
+   /** Incrementally load balance a nonconforming mesh, e.g. after a few AMR
+       steps, by moving elements only to neighbor ranks. Each rank migrates at
+       most the fraction @a max_migration of its elements, so a single call
+       only reduces the imbalance; @a steps is the number of diffusion steps
+       used to compute the transfers, see ParNCMesh::GetDiffusivePartition().
+       Compared to Rebalance(), much fewer elements (and DOFs in
+       ParFiniteElementSpace::Update()) are migrated when the imbalance is
+       small and local. If @a elem_weights is given, the weighted load is
+       balanced instead of the number of elements, see RebalanceWeighted(). */
+   void RebalanceDiffusive(real_t max_migration = 0.1, int steps = 10,
+                           const Vector *elem_weights = nullptr);
+
+   /** Load balance a nonconforming mesh by splitting the global
+       space-filling sequence of elements into parts of equal total weight.
+       The weights @a elem_weights of the local elements can be estimated with
+       FiniteElementSpace::GetElementCosts(), e.g. for variable-order spaces,
+       or measured. */
+   void RebalanceWeighted(const Vector &elem_weights);
+
    /** Save the mesh in a parallel mesh format. If @a comments is non-empty, it
        will be printed after the first line of the file, and each line should
        begin with '#'. */
    void ParPrint(std::ostream &out, const std::string &comments = "") const;
 
+   /** @brief Save the part of the mesh in the calling processor, including
+       all parallel data, in a binary checkpoint format that can be loaded with
+       LoadCheckpoint().
+
+       Each MPI rank should write to its own stream, opened in binary mode. The
+       face-neighbor data is saved if it has been set up with
+       ExchangeFaceNbrData(). Only conforming, non-NURBS meshes are supported.
+       The checkpoint is written in the same format on all platforms, see
+       Mesh::PrintBinary(). */
+   void SaveCheckpoint(std::ostream &os) const;
+
+   /** @brief Load a ParMesh from a checkpoint written by SaveCheckpoint() on
+       the same number of MPI ranks, each rank reading its own stream.
+
+       The group topology, the shared entities and the face-neighbor data are
+       read instead of being reconstructed, so no communication is needed
+       (except for the face-neighbor nodes of curved meshes). With a
+       mapped_ifstream, the vertex coordinates are used in place. */
+   static ParMesh LoadCheckpoint(MPI_Comm comm, std::istream &input);
+
    // Enable Print() to add the parallel interface as boundary (typically used
    // for visualization purposes)
    void SetPrintShared(bool print) { print_shared = print; }
@@ -2512,6 +2512,136 @@ void ParNCMesh::Rebalance(const Array<int> *custom_partition)
    Prune();
 }
 
+void ParNCMesh::GetWeightedPartition(const Vector &elem_weights,
+                                     Array<int> &partition)
+{
+   MFEM_VERIFY(elem_weights.Size() == NElements,
+               "Size of the weights array must match the number "
+               "of local mesh elements (ParMesh::GetNE()).");
+
+   // split the space-filling sequence of leaf elements into parts of equal
+   // weight; our elements are the first NElements leaves, in SFC order
+   double local_weight = 0.0, total_weight = 0.0, first_weight = 0.0;
+   for (int i = 0; i < NElements; i++) { local_weight += elem_weights(i); }
+   MPI_Allreduce(&local_weight, &total_weight, 1, MPI_DOUBLE, MPI_SUM, MyComm);
+   MPI_Scan(&local_weight, &first_weight, 1, MPI_DOUBLE, MPI_SUM, MyComm);
+   first_weight -= local_weight;
+   MFEM_VERIFY(total_weight > 0.0, "the element weights must be positive");
+
+   partition.SetSize(NElements);
+   double weight = first_weight;
+   for (int i = 0; i < NElements; i++)
+   {
+      // assign the element by the position of its midpoint in the sequence
+      const double mid = weight + 0.5*elem_weights(i);
+      partition[i] = std::min(NRanks - 1, int(mid*NRanks/total_weight));
+      weight += elem_weights(i);
+   }
+}
+
+void ParNCMesh::GetDiffusivePartition(real_t max_migration, int steps,
+                                      Array<int> &partition,
+                                      const Vector *elem_weights)
+{
+   MFEM_VERIFY(max_migration >= 0.0 && max_migration <= 1.0,
+               "invalid max_migration: " << max_migration);
+   MFEM_VERIFY(!elem_weights || elem_weights->Size() == NElements,
+               "Size of the weights array must match the number "
+               "of local mesh elements (ParMesh::GetNE()).");
+
+   partition.SetSize(NElements);
+   partition = MyRank;
+
+   auto weight = [&](int i) { return elem_weights ? (*elem_weights)(i) : 1.0; };
+
+   Array<int> neighbors;
+   NeighborProcessors(neighbors); // calls UpdateLayers()
+   const int nn = neighbors.Size();
+
+   // Diffuse the loads: in each step, move the fraction
+   // 1/(1 + max(degree_i, degree_j)) of the load difference between
+   // neighbors i and j, the same on both sides (Cybenko's scheme)
+   Array<double> send_buf(2), recv_buf(2*nn), flow(nn);
+   std::vector<MPI_Request> requests(2*nn);
+   double load = 0.0;
+   for (int i = 0; i < NElements; i++) { load += weight(i); }
+   const double own_load = load;
+   flow = 0.0;
+   for (int step = 0; step < steps; step++)
+   {
+      send_buf[0] = load;
+      send_buf[1] = nn;
+      for (int j = 0; j < nn; j++)
+      {
+         MPI_Irecv(&recv_buf[2*j], 2, MPI_DOUBLE, neighbors[j], 293, MyComm,
+                   &requests[j]);
+         MPI_Isend(send_buf.GetData(), 2, MPI_DOUBLE, neighbors[j], 293,
+                   MyComm, &requests[nn + j]);
+      }
+      MPI_Waitall(2*nn, requests.data(), MPI_STATUSES_IGNORE);
+
+      double new_load = load;
+      for (int j = 0; j < nn; j++)
+      {
+         const double alpha = 1.0/(1.0 + std::max<double>(nn, recv_buf[2*j+1]));
+         const double f = alpha*(load - recv_buf[2*j]);
+         flow[j] += f;
+         new_load -= f;
+      }
+      load = new_load;
+   }
+
+   // Our elements, as a search set for growing the sent regions inwards
+   Array<int> own_elements;
+   leaf_elements.GetSubArray(0, NElements, own_elements);
+
+   // Within the migration limit, scale the outgoing flows by the same factor
+   // and give each neighbor its share of the number of elements to send
+   const int max_send = std::min(int(max_migration*NElements),
+                                 std::max(NElements - 1, 0));
+   double total = 0.0;
+   for (int j = 0; j < nn; j++) { total += std::max(flow[j], 0.0); }
+   const double max_load = max_migration*own_load;
+   const double scale = (total > max_load) ? max_load/total : 1.0;
+
+   Array<int> front, expanded;
+   for (int j = 0; j < nn; j++)
+   {
+      if (flow[j] <= 0.0) { continue; }
+      double need = scale*flow[j];
+      int num_send = int(max_send*flow[j]/total);
+      if (num_send == 0) { continue; }
+
+      // start from the ghost elements of the neighbor and grow its region by
+      // layers of our elements that are still free; an element is sent if
+      // at least half of its weight is needed, heavier ones are skipped
+      front.SetSize(0);
+      for (int i = 0; i < ghost_layer.Size(); i++)
+      {
+         if (elements[ghost_layer[i]].rank == neighbors[j])
+         {
+            front.Append(ghost_layer[i]);
+         }
+      }
+      while (front.Size() && need > 0.0 && num_send > 0)
+      {
+         expanded.SetSize(0);
+         NeighborExpand(front, expanded, &own_elements);
+         front.SetSize(0);
+         for (int i = 0; i < expanded.Size(); i++)
+         {
+            const int index = elements[expanded[i]].index;
+            if (partition[index] != MyRank) { continue; }
+            if (need < 0.5*weight(index)) { continue; }
+            partition[index] = neighbors[j];
+            front.Append(expanded[i]);
+            need -= weight(index);
+            if (--num_send == 0 || need <= 0.0) { break; }
+         }
+      }
+   }
+}
+
 void ParNCMesh::RedistributeElements(Array<int> &new_ranks, int target_elements,
                                      bool record_comm)
 {
@@ -116,6 +116,24 @@ public:
        passed. */
    void Rebalance(const Array<int> *custom_partition = NULL);
 
+   /** Compute a partition for Rebalance() that splits the space-filling
+       sequence of leaf elements into parts of equal total weight, where
+       @a elem_weights are the (positive) costs of the local elements. */
+   void GetWeightedPartition(const Vector &elem_weights,
+                             Array<int> &partition);
+
+   /** Compute a partition for Rebalance() that reduces the load imbalance by
+       moving elements only to neighbor ranks. A first-order diffusion scheme
+       is run for @a steps iterations, each exchanging the loads with the
+       neighbor ranks only, and its accumulated flows give the load to send to
+       each neighbor. The elements are taken from the subdomain boundary
+       shared with that neighbor first. Each rank sends at most
+       @a max_migration times its number of elements. The load is the number
+       of elements, or the sum of @a elem_weights if given. */
+   void GetDiffusivePartition(real_t max_migration, int steps,
+                              Array<int> &partition,
+                              const Vector *elem_weights = NULL);
+
    // Interface for ParFiniteElementSpace
    int GetNElements() const { return NElements; }
 
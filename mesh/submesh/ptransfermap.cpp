@@ -247,7 +247,7 @@ void ParTransferMap::CommunicateSharedVdofs(Vector &f) const
       }
    }
 
-   root_gc_->Bcast<real_t>(f.HostReadWrite());
+   root_gc_->Bcast(f);
 }
 
 void
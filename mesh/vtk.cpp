@@ -11,10 +11,15 @@
 
 #include "vtk.hpp"
 #include "../general/binaryio.hpp"
+#include "../fem/fe/fe_base.hpp"
 #ifdef MFEM_USE_ZLIB
 #include <zlib.h>
 #endif
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+
 namespace mfem
 {
 
@@ -556,6 +561,53 @@ void CreateVTKElementConnectivity(Array<int> &con, Geometry::Type geom, int ref)
    }
 }
 
+#ifdef MFEM_USE_ZLIB
+// Uncompressed size of the blocks of the compressed arrays
+static const uint32_t vtk_block_size = 1 << 20;
+
+// Compress @a bytes in blocks, in parallel. Return in @a header the VTK header
+// (number of blocks, block size, size of the last partial block and compressed
+// block sizes) and in @a out the compressed blocks.
+static void CompressVTKBlocks(const void *bytes, uint32_t nbytes,
+                              int compression_level,
+                              std::vector<uint32_t> &header,
+                              std::vector<unsigned char> &out)
+{
+   MFEM_ASSERT(compression_level >= -1 && compression_level <= 9,
+               "Compression level must be between -1 and 9 (inclusive).");
+   // Arrays smaller than a block are compressed as one block of their size
+   const bool one_block = nbytes <= vtk_block_size;
+   const uint32_t bs = one_block ? nbytes : vtk_block_size;
+   const int nblocks = one_block ? 1 : int((nbytes + bs - 1)/bs);
+   const uLong bound = compressBound(bs);
+   header.resize(3 + nblocks);
+   header[0] = nblocks;
+   header[1] = bs;
+   header[2] = one_block ? 0 : nbytes % bs;
+   out.resize(nblocks*bound);
+   const Bytef *src = static_cast<const Bytef *>(bytes);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int b = 0; b < nblocks; b++)
+   {
+      const uLong offset = uLong(b)*bs;
+      uLongf csize = bound;
+      compress2(out.data() + b*bound, &csize, src + offset,
+                std::min<uLong>(bs, nbytes - offset), compression_level);
+      header[3 + b] = uint32_t(csize);
+   }
+   // Remove the gaps between the compressed blocks
+   std::size_t pos = header[3];
+   for (int b = 1; b < nblocks; b++)
+   {
+      std::memmove(out.data() + pos, out.data() + b*bound, header[3 + b]);
+      pos += header[3 + b];
+   }
+   out.resize(pos);
+}
+#endif
+
 void WriteVTKEncodedCompressed(std::ostream &os, const void *bytes,
                                uint32_t nbytes, int compression_level)
 {
@@ -569,22 +621,13 @@ void WriteVTKEncodedCompressed(std::ostream &os, const void *bytes,
    else
    {
 #ifdef MFEM_USE_ZLIB
-      MFEM_ASSERT(compression_level >= -1 && compression_level <= 9,
-                  "Compression level must be between -1 and 9 (inclusive).");
-      uLongf buf_sz = compressBound(nbytes);
-      std::vector<unsigned char> buf(buf_sz);
-      compress2(buf.data(), &buf_sz, static_cast<const Bytef *>(bytes), nbytes,
-                compression_level);
-
+      std::vector<uint32_t> header;
+      std::vector<unsigned char> buf;
+      CompressVTKBlocks(bytes, nbytes, compression_level, header, buf);
       // Write the header
-      std::vector<uint32_t> header(4);
-      header[0] = 1; // number of blocks
-      header[1] = nbytes; // uncompressed size
-      header[2] = 0; // size of partial block
-      header[3] = buf_sz; // compressed size
       bin_io::WriteBase64(os, header.data(), header.size()*sizeof(uint32_t));
       // Write the compressed data
-      bin_io::WriteBase64(os, buf.data(), buf_sz);
+      bin_io::WriteBase64(os, buf.data(), buf.size());
 #else
       MFEM_ABORT("MFEM must be compiled with ZLib support to output "
                  "compressed binary data.")
@@ -677,4 +720,142 @@ std::string VTKComponentLabels(int vdim)
    }
 }
 
+template <typename T>
+static void AppendVTKBinary(std::vector<char> &buf, const real_t *data,
+                            std::size_t n)
+{
+   const std::size_t pos = buf.size();
+   buf.resize(pos + n*sizeof(T));
+   char *out = buf.data() + pos;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (std::ptrdiff_t i = 0; i < std::ptrdiff_t(n); i++)
+   {
+      const T val = T(data[i]);
+      std::memcpy(out + i*sizeof(T), &val, sizeof(T));
+   }
+}
+
+void AppendVTKBinary(std::vector<char> &buf, const real_t *data, std::size_t n,
+                     VTKFormat format)
+{
+   MFEM_ASSERT(format != VTKFormat::ASCII, "binary format expected");
+   if (format == VTKFormat::BINARY32) { AppendVTKBinary<float>(buf, data, n); }
+   else { AppendVTKBinary<double>(buf, data, n); }
+}
+
+std::string VTKAppendedData::Attributes() const
+{
+   return "format=\"appended\" offset=\"" + std::to_string(data.size()) + "\"";
+}
+
+void VTKAppendedData::AppendAndClear(std::vector<char> &buf)
+{
+   MFEM_VERIFY(buf.size() <= UINT32_MAX, "array too large for the VTU format");
+   const uint32_t nbytes = uint32_t(buf.size());
+   if (compression_level == 0)
+   {
+      bin_io::AppendBytes(data, nbytes);
+      data.insert(data.end(), buf.begin(), buf.end());
+   }
+   else
+   {
+#ifdef MFEM_USE_ZLIB
+      std::vector<uint32_t> header;
+      std::vector<unsigned char> cbuf;
+      CompressVTKBlocks(buf.data(), nbytes, compression_level, header, cbuf);
+      const char *h = reinterpret_cast<const char *>(header.data());
+      data.insert(data.end(), h, h + header.size()*sizeof(uint32_t));
+      data.insert(data.end(), cbuf.begin(), cbuf.end());
+#else
+      MFEM_ABORT("MFEM must be compiled with ZLib support to output "
+                 "compressed binary data.")
+#endif
+   }
+   buf.clear();
+}
+
+void VTKAppendedData::Write(std::ostream &os) const
+{
+   os << "<AppendedData encoding=\"raw\">\n_";
+   os.write(data.data(), data.size());
+   os << "\n</AppendedData>\n";
+}
+
+bool EvalVTKRefinedField(
+   int ne, int ref, int vdim,
+   const std::function<Geometry::Type(int)> &get_geom,
+   const std::function<const FiniteElement*(int)> &get_fe,
+   const std::function<void(int, Array<int>&, Vector&)> &get_dofs,
+   std::vector<real_t> &values)
+{
+   // Offsets of the points of the elements, and values of the basis functions
+   // at the refined points, computed once per finite element
+   std::vector<int> offsets(ne + 1);
+   std::map<const FiniteElement*, DenseMatrix> shapes;
+   std::vector<const DenseMatrix*> elem_shape(ne);
+   offsets[0] = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      const IntegrationRule &ir =
+         GlobGeometryRefiner.Refine(get_geom(i), ref, 1)->RefPts;
+      offsets[i+1] = offsets[i] + ir.GetNPoints();
+      const FiniteElement *fe = get_fe(i);
+      auto it = shapes.find(fe);
+      if (it == shapes.end())
+      {
+         if (fe->GetRangeType() != FiniteElement::SCALAR ||
+             fe->GetMapType() != FiniteElement::VALUE)
+         {
+            return false;
+         }
+         DenseMatrix &shape = shapes[fe];
+         shape.SetSize(fe->GetDof(), ir.GetNPoints());
+         Vector col;
+         for (int j = 0; j < ir.GetNPoints(); j++)
+         {
+            shape.GetColumnReference(j, col);
+            fe->CalcShape(ir.IntPoint(j), col);
+         }
+         it = shapes.find(fe);
+      }
+      MFEM_ASSERT(it->second.Width() == ir.GetNPoints(), "invalid element");
+      elem_shape[i] = &it->second;
+   }
+
+   values.resize(std::size_t(vdim)*offsets[ne]);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      // Buffers of get_dofs, reused by the elements of each thread
+      Array<int> work;
+      Vector dofs;
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for
+#endif
+      for (int i = 0; i < ne; i++)
+      {
+         const DenseMatrix &shape = *elem_shape[i];
+         const int ndof = shape.Height(), npts = shape.Width();
+         get_dofs(i, work, dofs);
+         MFEM_ASSERT(dofs.Size() == ndof*vdim, "invalid element dofs");
+         real_t *val = values.data() + std::size_t(vdim)*offsets[i];
+         for (int j = 0; j < npts; j++)
+         {
+            const real_t *s = shape.GetColumn(j);
+            for (int c = 0; c < vdim; c++)
+            {
+               const real_t *d = dofs.GetData() + c*ndof;
+               real_t v = 0.0;
+               for (int k = 0; k < ndof; k++) { v += s[k]*d[k]; }
+               val[j*vdim + c] = v;
+            }
+         }
+      }
+   }
+   return true;
+}
+
 } // namespace mfem
@@ -13,7 +13,9 @@
 #define MFEM_VTK
 
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "../fem/geom.hpp"
 #include "../general/binaryio.hpp"
@@ -21,6 +23,8 @@
 namespace mfem
 {
 
+class FiniteElement;
+
 // Helpers for reading and writing VTK format
 
 /// @brief Helper class for converting between MFEM and VTK geometry types.
@@ -120,7 +124,7 @@ void CreateVTKElementConnectivity(Array<int> &con, Geometry::Type geom,
 ///
 /// The binary data will be base 64 encoded, and compressed if @a
 /// compression_level is not zero. The proper header will be prepended to the
-/// data.
+/// data. Large arrays are compressed in blocks, in parallel with OpenMP.
 void WriteVTKEncodedCompressed(std::ostream &os, const void *bytes,
                                uint32_t nbytes, int compression_level);
 
@@ -190,6 +194,62 @@ void WriteBase64WithSizeAndClear(std::ostream &os, std::vector<char> &buf,
 /// arrays for use in XML VTU files.
 std::string VTKComponentLabels(int vdim);
 
+/// @brief Append the @a n values in @a data to the byte buffer @a buf, as 64 or
+/// 32 bit floating point numbers depending on the binary @a format.
+void AppendVTKBinary(std::vector<char> &buf, const real_t *data, std::size_t n,
+                     VTKFormat format);
+
+/// @brief Data arrays of a VTU file in the appended raw format.
+///
+/// Instead of being encoded in base 64 in the DataArray elements, the arrays
+/// are stored in raw binary form, compressed if the compression level is not
+/// zero, in the AppendedData element at the end of the file. The DataArray
+/// elements reference them with the attributes returned by Attributes().
+class VTKAppendedData
+{
+   const int compression_level;
+   std::vector<char> data;
+
+public:
+   /// Compress the arrays with the given zlib level, if not zero.
+   explicit VTKAppendedData(int compression_level_)
+      : compression_level(compression_level_) { }
+
+   /// @brief Return the format and offset attributes of the DataArray element
+   /// of the next array.
+   std::string Attributes() const;
+
+   /// Append the array in @a buf, with its header, and clear @a buf.
+   void AppendAndClear(std::vector<char> &buf);
+
+   /** @brief Write the AppendedData element, the last child of the VTKFile
+       element. */
+   void Write(std::ostream &os) const;
+};
+
+/// @brief Evaluate a field at the points of the refined elements used by the
+/// VTU output, i.e. GlobGeometryRefiner.Refine(geom, ref, 1), for elements 0
+/// to @a ne - 1.
+///
+/// In element @a i, with geometry @a get_geom(i), the field is given by the
+/// scalar finite element @a get_fe(i) and the element degrees of freedom,
+/// which @a get_dofs(i, work, dofs) returns in @a dofs ordered by component.
+/// The integer array @a work and the vector @a dofs are reused by all the
+/// elements processed by the same thread, e.g. @a work can hold the vdofs of
+/// the element. The values of all points, with @a vdim components each, are
+/// written contiguously in @a values.
+///
+/// The basis functions are evaluated once per finite element on the calling
+/// thread, and then the elements are processed in parallel with OpenMP, so @a
+/// get_dofs must be thread-safe. Returns false, without evaluating anything,
+/// if one of the finite elements is not scalar with the VALUE map type.
+bool EvalVTKRefinedField(
+   int ne, int ref, int vdim,
+   const std::function<Geometry::Type(int)> &get_geom,
+   const std::function<const FiniteElement*(int)> &get_fe,
+   const std::function<void(int, Array<int>&, Vector&)> &get_dofs,
+   std::vector<real_t> &values);
+
 } // namespace mfem
 
 #endif
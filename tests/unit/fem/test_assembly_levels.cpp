@@ -621,6 +621,203 @@ TEST_CASE("Full Assembly Connectivity", "[AssemblyLevel], [GPU]")
    TestH1FullAssembly(mesh, order);
 }
 
+static void TestSameMixedAction(MixedBilinearForm &a_fa,
+                                MixedBilinearForm &a_legacy)
+{
+   const SparseMatrix &A_fa = a_fa.SpMat();
+   const SparseMatrix &A_legacy = a_legacy.SpMat();
+   REQUIRE(A_fa.Height() == A_legacy.Height());
+   REQUIRE(A_fa.Width() == A_legacy.Width());
+
+   Vector x(A_fa.Width()), y_fa(A_fa.Height()), y_legacy(A_fa.Height());
+   x.Randomize(1);
+   a_fa.Mult(x, y_fa);
+   A_legacy.Mult(x, y_legacy);
+   y_fa -= y_legacy;
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+
+   Vector xt(A_fa.Height()), yt_fa(A_fa.Width()), yt_legacy(A_fa.Width());
+   xt.Randomize(2);
+   a_fa.MultTranspose(xt, yt_fa);
+   A_legacy.MultTranspose(xt, yt_legacy);
+   yt_fa -= yt_legacy;
+   REQUIRE(yt_fa.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("Mixed Full Assembly", "[AssemblyLevel], [GPU]")
+{
+   const int order = GENERATE(1, 2);
+   const auto mesh_fname = GENERATE("../../data/star.mesh",
+                                    "../../data/fichera.mesh");
+   CAPTURE(order, mesh_fname);
+
+   Mesh mesh(mesh_fname);
+   const int dim = mesh.Dimension();
+
+   H1_FECollection h1_fec(order, dim);
+   ND_FECollection nd_fec(order, dim);
+   RT_FECollection rt_fec(order-1, dim);
+   L2_FECollection l2_fec(order-1, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   FiniteElementSpace rt_fes(&mesh, &rt_fec);
+   FiniteElementSpace l2_fes(&mesh, &l2_fec);
+   ConstantCoefficient coeff(2.5);
+
+   SECTION("MixedVectorGradientIntegrator")
+   {
+      MixedBilinearForm a_fa(&h1_fes, &nd_fes), a_legacy(&h1_fes, &nd_fes);
+      a_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      a_fa.AddDomainIntegrator(new MixedVectorGradientIntegrator(coeff));
+      a_legacy.AddDomainIntegrator(new MixedVectorGradientIntegrator(coeff));
+      a_fa.Assemble();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      TestSameMixedAction(a_fa, a_legacy);
+   }
+
+   SECTION("VectorFEDivergenceIntegrator")
+   {
+      MixedBilinearForm a_fa(&rt_fes, &l2_fes), a_legacy(&rt_fes, &l2_fes);
+      a_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      a_fa.AddDomainIntegrator(new VectorFEDivergenceIntegrator(coeff));
+      a_legacy.AddDomainIntegrator(new VectorFEDivergenceIntegrator(coeff));
+      a_fa.Assemble();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      TestSameMixedAction(a_fa, a_legacy);
+   }
+
+   SECTION("GradientInterpolator")
+   {
+      DiscreteLinearOperator a_fa(&h1_fes, &nd_fes), a_legacy(&h1_fes, &nd_fes);
+      a_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      a_fa.AddDomainInterpolator(new GradientInterpolator);
+      a_legacy.AddDomainInterpolator(new GradientInterpolator);
+      a_fa.Assemble();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      TestSameMixedAction(a_fa, a_legacy);
+   }
+
+   SECTION("Fallback to legacy assembly")
+   {
+      // MixedScalarMassIntegrator does not support partial assembly, and
+      // boundary integrators are not supported by the device full assembly
+      MixedBilinearForm a_fa(&h1_fes, &l2_fes), a_legacy(&h1_fes, &l2_fes);
+      a_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      a_fa.AddDomainIntegrator(new MixedScalarMassIntegrator(coeff));
+      a_legacy.AddDomainIntegrator(new MixedScalarMassIntegrator(coeff));
+      a_fa.Assemble();
+      a_fa.Finalize();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      REQUIRE(a_fa.GetAssemblyLevel() == AssemblyLevel::LEGACY);
+      TestSameMixedAction(a_fa, a_legacy);
+
+      H1_FECollection h1_fec_low(std::max(order-1, 1), dim);
+      FiniteElementSpace h1_fes_low(&mesh, &h1_fec_low);
+      MixedBilinearForm b_fa(&h1_fes, &h1_fes_low),
+                        b_legacy(&h1_fes, &h1_fes_low);
+      b_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      b_fa.AddBoundaryIntegrator(new BoundaryMassIntegrator(coeff));
+      b_legacy.AddBoundaryIntegrator(new BoundaryMassIntegrator(coeff));
+      b_fa.Assemble();
+      b_fa.Finalize();
+      b_legacy.Assemble();
+      b_legacy.Finalize();
+      REQUIRE(b_fa.GetAssemblyLevel() == AssemblyLevel::LEGACY);
+      TestSameMixedAction(b_fa, b_legacy);
+
+      // The mixed partial assembly kernels require tensor product elements
+      Mesh tri_mesh = Mesh::MakeCartesian2D(3, 3, Element::TRIANGLE);
+      H1_FECollection tri_h1_fec(order, 2);
+      ND_FECollection tri_nd_fec(order, 2);
+      FiniteElementSpace tri_h1_fes(&tri_mesh, &tri_h1_fec);
+      FiniteElementSpace tri_nd_fes(&tri_mesh, &tri_nd_fec);
+      DiscreteLinearOperator g_fa(&tri_h1_fes, &tri_nd_fes),
+                             g_legacy(&tri_h1_fes, &tri_nd_fes);
+      g_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+      g_fa.AddDomainInterpolator(new GradientInterpolator);
+      g_legacy.AddDomainInterpolator(new GradientInterpolator);
+      g_fa.Assemble();
+      g_fa.Finalize();
+      g_legacy.Assemble();
+      g_legacy.Finalize();
+      REQUIRE(g_fa.GetAssemblyLevel() == AssemblyLevel::LEGACY);
+      TestSameMixedAction(g_fa, g_legacy);
+   }
+}
+
+static void TestSameMixedAddMult(const MixedBilinearForm &a,
+                                 const SparseMatrix &A)
+{
+   const real_t c = 0.5;
+
+   Vector x(A.Width()), y(A.Height()), y_ref(A.Height());
+   x.Randomize(1);
+   y.Randomize(2);
+   y_ref = y;
+   a.AddMult(x, y, c);
+   A.AddMult(x, y_ref, c);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+   Vector xt(A.Height()), yt(A.Width()), yt_ref(A.Width());
+   xt.Randomize(3);
+   yt.Randomize(4);
+   yt_ref = yt;
+   a.AddMultTranspose(xt, yt, c);
+   A.AddMultTranspose(xt, yt_ref, c);
+   yt -= yt_ref;
+   REQUIRE(yt.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("Mixed Element Assembly", "[AssemblyLevel], [GPU]")
+{
+   const int order = GENERATE(1, 2);
+   const auto mesh_fname = GENERATE("../../data/star.mesh",
+                                    "../../data/fichera.mesh");
+   CAPTURE(order, mesh_fname);
+
+   Mesh mesh(mesh_fname);
+   const int dim = mesh.Dimension();
+
+   H1_FECollection h1_fec(order, dim);
+   ND_FECollection nd_fec(order, dim);
+   RT_FECollection rt_fec(order-1, dim);
+   L2_FECollection l2_fec(order-1, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   FiniteElementSpace rt_fes(&mesh, &rt_fec);
+   FiniteElementSpace l2_fes(&mesh, &l2_fec);
+   ConstantCoefficient coeff(2.5);
+
+   SECTION("MixedVectorGradientIntegrator")
+   {
+      MixedBilinearForm a_ea(&h1_fes, &nd_fes), a_legacy(&h1_fes, &nd_fes);
+      a_ea.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      a_ea.AddDomainIntegrator(new MixedVectorGradientIntegrator(coeff));
+      a_legacy.AddDomainIntegrator(new MixedVectorGradientIntegrator(coeff));
+      a_ea.Assemble();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      TestSameMixedAddMult(a_ea, a_legacy.SpMat());
+   }
+
+   SECTION("VectorFEDivergenceIntegrator")
+   {
+      MixedBilinearForm a_ea(&rt_fes, &l2_fes), a_legacy(&rt_fes, &l2_fes);
+      a_ea.SetAssemblyLevel(AssemblyLevel::ELEMENT);
+      a_ea.AddDomainIntegrator(new VectorFEDivergenceIntegrator(coeff));
+      a_legacy.AddDomainIntegrator(new VectorFEDivergenceIntegrator(coeff));
+      a_ea.Assemble();
+      a_legacy.Assemble();
+      a_legacy.Finalize();
+      TestSameMixedAddMult(a_ea, a_legacy.SpMat());
+   }
+}
+
 #ifdef MFEM_USE_MPI
 
 void CompareMatricesNonZeros(HypreParMatrix &A1, const HypreParMatrix &A2)
@@ -751,6 +948,94 @@ TEST_CASE("Parallel H1 Full Assembly", "[AssemblyLevel], [Parallel], [GPU]")
    }
 }
 
+TEST_CASE("Parallel PA Communication Overlap",
+          "[AssemblyLevel], [Parallel], [GPU]")
+{
+   auto order = GENERATE(1, 3);
+   auto mesh_fname = GENERATE(
+                        "../../data/star.mesh",
+                        "../../data/fichera.mesh"
+                     );
+   const bool vector = GENERATE(false, true);
+   CAPTURE(order, mesh_fname, vector);
+
+   Mesh serial_mesh(mesh_fname);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   const int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   ParFiniteElementSpace fespace(&mesh, &fec, vector ? dim : 1);
+
+   Array<int> ess_tdof_list;
+   fespace.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   Array<int> bdr_marker(mesh.bdr_attributes.Max());
+   bdr_marker = 0;
+   bdr_marker[0] = 1;
+
+   ParBilinearForm a(&fespace), a_overlap(&fespace);
+   for (ParBilinearForm *form : {&a, &a_overlap})
+   {
+      form->SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      if (vector)
+      {
+         form->AddDomainIntegrator(new VectorDiffusionIntegrator(one));
+         form->AddDomainIntegrator(new VectorMassIntegrator(one));
+      }
+      else
+      {
+         form->AddDomainIntegrator(new DiffusionIntegrator(one));
+         form->AddDomainIntegrator(new MassIntegrator(one));
+         form->AddBoundaryIntegrator(new MassIntegrator(one), bdr_marker);
+      }
+      form->Assemble();
+   }
+   a_overlap.EnableCommunicationOverlap();
+
+   OperatorHandle A, A_overlap;
+   a.FormSystemMatrix(ess_tdof_list, A);
+   a_overlap.FormSystemMatrix(ess_tdof_list, A_overlap);
+
+   Vector x(fespace.GetTrueVSize()), y(x.Size()), y_overlap(x.Size());
+   x.Randomize(1);
+   A->Mult(x, y);
+   A_overlap->Mult(x, y_overlap);
+   y_overlap -= y;
+   const real_t y_norm = GlobalLpNorm(infinity(), y.Normlinf(),
+                                      MPI_COMM_WORLD);
+   const real_t err = GlobalLpNorm(infinity(), y_overlap.Normlinf(),
+                                   MPI_COMM_WORLD);
+   REQUIRE(err <= 1e-10*y_norm);
+
+   // The same linear system from FormLinearSystem()
+   ParGridFunction x1(&fespace), x2(&fespace);
+   ParLinearForm b1(&fespace), b2(&fespace);
+   x1.Randomize(2);
+   b1.Randomize(3);
+   x2 = x1;
+   b2 = b1;
+   Vector X1, X2, B1, B2;
+   a.FormLinearSystem(ess_tdof_list, x1, b1, A, X1, B1);
+   a_overlap.FormLinearSystem(ess_tdof_list, x2, b2, A_overlap, X2, B2);
+   B2 -= B1;
+   const real_t b_err = GlobalLpNorm(infinity(), B2.Normlinf(),
+                                     MPI_COMM_WORLD);
+   REQUIRE(b_err == MFEM_Approx(0.0));
+
+   // The option is ignored with full assembly, which gives a HypreParMatrix
+   ParBilinearForm a_full(&fespace);
+   a_full.SetAssemblyLevel(AssemblyLevel::FULL);
+   if (vector) { a_full.AddDomainIntegrator(new VectorMassIntegrator(one)); }
+   else { a_full.AddDomainIntegrator(new MassIntegrator(one)); }
+   a_full.EnableCommunicationOverlap();
+   a_full.Assemble();
+   OperatorHandle A_full;
+   a_full.FormSystemMatrix(ess_tdof_list, A_full);
+   REQUIRE(A_full.As<HypreParMatrix>() != nullptr);
+}
+
 #endif
 
 } // namespace assembly_levels
@@ -184,3 +184,215 @@ TEST_CASE("BilinearForm print", "[SparseMatrix][BilinearForm]")
    a.Print(ss);
    REQUIRE(ss.str().length() > 0);
 }
+
+TEST_CASE("BilinearForm precomputed sparsity", "[BilinearForm]")
+{
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   const int space = GENERATE(0, 1, 2, 3); // H1, H1^dim, ND, DG
+   CAPTURE(ordering, space);
+
+   Mesh mesh = Mesh::MakeCartesian3D(2, 2, 3, Element::TETRAHEDRON);
+   const int dim = mesh.Dimension();
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (space <= 1) { fec.reset(new H1_FECollection(2, dim)); }
+   else if (space == 2) { fec.reset(new ND_FECollection(2, dim)); }
+   else { fec.reset(new L2_FECollection(1, dim)); }
+   FiniteElementSpace fes(&mesh, fec.get(), (space == 1) ? dim : 1, ordering);
+
+   ConstantCoefficient one(1.0), two(2.0);
+   const auto add_integrators = [&](BilinearForm &a)
+   {
+      switch (space)
+      {
+         case 0:
+            a.AddDomainIntegrator(new DiffusionIntegrator(two));
+            a.AddDomainIntegrator(new MassIntegrator);
+            a.AddBoundaryIntegrator(new MassIntegrator(two));
+            break;
+         case 1:
+            a.AddDomainIntegrator(new ElasticityIntegrator(one, two));
+            a.AddBoundaryIntegrator(new VectorMassIntegrator);
+            break;
+         case 2:
+            a.AddDomainIntegrator(new CurlCurlIntegrator);
+            a.AddDomainIntegrator(new VectorFEMassIntegrator(two));
+            break;
+         case 3:
+            a.AddDomainIntegrator(new DiffusionIntegrator);
+            a.AddInteriorFaceIntegrator(new DGDiffusionIntegrator(-1.0, 2.0));
+            a.AddBdrFaceIntegrator(new DGDiffusionIntegrator(-1.0, 2.0));
+            break;
+      }
+   };
+
+   BilinearForm a_ref(&fes);
+   add_integrators(a_ref);
+   a_ref.Assemble();
+   a_ref.Finalize();
+
+   BilinearForm a(&fes);
+   add_integrators(a);
+   a.UsePrecomputedSparsity();
+   a.Assemble();
+   a.Finalize();
+
+   REQUIRE(a.SpMat().Finalized());
+   REQUIRE(a.SpMat().NumNonZeroElems() >= a_ref.SpMat().NumNonZeroElems());
+
+   Vector x(fes.GetVSize()), y(fes.GetVSize()), y_ref(fes.GetVSize());
+   x.Randomize(1);
+   a_ref.Mult(x, y_ref);
+   a.Mult(x, y);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+   // Assembling again into the same pattern
+   a.Update();
+   a.Assemble();
+   a.Mult(x, y);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("BilinearForm values-only reassembly", "[BilinearForm]")
+{
+   const auto policy = GENERATE(Matrix::DIAG_ONE, Matrix::DIAG_ZERO,
+                                Matrix::DIAG_KEEP);
+   CAPTURE(policy);
+
+   Mesh mesh = Mesh::MakeCartesian2D(4, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max()), ess_tdof_list;
+   ess_bdr = 0;
+   ess_bdr[0] = 1;
+   ess_bdr[1] = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient kappa(1.0), one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(kappa));
+   a.AddDomainIntegrator(new MassIntegrator(kappa));
+   a.SetDiagonalPolicy(policy);
+   a.UsePrecomputedSparsity();
+   a.UseValuesOnlyReassembly();
+
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   GridFunction x(&fes);
+   x.Randomize(1);
+
+   const SparseMatrix *mat = nullptr;
+   for (int step = 0; step < 4; step++)
+   {
+      CAPTURE(step);
+      kappa.constant = 1.0 + step;
+      if (step == 3)
+      {
+         // Different essential dofs: elimination from scratch
+         ess_bdr = 1;
+         fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+      }
+
+      a.Update();
+      a.Assemble();
+      OperatorHandle A;
+      Vector x1(x), b1(b), X, B;
+      a.FormLinearSystem(ess_tdof_list, x1, b1, A, X, B);
+      if (step == 0) { mat = &a.SpMat(); }
+      // The matrix is reassembled in place
+      REQUIRE(&a.SpMat() == mat);
+
+      BilinearForm a_ref(&fes);
+      a_ref.AddDomainIntegrator(new DiffusionIntegrator(kappa));
+      a_ref.AddDomainIntegrator(new MassIntegrator(kappa));
+      a_ref.SetDiagonalPolicy(policy);
+      a_ref.Assemble();
+      OperatorHandle A_ref;
+      Vector x2(x), b2(b), X_ref, B_ref;
+      a_ref.FormLinearSystem(ess_tdof_list, x2, b2, A_ref, X_ref, B_ref);
+
+      Vector z(X.Size()), y(X.Size()), y_ref(X.Size());
+      z.Randomize(2);
+      A->Mult(z, y);
+      A_ref->Mult(z, y_ref);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+      B -= B_ref;
+      REQUIRE(B.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("ParBilinearForm values-only reassembly", "[BilinearForm][Parallel]")
+{
+   Mesh serial_mesh = Mesh::MakeCartesian2D(6, 5, Element::QUADRILATERAL);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   H1_FECollection fec(2, mesh.Dimension());
+   ParFiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max()), ess_tdof_list;
+   ess_bdr = 0;
+   ess_bdr[0] = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient kappa(1.0), one(1.0);
+   ParBilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(kappa));
+   a.UsePrecomputedSparsity();
+   a.UseValuesOnlyReassembly();
+
+   ParLinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   ParGridFunction x(&fes);
+   x.Randomize(1);
+
+   const HypreParMatrix *mat = nullptr;
+   for (int step = 0; step < 4; step++)
+   {
+      CAPTURE(step);
+      kappa.constant = 1.0 + step;
+      if (step == 3 && Mpi::Root())
+      {
+         // Change the essential dofs on one rank only: all ranks must
+         // eliminate them again
+         if (ess_tdof_list.Size() > 0) { ess_tdof_list.DeleteLast(); }
+         else { ess_tdof_list.Append(0); }
+      }
+
+      a.Update();
+      a.Assemble();
+      OperatorHandle A;
+      Vector x1(x), b1(b), X, B;
+      a.FormLinearSystem(ess_tdof_list, x1, b1, A, X, B);
+      if (step == 0) { mat = A.As<HypreParMatrix>(); }
+      // The parallel matrix is reused while the essential dofs do not change
+      if (step < 3) { REQUIRE(A.As<HypreParMatrix>() == mat); }
+
+      ParBilinearForm a_ref(&fes);
+      a_ref.AddDomainIntegrator(new DiffusionIntegrator(kappa));
+      a_ref.Assemble();
+      OperatorHandle A_ref;
+      Vector x2(x), b2(b), X_ref, B_ref;
+      a_ref.FormLinearSystem(ess_tdof_list, x2, b2, A_ref, X_ref, B_ref);
+
+      Vector z(X.Size()), y(X.Size()), y_ref(X.Size());
+      z.Randomize(2);
+      A->Mult(z, y);
+      A_ref->Mult(z, y_ref);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+      B -= B_ref;
+      REQUIRE(B.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
+#endif
@@ -331,6 +331,101 @@ TEST_CASE("ParaView restart mode", "[ParaView]")
    REQUIRE(rmdir("ParaView") == 0);
 }
 
+TEST_CASE("Asynchronous save", "[DataCollection]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(2, 3, Element::QUADRILATERAL, 0, 2.0, 3.0);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction u(&fes);
+   QuadratureSpace qspace(&mesh, 3);
+   QuadratureFunction q(qspace);
+
+   SECTION("VisIt data files")
+   {
+      const std::size_t budget = GENERATE(0, 1 << 20);
+      CAPTURE(budget);
+      VisItDataCollection dc("async", &mesh);
+      dc.RegisterField("u", &u);
+      dc.RegisterQField("q", &q);
+      dc.SetAsyncSave(true, budget);
+      REQUIRE(dc.IsAsyncSave());
+      // The saves must write the data at the time of the call, even though the
+      // fields are modified before they are written
+      for (int c = 0; c < 3; c++)
+      {
+         u = real_t(c);
+         q = real_t(-c);
+         SaveDataCollection(dc, c, c);
+      }
+      u = 10.0;
+      dc.Wait();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+
+      for (int c = 0; c < 3; c++)
+      {
+         VisItDataCollection dc_new("async");
+         dc_new.Load(c);
+         REQUIRE(dc_new.Error() == DataCollection::No_Error);
+         REQUIRE(dc_new.GetTime() == real_t(c));
+         GridFunction *u_new = dc_new.GetField("u");
+         QuadratureFunction *q_new = dc_new.GetQField("q");
+         REQUIRE(u_new);
+         REQUIRE(q_new);
+         REQUIRE(u_new->Size() == u.Size());
+         REQUIRE(u_new->Max() == real_t(c));
+         REQUIRE(u_new->Min() == real_t(c));
+         REQUIRE(q_new->Max() == real_t(-c));
+         REQUIRE(dc_new.GetMesh()->GetNE() == mesh.GetNE());
+
+         const std::string dir = "async_00000" + std::to_string(c);
+         REQUIRE(remove(("async_00000" + std::to_string(c) +
+                         ".mfem_root").c_str()) == 0);
+         REQUIRE(remove((dir + "/mesh.000000").c_str()) == 0);
+         REQUIRE(remove((dir + "/u.000000").c_str()) == 0);
+         REQUIRE(remove((dir + "/q.000000").c_str()) == 0);
+         REQUIRE(rmdir(dir.c_str()) == 0);
+      }
+   }
+
+   SECTION("ParaView data files")
+   {
+      {
+         ParaViewDataCollection dc("ParaViewAsync", &mesh);
+         dc.RegisterField("u", &u);
+         dc.SetAsyncSave(true);
+         for (int c = 0; c < 3; c++)
+         {
+            u = real_t(c);
+            SaveDataCollection(dc, c, c);
+         }
+         // The destructor waits for the pending saves
+      }
+
+      tinyxml2::XMLDocument xml;
+      xml.LoadFile("ParaViewAsync/ParaViewAsync.pvd");
+      REQUIRE(xml.ErrorID() == tinyxml2::XML_SUCCESS);
+      const tinyxml2::XMLElement *dataset =
+         xml.FirstChildElement()->FirstChildElement()->FirstChildElement();
+      for (int c = 0; c < 3; c++)
+      {
+         REQUIRE(dataset);
+         REQUIRE(std::stod(dataset->Attribute("timestep")) == real_t(c));
+         dataset = dataset->NextSiblingElement();
+      }
+      REQUIRE(dataset == nullptr);
+
+      for (int c = 0; c < 3; c++)
+      {
+         std::string prefix = "ParaViewAsync/Cycle00000" + std::to_string(c);
+         REQUIRE(remove((prefix + "/data.pvtu").c_str()) == 0);
+         REQUIRE(remove((prefix + "/proc000000.vtu").c_str()) == 0);
+         REQUIRE(rmdir(prefix.c_str()) == 0);
+      }
+      REQUIRE(remove("ParaViewAsync/ParaViewAsync.pvd") == 0);
+      REQUIRE(rmdir("ParaViewAsync") == 0);
+   }
+}
+
 #ifdef MFEM_USE_HDF5
 
 TEST_CASE("ParaView VTKHDF restart mode", "[ParaView]")
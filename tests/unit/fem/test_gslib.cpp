@@ -369,6 +369,78 @@ TEST_CASE("GSLIBInterpolateL2ElementBoundary",
    delete c_fec;
 }
 
+TEST_CASE("GSLIBWarmStart", "[GSLIBWarmStart][GSLIB]")
+{
+   int dim           = GENERATE(2, 3);
+   bool host_kernels = GENERATE(false, true);
+   CAPTURE(dim, host_kernels);
+
+   const int ne = 4, mesh_order = 2;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(ne, ne, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(ne, ne, ne, Element::HEXAHEDRON);
+   mesh.SetCurvature(mesh_order);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.05*sin(M_PI*x(1));
+   });
+
+   H1_FECollection fec(mesh_order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction field_vals(&fes);
+   FunctionCoefficient F([](const Vector &x) { return x(0)*x(0) + x(1); });
+   field_vals.ProjectCoefficient(F);
+
+   // Points in the interior of the domain, ordered byVDIM
+   const int npt = 200;
+   Vector pos(npt*dim);
+   pos.Randomize(1);
+   pos *= 0.8;
+   pos += 0.1;
+
+   FindPointsGSLIB finder(mesh);
+   finder.SetWarmStart(true);
+   finder.SetHostKernels(host_kernels);
+   finder.FindPoints(pos, Ordering::byVDIM);
+
+   // Move the points slightly, some of them across element boundaries
+   for (int step = 0; step < 3; step++)
+   {
+      for (int i = 0; i < npt; i++) { pos(i*dim) += 0.03; }
+
+      Vector interp_vals, interp_vals_ref;
+      finder.FindPoints(pos, Ordering::byVDIM);
+      finder.Interpolate(field_vals, interp_vals);
+
+      FindPointsGSLIB finder_ref(mesh);
+      finder_ref.FindPoints(pos, Ordering::byVDIM);
+      finder_ref.Interpolate(field_vals, interp_vals_ref);
+
+      const Array<unsigned int> &code = finder.GetCode(),
+                                &code_ref = finder_ref.GetCode();
+      const Vector &ref = finder.GetReferencePosition(),
+                    &ref_ref = finder_ref.GetReferencePosition();
+      REQUIRE(code.Size() == npt);
+      for (int i = 0; i < npt; i++)
+      {
+         REQUIRE(code[i] != 2);
+         REQUIRE(code_ref[i] != 2);
+         REQUIRE(finder.GetDist()(i) < 1e-10);
+         // The elements may differ for points on element boundaries
+         if (code_ref[i] == 0)
+         {
+            REQUIRE(finder.GetElem()[i] == finder_ref.GetElem()[i]);
+            for (int d = 0; d < dim; d++)
+            {
+               REQUIRE(ref(i*dim + d) == MFEM_Approx(ref_ref(i*dim + d), 1e-10));
+            }
+         }
+         REQUIRE(interp_vals(i) == MFEM_Approx(interp_vals_ref(i), 1e-10));
+      }
+   }
+}
+
 #ifdef MFEM_USE_MPI
 // Custom interpolation procedure with gslib
 TEST_CASE("GSLIBCustomInterpolation",
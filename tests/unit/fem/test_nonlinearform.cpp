@@ -96,3 +96,81 @@ TEST_CASE("NonlinearForm Boundary Integrator", "[NonlinearForm]")
    u2 -= u1;
    REQUIRE(u2.Norml2() == MFEM_Approx(0.0, 1e-5));
 }
+
+TEST_CASE("HyperbolicFormIntegrator Partial Assembly",
+          "[NonlinearForm][PartialAssembly][GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   // 0: Euler, 1: shallow water, 2: Burgers (upwind), 3: advection (host)
+   const int problem = GENERATE(0, 1, 2, 3);
+   CAPTURE(dim, order, problem);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.SetCurvature(2);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.05*sin(M_PI*x(1));
+      y(1) += 0.05*x(0)*x(0);
+   });
+
+   Vector b(dim);
+   b = 1.0;
+   b(0) = 0.5;
+   VectorConstantCoefficient b_coeff(b);
+   std::unique_ptr<FluxFunction> flux;
+   switch (problem)
+   {
+      case 0: flux.reset(new EulerFlux(dim, 1.4)); break;
+      case 1: flux.reset(new ShallowWaterFlux(dim)); break;
+      case 2: flux.reset(new BurgersFlux(dim)); break;
+      default: flux.reset(new AdvectionFlux(b_coeff)); break;
+   }
+   std::unique_ptr<NumericalFlux> num_flux;
+   if (problem == 2) { num_flux.reset(new ComponentwiseUpwindFlux(*flux)); }
+   else { num_flux.reset(new RusanovFlux(*flux)); }
+   const int neq = flux->num_equations;
+
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec, neq);
+
+   VectorFunctionCoefficient u0(neq, [&](const Vector &x, Vector &u)
+   {
+      const real_t s = sin(M_PI*x(0))*cos(M_PI*x(1));
+      if (problem >= 2) { u(0) = s + 0.5*x(1); return; }
+      const real_t h = 1.0 + 0.2*s;
+      for (int d = 0; d < dim; d++) { u(1 + d) = h*(0.3 - 0.1*d + 0.1*x(d)); }
+      if (problem == 0)
+      {
+         // density, momentum and total energy with pressure 1 + 0.1x
+         real_t mom2 = 0.0;
+         for (int d = 0; d < dim; d++) { mom2 += u(1 + d)*u(1 + d); }
+         u(1 + dim) = (1.0 + 0.1*x(0))/0.4 + 0.5*mom2/h;
+      }
+      u(0) = h;
+   });
+   GridFunction u(&fes);
+   u.ProjectCoefficient(u0);
+
+   HyperbolicFormIntegrator integ(*num_flux, 1), integ_pa(*num_flux, 1);
+   NonlinearForm nlf(&fes), nlf_pa(&fes);
+   nlf.AddDomainIntegrator(&integ);
+   nlf.AddInteriorFaceIntegrator(&integ);
+   nlf.UseExternalIntegrators();
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.AddDomainIntegrator(&integ_pa);
+   nlf_pa.AddInteriorFaceIntegrator(&integ_pa);
+   nlf_pa.UseExternalIntegrators();
+   nlf_pa.Setup();
+
+   Vector y(fes.GetVSize()), y_pa(fes.GetVSize());
+   nlf.Mult(u, y);
+   nlf_pa.Mult(u, y_pa);
+   REQUIRE(y.Normlinf() > 0.0);
+   y_pa -= y;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10*y.Normlinf()));
+   REQUIRE(integ_pa.GetMaxCharSpeed() == MFEM_Approx(integ.GetMaxCharSpeed()));
+}
@@ -693,6 +693,157 @@ TEST_CASE("PA Diffusion", "[PartialAssembly], [GPU]")
    test_pa_integrator<DiffusionIntegrator>();
 } // PA Diffusion test case
 
+TEST_CASE("PA Kernel Profiler", "[PartialAssembly]")
+{
+   const bool was_enabled = KernelProfiler::Enabled();
+   KernelProfiler::Enable(false);
+   KernelProfiler::Reset();
+
+   // Order 2 with the default quadrature uses the specialized 2D kernels
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   BilinearForm m(&fes), k(&fes);
+   m.AddDomainIntegrator(new MassIntegrator);
+   k.AddDomainIntegrator(new DiffusionIntegrator);
+   m.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   k.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   m.Assemble();
+   k.Assemble();
+
+   Vector x(fes.GetVSize()), y(fes.GetVSize());
+   x.Randomize(1);
+   for (int i = 0; i < 3; i++) { m.Mult(x, y); }
+   k.Mult(x, y);
+
+   const std::vector<KernelProfiler::Record> records =
+      KernelProfiler::GetRecords();
+   int n_mass = 0, n_diff = 0;
+   for (const auto &r : records)
+   {
+      REQUIRE(r.calls > 0);
+      REQUIRE(r.time >= 0.0);
+      if (r.kernel.find("ApplyPAKernels") == std::string::npos) { continue; }
+      REQUIRE(r.params.find("2,3,") == 0); // dim, D1D
+      REQUIRE(r.specialized);
+      REQUIRE(r.bytes > 0.0);
+      REQUIRE(r.flops > 0.0);
+      if (r.calls == 3) { n_mass++; }
+      if (r.calls == 1) { n_diff++; }
+   }
+   REQUIRE(n_mass == 1);
+   REQUIRE(n_diff == 1);
+   REQUIRE(records[0].time >= records.back().time);
+
+   std::stringstream table, json;
+   KernelProfiler::Print(table);
+   KernelProfiler::PrintJSON(json);
+   REQUIRE(table.str().find("ApplyPAKernels<2,3,") != std::string::npos);
+   REQUIRE(json.str().find("\"specialized\": true") != std::string::npos);
+
+   KernelProfiler::Reset();
+   REQUIRE(KernelProfiler::GetRecords().empty());
+   if (!was_enabled) { KernelProfiler::Disable(); }
+}
+
+TEST_CASE("PA Kernel Autotuner", "[PartialAssembly]")
+{
+   const bool was_enabled = KernelAutotuner::Enabled();
+   KernelAutotuner::Enable();
+   KernelAutotuner::Reset();
+
+   // Order 2 with the default quadrature: the candidates of the 2D mass
+   // kernel are the specialization, the "no-smem" variant and the fallback
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   BilinearForm m(&fes);
+   m.AddDomainIntegrator(new MassIntegrator);
+   m.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   m.Assemble();
+
+   Vector x(fes.GetVSize()), y(fes.GetVSize()), y_ref(fes.GetVSize());
+   x.Randomize(1);
+   KernelAutotuner::Disable();
+   m.Mult(x, y_ref);
+   KernelAutotuner::Enable();
+
+   // Every call gives the same result, whichever variant is run
+   const bool profiler_was_enabled = KernelProfiler::Enabled();
+   KernelProfiler::Enable(false);
+   KernelProfiler::Reset();
+   const int ncalls = 3*KernelAutotuner::GetTrials() + 1;
+   for (int i = 0; i < ncalls; i++)
+   {
+      m.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   // Each candidate has its own profiler record
+   int n_candidates = 0;
+   for (const auto &r : KernelProfiler::GetRecords())
+   {
+      if (r.kernel.find("ApplyPAKernels") == std::string::npos ||
+          r.params.find("2,3,") != 0) { continue; }
+      n_candidates++;
+      REQUIRE(r.calls >= KernelAutotuner::GetTrials());
+      const bool fallback =
+         r.params.find(" (fallback)") != std::string::npos;
+      REQUIRE(r.specialized == !fallback);
+   }
+   REQUIRE(n_candidates == 3);
+   KernelProfiler::Disable();
+
+   std::stringstream saved;
+   KernelAutotuner::Save(saved);
+   std::string choice;
+   for (std::string line; std::getline(saved, line); )
+   {
+      if (line.find("ApplyPAKernels\t2,3,") == std::string::npos) { continue; }
+      choice = line.substr(line.rfind('\t') + 1);
+   }
+   REQUIRE((choice == "specialized" || choice == "no-smem" ||
+            choice == "fallback"));
+
+   // Loaded choices are used without tuning
+   KernelAutotuner::Reset();
+   std::stringstream forced;
+   forced << "# comment\n";
+   saved.clear();
+   saved.seekg(0);
+   for (std::string line; std::getline(saved, line); )
+   {
+      if (line.find("ApplyPAKernels\t2,3,") == std::string::npos) { continue; }
+      forced << line.substr(0, line.rfind('\t') + 1) << "no-smem\n";
+   }
+   KernelAutotuner::Load(forced);
+   KernelProfiler::Enable(false);
+   KernelProfiler::Reset();
+   for (int i = 0; i < 2; i++)
+   {
+      m.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+   // Only the loaded variant runs, in every call
+   int n_run = 0;
+   for (const auto &r : KernelProfiler::GetRecords())
+   {
+      if (r.kernel.find("ApplyPAKernels") == std::string::npos ||
+          r.params.find("2,3,") != 0) { continue; }
+      n_run++;
+      REQUIRE(r.params.find(" (no-smem)") != std::string::npos);
+      REQUIRE(r.calls == 2);
+   }
+   REQUIRE(n_run == 1);
+   KernelProfiler::Reset();
+   if (!profiler_was_enabled) { KernelProfiler::Disable(); }
+
+   KernelAutotuner::Reset();
+   if (!was_enabled) { KernelAutotuner::Disable(); }
+}
+
 TEST_CASE("PA Markers", "[PartialAssembly], [GPU]")
 {
    const bool all_tests = launch_all_non_regression_tests;
@@ -180,6 +180,82 @@ TEST_CASE("Get Particle Reference", "[ParticleSet]")
 
 }
 
+TEST_CASE("Sorting Particles", "[ParticleSet]")
+{
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(ordering);
+
+   std::vector<Particle> particles;
+   ParticleSet pset(0, SpaceDim, FieldVDims, NumTags, ordering);
+   for (int i = 0; i < N; i++)
+   {
+      particles.emplace_back(SpaceDim, FieldVDims, NumTags);
+      InitializeRandom(particles[i], 17 + i);
+      pset.AddParticle(particles[i]);
+   }
+
+   // The particles must keep their IDs and data
+   auto CheckParticles = [&]()
+   {
+      int err_count = 0;
+      for (int i = 0; i < pset.GetNParticles(); i++)
+      {
+         if (particles[pset.GetIDs()[i]] != pset.GetParticle(i))
+         {
+            err_count++;
+         }
+      }
+      return err_count;
+   };
+
+   SECTION("By element")
+   {
+      // Assign each particle to one of 8 octants
+      Array<unsigned int> elem(N);
+      for (int i = 0; i < N; i++)
+      {
+         const Vector &x = particles[i].Coords();
+         elem[i] = (x(0) > 0.5) + 2*(x(1) > 0.5) + 4*(x(2) > 0.5);
+      }
+      Array<int> perm;
+      pset.SortParticles(elem, &perm);
+      REQUIRE(CheckParticles() == 0);
+      for (int i = 1; i < N; i++)
+      {
+         REQUIRE(elem[perm[i-1]] <= elem[perm[i]]);
+         // Stable sort
+         if (elem[perm[i-1]] == elem[perm[i]])
+         {
+            REQUIRE(pset.GetIDs()[i-1] < pset.GetIDs()[i]);
+         }
+      }
+   }
+
+   SECTION("By Morton key")
+   {
+      pset.SortParticles();
+      REQUIRE(CheckParticles() == 0);
+
+      // Sorting again does not change the order
+      Array<int> perm;
+      pset.SetSortCost(0.0);
+      REQUIRE(pset.SortParticlesIfNeeded(nullptr, &perm));
+      for (int i = 0; i < N; i++) { REQUIRE(perm[i] == i); }
+   }
+
+   SECTION("Cost model")
+   {
+      // Reverse order: every step accumulates a disorder of 1
+      Array<unsigned int> elem(N);
+      for (int i = 0; i < N; i++) { elem[i] = N - i; }
+      pset.SetSortCost(2.0);
+      REQUIRE_FALSE(pset.SortParticlesIfNeeded(&elem));
+      REQUIRE(pset.SortParticlesIfNeeded(&elem));
+      REQUIRE(pset.GetIDs()[0] == N - 1);
+      REQUIRE(CheckParticles() == 0);
+   }
+}
+
 #if defined(MFEM_USE_MPI) && defined(MFEM_USE_GSLIB)
 
 static constexpr int N_e = 10;
@@ -330,3 +406,68 @@ TEST_CASE("Particle Redistribution", "[ParticleSet][Parallel]")
 }
 
 #endif // MFEM_USE_MPI && MFEM_USE_GSLIB
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("Particle Neighbor Redistribution", "[ParticleSet][Parallel]")
+{
+   const int size = Mpi::WorldSize();
+   const int rank = Mpi::WorldRank();
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(ordering);
+
+   // Particle i is created on rank i % size, like its ID
+   ParticleSet pset(MPI_COMM_WORLD, 0, SpaceDim, FieldVDims, NumTags,
+                    ordering);
+   for (int i = rank; i < N*size; i += size)
+   {
+      Particle p(SpaceDim, FieldVDims, NumTags);
+      InitializeRandom(p, 17 + i);
+      pset.AddParticle(p);
+   }
+
+   // Send most particles to a face neighbor, some to other ranks
+   auto Destination = [&](ParticleSet::IDType id, int nbr)
+   {
+      if (id % 3 == 0) { return int(id % size); }
+      if (id % 3 == 1 && nbr >= 0) { return nbr; }
+      return int((id*7919) % size);
+   };
+   pmesh.ExchangeFaceNbrData();
+   const int nbr = pmesh.GetNFaceNeighbors() ?
+                   pmesh.GetFaceNbrRank(0) : -1;
+   Array<unsigned int> rank_list(pset.GetNParticles());
+   std::vector<int> expected(size, 0);
+   for (int i = 0; i < pset.GetNParticles(); i++)
+   {
+      rank_list[i] = Destination(pset.GetIDs()[i], nbr);
+      expected[rank_list[i]]++;
+   }
+   MPI_Allreduce(MPI_IN_PLACE, expected.data(), size, MPI_INT, MPI_SUM,
+                 MPI_COMM_WORLD);
+
+   // Redistribute twice, the second time without any transfer
+   pset.Redistribute(rank_list, pmesh);
+   REQUIRE(pset.GetNParticles() == expected[rank]);
+   rank_list.SetSize(pset.GetNParticles());
+   rank_list = rank;
+   pset.Redistribute(rank_list, pmesh);
+   REQUIRE(pset.GetNParticles() == expected[rank]);
+
+   int wrong_particle_count = 0;
+   for (int i = 0; i < pset.GetNParticles(); i++)
+   {
+      Particle p(SpaceDim, FieldVDims, NumTags);
+      InitializeRandom(p, 17 + int(pset.GetIDs()[i]));
+      if (p != pset.GetParticle(i)) { wrong_particle_count++; }
+   }
+   MPI_Allreduce(MPI_IN_PLACE, &wrong_particle_count, 1, MPI_INT, MPI_SUM,
+                 MPI_COMM_WORLD);
+   REQUIRE(wrong_particle_count == 0);
+}
+
+#endif // MFEM_USE_MPI
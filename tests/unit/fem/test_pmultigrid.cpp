@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("PMultigridPreconditioner", "[PMultigrid]")
+{
+   const bool partial_assembly = GENERATE(false, true);
+   const bool ess_bc = GENERATE(false, true);
+   CAPTURE(partial_assembly, ess_bc);
+
+   const int order = 4;
+   Mesh mesh = Mesh::MakeCartesian2D(6, 6, Element::QUADRILATERAL);
+   H1_FECollection fec(order, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = ess_bc ? 1 : 0;
+   Array<int> ess_tdof_list;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   BilinearForm a(&fes);
+   if (partial_assembly) { a.SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   // Without essential boundary conditions, the mass term makes the operator
+   // definite
+   if (!ess_bc) { a.AddDomainIntegrator(new MassIntegrator(one)); }
+   a.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   OperatorPtr A;
+   Vector X, B;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+
+   PMultigridPreconditioner pmg(a, ess_bdr);
+   REQUIRE(pmg.NumLevels() == 3);
+   REQUIRE(pmg.GetFESpaceAtLevel(0).GetMaxElementOrder() == 1);
+   REQUIRE(pmg.GetFESpaceAtLevel(1).GetMaxElementOrder() == 2);
+   REQUIRE(&pmg.GetFESpaceAtLevel(2) == &fes);
+   REQUIRE(pmg.Height() == A->Height());
+
+   CGSolver cg;
+   cg.SetOperator(*A);
+   cg.SetPreconditioner(pmg);
+   cg.SetRelTol(1e-8);
+   cg.SetMaxIter(100);
+   cg.Mult(B, X);
+   REQUIRE(cg.GetConverged());
+   REQUIRE(cg.GetNumIterations() <= 25);
+
+   Vector r(B.Size());
+   A->Mult(X, r);
+   r -= B;
+   REQUIRE(r.Norml2() <= 1e-6*B.Norml2());
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("Parallel PMultigridPreconditioner", "[PMultigrid][Parallel]")
+{
+   const bool partial_assembly = GENERATE(false, true);
+   CAPTURE(partial_assembly);
+
+   const int order = 4;
+   Mesh serial_mesh = Mesh::MakeCartesian2D(6, 6, Element::QUADRILATERAL);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   H1_FECollection fec(order, mesh.Dimension());
+   ParFiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   Array<int> ess_tdof_list;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   ParLinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   ParBilinearForm a(&fes);
+   if (partial_assembly) { a.SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+
+   ParGridFunction x(&fes);
+   x = 0.0;
+   OperatorPtr A;
+   Vector X, B;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+
+   PMultigridPreconditioner pmg(a, ess_bdr);
+   REQUIRE(pmg.NumLevels() == 3);
+   // The order 1 level is solved with BoomerAMG on the LOR discretization
+   REQUIRE(dynamic_cast<const LORSolver<HypreBoomerAMG>*>(
+              pmg.GetSmootherAtLevel(0)) != nullptr);
+   REQUIRE(pmg.Height() == A->Height());
+
+   CGSolver cg(MPI_COMM_WORLD);
+   cg.SetOperator(*A);
+   cg.SetPreconditioner(pmg);
+   cg.SetRelTol(1e-8);
+   cg.SetMaxIter(100);
+   cg.Mult(B, X);
+   REQUIRE(cg.GetConverged());
+   REQUIRE(cg.GetNumIterations() <= 25);
+
+   Vector r(B.Size());
+   A->Mult(X, r);
+   r -= B;
+   REQUIRE(ParNormlp(r, 2, MPI_COMM_WORLD) <=
+           1e-6*ParNormlp(B, 2, MPI_COMM_WORLD));
+}
+
+#endif // MFEM_USE_MPI
@@ -343,6 +343,24 @@ TEST_CASE("Variable Order FiniteElementSpace",
    }
 }
 
+TEST_CASE("Variable Order Element Costs", "[FiniteElementSpace]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(2, 1, Element::QUADRILATERAL);
+   mesh.EnsureNCMesh();
+
+   H1_FECollection fec(1, mesh.Dimension());
+   FiniteElementSpace fespace(&mesh, &fec);
+   fespace.SetElementOrder(1, 6);
+   fespace.Update(false);
+
+   // DOFs times quadrature points of order 2p: 4*2^2 and 49*7^2
+   Vector costs;
+   fespace.GetElementCosts(costs);
+   REQUIRE(costs.Size() == 2);
+   REQUIRE(costs(0) == MFEM_Approx(16.0));
+   REQUIRE(costs(1) == MFEM_Approx(2401.0));
+}
+
 #ifdef MFEM_USE_MPI
 TEST_CASE("Parallel Variable Order FiniteElementSpace",
           "[FiniteElementCollection]"
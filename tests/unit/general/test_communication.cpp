@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("GroupCommunicator Persistent Requests", "[Parallel]")
+{
+   Mesh serial_mesh = Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   ParMesh pmesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+
+   H1_FECollection fec(2, pmesh.Dimension());
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+   GroupCommunicator &gc = pfes.GroupComm();
+   const int ldofs = pfes.GetVSize();
+
+   // Values on the shared dofs depending on the owner, and the reduction of
+   // the values of all ranks sharing a dof
+   auto Compute = [&](Array<int> &bcast, Array<int> &reduce,
+                      Vector &bcast_d, Vector &reduce_d)
+   {
+      bcast.SetSize(ldofs);
+      reduce.SetSize(ldofs);
+      bcast_d.SetSize(ldofs);
+      reduce_d.SetSize(ldofs);
+      for (int i = 0; i < ldofs; i++)
+      {
+         bcast[i] = reduce[i] = Mpi::WorldRank() + 1;
+         bcast_d(i) = reduce_d(i) = 0.5*(Mpi::WorldRank() + 1) + i;
+      }
+      // Alternate the data types, reallocating the buffer
+      for (int k = 0; k < 2; k++)
+      {
+         gc.Bcast(bcast_d.GetData());
+         gc.Bcast(bcast);
+         gc.Reduce<real_t>(reduce_d.GetData(), GroupCommunicator::Sum);
+         gc.Reduce(reduce, GroupCommunicator::Max<int>);
+      }
+   };
+
+   Array<int> bcast, reduce, p_bcast, p_reduce;
+   Vector bcast_d, reduce_d, p_bcast_d, p_reduce_d;
+   Compute(bcast, reduce, bcast_d, reduce_d);
+   gc.UsePersistentRequests();
+   REQUIRE(gc.UsesPersistentRequests());
+   Compute(p_bcast, p_reduce, p_bcast_d, p_reduce_d);
+
+   // The prolongation and its transpose use the communicator too
+   const Operator &P = *pfes.GetProlongationMatrix();
+   Vector x(P.Width()), y(P.Height()), z(P.Width());
+   x.Randomize(1);
+   P.Mult(x, y);
+   P.MultTranspose(y, z);
+   gc.UsePersistentRequests(false);
+   Vector p_y(y), p_z(z);
+   P.Mult(x, y);
+   P.MultTranspose(y, z);
+
+   for (int i = 0; i < ldofs; i++)
+   {
+      REQUIRE(p_bcast[i] == bcast[i]);
+      REQUIRE(p_reduce[i] == reduce[i]);
+   }
+   p_bcast_d -= bcast_d;
+   p_reduce_d -= reduce_d;
+   p_y -= y;
+   p_z -= z;
+   REQUIRE(p_bcast_d.Normlinf() == 0.0);
+   REQUIRE(p_reduce_d.Normlinf() == 0.0);
+   REQUIRE(p_y.Normlinf() == 0.0);
+   REQUIRE(p_z.Normlinf() == 0.0);
+}
+
+#endif // MFEM_USE_MPI
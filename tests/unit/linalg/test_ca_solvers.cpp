@@ -0,0 +1,334 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace
+{
+
+class CountingMonitor : public IterativeSolverMonitor
+{
+public:
+   int calls = 0, last_it = -1;
+   void MonitorResidual(int it, real_t norm, const Vector &r,
+                        bool final) override
+   {
+      calls++;
+      if (final) { last_it = it; }
+   }
+};
+
+// Sets up a diffusion (and optionally convection) problem with essential
+// boundary conditions
+void SetupProblem(bool convection, SparseMatrix &A, Vector &b)
+{
+   Mesh mesh = Mesh::MakeCartesian2D(6, 6, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   Vector vel(2); vel(0) = 20.0; vel(1) = -10.0;
+   VectorConstantCoefficient velocity(vel);
+
+   LinearForm lf(&fes);
+   lf.AddDomainIntegrator(new DomainLFIntegrator(one));
+   lf.Assemble();
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   if (convection) { a.AddDomainIntegrator(new ConvectionIntegrator(velocity)); }
+   a.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   Vector X, B;
+   SparseMatrix A_ref;
+   a.FormLinearSystem(ess_tdof_list, x, lf, A_ref, X, B);
+   // A_ref and B reference the data of the forms, which are deleted on return
+   std::unique_ptr<SparseMatrix> mat(a.LoseMat());
+   A.Swap(*mat);
+   b = B;
+}
+
+real_t ResidualNorm(const Operator &A, const Vector &b, const Vector &x)
+{
+   Vector r(b.Size());
+   A.Mult(x, r);
+   r -= b;
+   return r.Norml2();
+}
+
+} // namespace
+
+TEST_CASE("PipelinedCGSolver", "[PipelinedCG]")
+{
+   SparseMatrix A;
+   Vector b;
+   SetupProblem(false, A, b);
+   DSmoother jacobi(A);
+
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   CGSolver cg;
+   cg.SetOperator(A);
+   if (use_prec) { cg.SetPreconditioner(jacobi); }
+   cg.SetRelTol(1e-10);
+   cg.SetMaxIter(500);
+   Vector x_cg(b.Size());
+   x_cg = 0.0;
+   cg.Mult(b, x_cg);
+   REQUIRE(cg.GetConverged());
+
+   PipelinedCGSolver pcg;
+   pcg.SetOperator(A);
+   if (use_prec) { pcg.SetPreconditioner(jacobi); }
+   pcg.SetRelTol(1e-10);
+   pcg.SetMaxIter(500);
+   CountingMonitor monitor;
+   pcg.SetMonitor(monitor);
+   Vector x(b.Size());
+   x = 0.0;
+
+   SECTION("Same iterates as CG")
+   {
+      pcg.Mult(b, x);
+      REQUIRE(pcg.GetConverged());
+      REQUIRE(std::abs(pcg.GetNumIterations() - cg.GetNumIterations()) <= 1);
+      REQUIRE(pcg.GetInitialNorm() == MFEM_Approx(cg.GetInitialNorm()));
+      REQUIRE(monitor.calls == pcg.GetNumIterations() + 2);
+      REQUIRE(monitor.last_it == pcg.GetNumIterations());
+      x -= x_cg;
+      REQUIRE(x.Normlinf() < 1e-6*x_cg.Normlinf());
+   }
+
+   SECTION("Residual replacement")
+   {
+      pcg.SetResidualReplacement(5);
+      pcg.Mult(b, x);
+      REQUIRE(pcg.GetConverged());
+      REQUIRE(ResidualNorm(A, b, x) < 1e-8*b.Norml2());
+   }
+
+   SECTION("Iterative mode")
+   {
+      // Starting from the CG solution, no iterations are needed to reach an
+      // absolute tolerance (the relative one applies to the initial residual)
+      pcg.iterative_mode = true;
+      pcg.SetAbsTol(1e-8*cg.GetInitialNorm());
+      x = x_cg;
+      pcg.Mult(b, x);
+      REQUIRE(pcg.GetConverged());
+      REQUIRE(pcg.GetNumIterations() <= 1);
+   }
+}
+
+TEST_CASE("SStepGMRESSolver", "[SStepGMRES]")
+{
+   SparseMatrix A;
+   Vector b;
+   SetupProblem(true, A, b);
+   GSSmoother gs(A);
+
+   const bool use_prec = GENERATE(false, true);
+   const int s = GENERATE(1, 3, 4);
+   const int kdim = GENERATE(12, 60);
+   CAPTURE(use_prec, s, kdim);
+
+   GMRESSolver gmres;
+   gmres.SetOperator(A);
+   if (use_prec) { gmres.SetPreconditioner(gs); }
+   gmres.SetKDim(kdim);
+   gmres.SetRelTol(1e-8);
+   gmres.SetMaxIter(1000);
+   Vector x_gmres(b.Size());
+   x_gmres = 0.0;
+   gmres.Mult(b, x_gmres);
+   REQUIRE(gmres.GetConverged());
+
+   SStepGMRESSolver sgmres;
+   sgmres.SetOperator(A);
+   if (use_prec) { sgmres.SetPreconditioner(gs); }
+   sgmres.SetKDim(kdim);
+   sgmres.SetStepSize(s);
+   sgmres.SetRelTol(1e-8);
+   sgmres.SetMaxIter(1000);
+   CountingMonitor monitor;
+   sgmres.SetMonitor(monitor);
+   Vector x(b.Size());
+   x = 0.0;
+   sgmres.Mult(b, x);
+   REQUIRE(sgmres.GetConverged());
+   REQUIRE(monitor.last_it == sgmres.GetNumIterations());
+
+   // The same Krylov spaces up to rounding, and only restarts at multiples of
+   // the step size
+   const int it = sgmres.GetNumIterations(), it_ref = gmres.GetNumIterations();
+   if (kdim % s == 0) { REQUIRE(std::abs(it - it_ref) <= 2); }
+   else { REQUIRE(it <= 2*it_ref); }
+
+   Vector r(b.Size());
+   A.Mult(x, r);
+   if (use_prec) { Vector t(r); t -= b; gs.Mult(t, r); r.Neg(); }
+   else { subtract(b, r, r); }
+   REQUIRE(r.Norml2() <= 1.01*sgmres.GetFinalNorm() + 1e-12);
+   REQUIRE(sgmres.GetFinalNorm() <= 1e-8*sgmres.GetInitialNorm());
+}
+
+#ifdef MFEM_USE_MPI
+
+namespace
+{
+
+// Gives access to the nonblocking global sums of IterativeSolver
+class GlobalSumSolver : public CGSolver
+{
+public:
+   GlobalSumSolver() { }
+   GlobalSumSolver(MPI_Comm comm_) : CGSolver(comm_) { }
+   using IterativeSolver::GlobalSumBegin;
+   using IterativeSolver::GlobalSumEnd;
+};
+
+} // namespace
+
+TEST_CASE("Parallel communication-avoiding solvers",
+          "[PipelinedCG][SStepGMRES][Parallel]")
+{
+   const int rank = Mpi::WorldRank(), size = Mpi::WorldSize();
+
+   SECTION("GlobalSumBegin and GlobalSumEnd")
+   {
+      GlobalSumSolver par_solver(MPI_COMM_WORLD), local_solver;
+      real_t buf[2] = { 1.0, real_t(rank) };
+      par_solver.GlobalSumBegin(buf, 2);
+      par_solver.GlobalSumEnd();
+      REQUIRE(buf[0] == MFEM_Approx(size));
+      REQUIRE(buf[1] == MFEM_Approx(0.5*size*(size - 1)));
+
+      // A second sum can be started once the first one is complete, and the
+      // sums of a solver without communicator are local
+      par_solver.GlobalSumBegin(buf, 1);
+      par_solver.GlobalSumEnd();
+      REQUIRE(buf[0] == MFEM_Approx(size*size));
+      local_solver.GlobalSumBegin(buf + 1, 1);
+      local_solver.GlobalSumEnd();
+      REQUIRE(buf[1] == MFEM_Approx(0.5*size*(size - 1)));
+   }
+
+   Mesh serial_mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   H1_FECollection fec(2, mesh.Dimension());
+   ParFiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   Vector vel(2); vel(0) = 20.0; vel(1) = -10.0;
+   VectorConstantCoefficient velocity(vel);
+
+   ParLinearForm lf(&fes);
+   lf.AddDomainIntegrator(new DomainLFIntegrator(one));
+   lf.Assemble();
+
+   ParGridFunction x(&fes);
+   x = 0.0;
+
+   SECTION("PipelinedCGSolver")
+   {
+      ParBilinearForm a(&fes);
+      a.AddDomainIntegrator(new DiffusionIntegrator(one));
+      a.Assemble();
+      HypreParMatrix A;
+      Vector X, B;
+      a.FormLinearSystem(ess_tdof_list, x, lf, A, X, B);
+      HypreSmoother jacobi(A, HypreSmoother::Jacobi);
+
+      CGSolver cg(MPI_COMM_WORLD);
+      cg.SetOperator(A);
+      cg.SetPreconditioner(jacobi);
+      cg.SetRelTol(1e-10);
+      cg.SetMaxIter(500);
+      Vector X_cg(B.Size());
+      X_cg = 0.0;
+      cg.Mult(B, X_cg);
+      REQUIRE(cg.GetConverged());
+
+      PipelinedCGSolver pcg(MPI_COMM_WORLD);
+      pcg.SetOperator(A);
+      pcg.SetPreconditioner(jacobi);
+      pcg.SetRelTol(1e-10);
+      pcg.SetMaxIter(500);
+      X = 0.0;
+      pcg.Mult(B, X);
+      REQUIRE(pcg.GetConverged());
+      REQUIRE(std::abs(pcg.GetNumIterations() - cg.GetNumIterations()) <= 1);
+      REQUIRE(pcg.GetInitialNorm() == MFEM_Approx(cg.GetInitialNorm()));
+      X -= X_cg;
+      const real_t err = GlobalLpNorm(infinity(), X.Normlinf(), MPI_COMM_WORLD);
+      const real_t sol = GlobalLpNorm(infinity(), X_cg.Normlinf(),
+                                      MPI_COMM_WORLD);
+      REQUIRE(err < 1e-6*sol);
+   }
+
+   SECTION("SStepGMRESSolver")
+   {
+      ParBilinearForm a(&fes);
+      a.AddDomainIntegrator(new DiffusionIntegrator(one));
+      a.AddDomainIntegrator(new ConvectionIntegrator(velocity));
+      a.Assemble();
+      HypreParMatrix A;
+      Vector X, B;
+      a.FormLinearSystem(ess_tdof_list, x, lf, A, X, B);
+
+      const int s = GENERATE(1, 4);
+      CAPTURE(s);
+
+      GMRESSolver gmres(MPI_COMM_WORLD);
+      gmres.SetOperator(A);
+      gmres.SetKDim(24);
+      gmres.SetRelTol(1e-8);
+      gmres.SetMaxIter(1000);
+      Vector X_gmres(B.Size());
+      X_gmres = 0.0;
+      gmres.Mult(B, X_gmres);
+      REQUIRE(gmres.GetConverged());
+
+      SStepGMRESSolver sgmres(MPI_COMM_WORLD);
+      sgmres.SetOperator(A);
+      sgmres.SetKDim(24);
+      sgmres.SetStepSize(s);
+      sgmres.SetRelTol(1e-8);
+      sgmres.SetMaxIter(1000);
+      X = 0.0;
+      sgmres.Mult(B, X);
+      REQUIRE(sgmres.GetConverged());
+      REQUIRE(std::abs(sgmres.GetNumIterations() -
+                       gmres.GetNumIterations()) <= 2);
+
+      Vector R(B.Size());
+      A.Mult(X, R);
+      subtract(B, R, R);
+      const real_t r_norm = sqrt(InnerProduct(MPI_COMM_WORLD, R, R));
+      REQUIRE(r_norm <= 1.01*sgmres.GetFinalNorm() + 1e-12);
+      REQUIRE(sgmres.GetFinalNorm() <= 1e-8*sgmres.GetInitialNorm());
+   }
+}
+
+#endif // MFEM_USE_MPI
@@ -0,0 +1,117 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("BSRMatrix", "[BSRMatrix][GPU]")
+{
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   // vdim = 5 uses the generic (runtime block size) kernels
+   const int vdim = GENERATE(2, 3, 5);
+   CAPTURE(ordering, vdim);
+
+   const int dim = (vdim == 3) ? 3 : 2;
+   Mesh mesh = (dim == 3) ?
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON) :
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, vdim, ordering);
+
+   BilinearForm a(&fes);
+   ConstantCoefficient lambda(2.0), mu(1.5);
+   if (vdim == dim)
+   {
+      a.AddDomainIntegrator(new ElasticityIntegrator(lambda, mu));
+   }
+   else
+   {
+      auto *mass = new VectorMassIntegrator;
+      mass->SetVDim(vdim);
+      a.AddDomainIntegrator(mass);
+   }
+   a.Assemble();
+   a.Finalize();
+   const SparseMatrix &S = a.SpMat();
+
+   BSRMatrix B(S, vdim, ordering);
+   REQUIRE(B.Height() == S.Height());
+   REQUIRE(B.Width() == S.Width());
+   REQUIRE(B.NumBlockRows() == fes.GetNDofs());
+   REQUIRE(B.NumNonZeroBlocks()*vdim*vdim >= S.NumNonZeroElems());
+
+   const int n = S.Height();
+   Vector x(n), y(n), y_ref(n);
+   x.Randomize(1);
+
+   SECTION("Mult")
+   {
+      S.Mult(x, y_ref);
+      B.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   SECTION("AddMultTranspose")
+   {
+      y.Randomize(2);
+      y_ref = y;
+      S.AddMultTranspose(x, y_ref, -0.5);
+      B.AddMultTranspose(x, y, -0.5);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   SECTION("ToSparseMatrix")
+   {
+      std::unique_ptr<SparseMatrix> S2(B.ToSparseMatrix());
+      REQUIRE(S2->NumNonZeroElems() == B.NumNonZeroBlocks()*vdim*vdim);
+      S2->Add(-1.0, S);
+      REQUIRE(S2->MaxNorm() == MFEM_Approx(0.0));
+   }
+}
+
+TEST_CASE("BSRMatrix rectangular", "[BSRMatrix][GPU]")
+{
+   // Rectangular matrix with empty block rows and block columns
+   const int bs = 2, nbr = 7, nbc = 4;
+   SparseMatrix S(bs*nbr, bs*nbc);
+   for (int i = 0; i < bs*nbr; i++)
+   {
+      if ((i / bs) % 3 == 1) { continue; }
+      for (int j = 0; j < bs*nbc; j += 1 + i % 3)
+      {
+         if ((j / bs) == 2) { continue; }
+         S.Add(i, j, 1.0 + i - 0.5*j);
+      }
+   }
+   S.Finalize();
+
+   BSRMatrix B(S, bs);
+   REQUIRE(B.NumBlockRows() == nbr);
+   REQUIRE(B.NumBlockCols() == nbc);
+
+   Vector x(S.Width()), y(S.Height()), y_ref(S.Height());
+   x.Randomize(1);
+   S.Mult(x, y_ref);
+   B.Mult(x, y);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+   Vector xt(S.Height()), yt(S.Width()), yt_ref(S.Width());
+   xt.Randomize(2);
+   S.MultTranspose(xt, yt_ref);
+   B.MultTranspose(xt, yt);
+   yt -= yt_ref;
+   REQUIRE(yt.Normlinf() == MFEM_Approx(0.0));
+}
@@ -290,4 +290,49 @@ TEST_CASE("SparseMatrix cuSPARSE Bug", "[SparseMatrix][GPU]")
    REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("SparseMatrix AddMult and AddMultTranspose", "[SparseMatrix][GPU]")
+{
+   // Rectangular matrix with empty rows, a few long rows and many short rows,
+   // so that row blocks with balanced numbers of nonzeros (as used with the
+   // OpenMP backend) differ significantly from blocks with equal row counts.
+   // With MFEM_USE_OPENMP, this test is also run with MFEM_DEVICE=omp, see
+   // tests/unit/CMakeLists.txt and tests/unit/makefile.
+   const int height = 257, width = 131;
+   SparseMatrix A(height, width);
+   for (int i = 0; i < height; i++)
+   {
+      if (i % 17 == 0) { continue; }
+      const int row_len = (i % 41 == 1) ? width : 1 + i % 5;
+      for (int k = 0; k < row_len; k++)
+      {
+         const int j = (i / 2 + 7*k) % width;
+         A.Add(i, j, 1.0 + 0.01*i - 0.02*k);
+      }
+   }
+   A.Finalize();
+
+   DenseMatrix Ad;
+   A.ToDenseMatrix(Ad);
+
+   const real_t a = 0.75;
+
+   Vector x(width), y(height), y_ref(height);
+   x.Randomize(1);
+   y.Randomize(2);
+   y_ref = y;
+   A.AddMult(x, y, a);
+   Ad.AddMult_a(a, x, y_ref);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+   Vector xt(height), yt(width), yt_ref(width);
+   xt.Randomize(3);
+   yt.Randomize(4);
+   yt_ref = yt;
+   A.AddMultTranspose(xt, yt, a);
+   Ad.AddMultTranspose_a(a, xt, yt_ref);
+   yt -= yt_ref;
+   REQUIRE(yt.Normlinf() == MFEM_Approx(0.0));
+}
+
 } // namespace mfem
@@ -0,0 +1,167 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("SinglePrecisionSparseMatrix", "[MixedPrecision]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   H1_FECollection fec(3, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.AddDomainIntegrator(new MassIntegrator(one));
+   a.Assemble();
+   a.Finalize();
+   const SparseMatrix &A = a.SpMat();
+
+   SinglePrecisionSparseMatrix A_s(A);
+   Vector x(A.Width()), y(A.Height()), y_s(A.Height());
+   x.Randomize(1);
+   A.Mult(x, y);
+   A_s.Mult(x, y_s);
+   y_s -= y;
+   REQUIRE(y_s.Normlinf() <= 1e-6*y.Normlinf());
+
+   Vector diag, diag_s;
+   A.GetDiag(diag);
+   A_s.AssembleDiagonal(diag_s);
+   diag_s -= diag;
+   REQUIRE(diag_s.Normlinf() <= 1e-6*diag.Normlinf());
+}
+
+TEST_CASE("MixedPrecisionSolver", "[MixedPrecision]")
+{
+   const bool convection = GENERATE(false, true);
+   const bool partial_assembly = GENERATE(false, true);
+   CAPTURE(convection, partial_assembly);
+   // The PA convection integrator does not provide the Jacobi diagonal
+   if (convection && partial_assembly) { return; }
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   Vector vel(2); vel(0) = 20.0; vel(1) = -10.0;
+   VectorConstantCoefficient velocity(vel);
+
+   LinearForm lf(&fes);
+   lf.AddDomainIntegrator(new DomainLFIntegrator(one));
+   lf.Assemble();
+
+   BilinearForm a(&fes);
+   if (partial_assembly) { a.SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   if (convection)
+   {
+      a.AddDomainIntegrator(new ConvectionIntegrator(velocity));
+   }
+   a.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   OperatorPtr A;
+   Vector X, B;
+   a.FormLinearSystem(ess_tdof_list, x, lf, A, X, B);
+
+   std::unique_ptr<IterativeSolver> inner;
+   if (convection) { inner.reset(new GMRESSolver); }
+   else { inner.reset(new CGSolver); }
+   inner->SetRelTol(1e-3);
+   inner->SetMaxIter(500);
+
+   const real_t tol = std::is_same<real_t, double>::value ? 1e-12 : 1e-5;
+   MixedPrecisionSolver solver;
+   solver.SetOperator(*A);
+
+   // Jacobi preconditioner of the inner operator
+   Vector diag(A->Height());
+   solver.GetInnerOperator().AssembleDiagonal(diag);
+   OperatorJacobiSmoother jacobi(diag, ess_tdof_list);
+   inner->SetPreconditioner(jacobi);
+   solver.SetInnerSolver(*inner);
+   solver.SetRelTol(tol);
+   solver.SetMaxIter(20);
+   // With MFEM_USE_SINGLE, the inner operator is the matrix itself
+   const bool sparse = !partial_assembly &&
+                       std::is_same<real_t, double>::value;
+   REQUIRE((dynamic_cast<const SinglePrecisionSparseMatrix*>(
+               &solver.GetInnerOperator()) != nullptr) == sparse);
+
+   solver.Mult(B, X);
+   REQUIRE(solver.GetConverged());
+   REQUIRE(solver.GetNumIterations() <= 8);
+
+   // The residual in full precision reaches the outer tolerance
+   Vector r(B.Size());
+   A->Mult(X, r);
+   r -= B;
+   REQUIRE(r.Norml2() <= tol*B.Norml2());
+   REQUIRE(solver.GetFinalNorm() == MFEM_Approx(r.Norml2()));
+}
+
+TEST_CASE("SinglePrecisionCGSolver", "[MixedPrecision]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm lf(&fes);
+   lf.AddDomainIntegrator(new DomainLFIntegrator(one));
+   lf.Assemble();
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   OperatorPtr A;
+   Vector X, B;
+   a.FormLinearSystem(ess_tdof_list, x, lf, A, X, B);
+
+   const real_t tol = std::is_same<real_t, double>::value ? 1e-12 : 1e-5;
+   MixedPrecisionSolver solver;
+   solver.SetOperator(*A);
+   SinglePrecisionCGSolver cg;
+   cg.SetRelTol(1e-3);
+   cg.SetMaxIter(500);
+   solver.SetInnerSolver(cg);
+
+   // The single precision solve alone reduces the residual
+   Vector d(B.Size()), r(B.Size());
+   cg.Mult(B, d);
+   REQUIRE(cg.GetConverged());
+   REQUIRE(cg.GetNumIterations() > 0);
+   A->Mult(d, r);
+   r -= B;
+   REQUIRE(r.Norml2() <= 0.1*B.Norml2());
+
+   // The refinement reaches the full precision tolerance
+   solver.SetRelTol(tol);
+   solver.SetMaxIter(20);
+   solver.Mult(B, X);
+   REQUIRE(solver.GetConverged());
+   REQUIRE(solver.GetNumIterations() <= 10);
+   A->Mult(X, r);
+   r -= B;
+   REQUIRE(r.Norml2() <= tol*B.Norml2());
+}
@@ -478,3 +478,185 @@ TEST_CASE("NURBS 1D curve in 2D from patches", "[Mesh]")
       }
    }
 }
+
+static void CompareMeshes(Mesh &m1, Mesh &m2)
+{
+   REQUIRE(m1.Dimension() == m2.Dimension());
+   REQUIRE(m1.SpaceDimension() == m2.SpaceDimension());
+   REQUIRE(m1.GetNE() == m2.GetNE());
+   REQUIRE(m1.GetNBE() == m2.GetNBE());
+   REQUIRE(m1.GetNV() == m2.GetNV());
+   Array<int> v1, v2;
+   for (int i = 0; i < m1.GetNE(); i++)
+   {
+      REQUIRE(m1.GetElementGeometry(i) == m2.GetElementGeometry(i));
+      REQUIRE(m1.GetAttribute(i) == m2.GetAttribute(i));
+      m1.GetElementVertices(i, v1);
+      m2.GetElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+   }
+   for (int i = 0; i < m1.GetNBE(); i++)
+   {
+      REQUIRE(m1.GetBdrAttribute(i) == m2.GetBdrAttribute(i));
+      m1.GetBdrElementVertices(i, v1);
+      m2.GetBdrElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+   }
+   for (int i = 0; i < m1.GetNV(); i++)
+   {
+      for (int d = 0; d < m1.SpaceDimension(); d++)
+      {
+         REQUIRE(m1.GetVertex(i)[d] == m2.GetVertex(i)[d]);
+      }
+   }
+   REQUIRE((m1.GetNodes() == nullptr) == (m2.GetNodes() == nullptr));
+   if (m1.GetNodes())
+   {
+      Vector diff(*m1.GetNodes());
+      diff -= *m2.GetNodes();
+      REQUIRE(diff.Normlinf() == 0.0);
+   }
+}
+
+TEST_CASE("Binary mesh format", "[Mesh]")
+{
+   const int dim = GENERATE(2, 3);
+   const bool curved = GENERATE(false, true);
+   CAPTURE(dim, curved);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 4, Element::TRIANGLE, true) :
+               Mesh::MakeCartesian3D(2, 2, 3, Element::HEXAHEDRON);
+   for (int i = 0; i < mesh.GetNE(); i++) { mesh.SetAttribute(i, 1 + i%3); }
+   mesh.SetAttributes();
+   mesh.attribute_sets.SetAttributeSet("odd", Array<int>({1, 3}));
+   mesh.bdr_attribute_sets.SetAttributeSet("first", Array<int>({1}));
+   if (curved) { mesh.SetCurvature(2); }
+
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, 2, Ordering::byVDIM);
+   GridFunction gf(&fes);
+   gf.Randomize(1);
+
+   SECTION("Stream")
+   {
+      std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+      mesh.PrintBinary(ss);
+      gf.SaveBinary(ss);
+
+      Mesh mesh2(ss);
+      CompareMeshes(mesh, mesh2);
+      REQUIRE(mesh2.attribute_sets.GetAttributeSet("odd") ==
+              Array<int>({1, 3}));
+      REQUIRE(mesh2.bdr_attribute_sets.GetAttributeSet("first") ==
+              Array<int>({1}));
+
+      GridFunction gf2(&mesh2, ss);
+      REQUIRE(gf2.FESpace()->GetOrdering() == Ordering::byVDIM);
+      gf2 -= gf;
+      REQUIRE(gf2.Normlinf() == 0.0);
+   }
+
+   SECTION("Memory-mapped file")
+   {
+      const std::string fname = "binary_mesh_test.mesh";
+      {
+         std::ofstream ofs(fname, std::ios::binary);
+         mesh.PrintBinary(ofs);
+         gf.SaveBinary(ofs);
+      }
+      {
+         mapped_ifstream ifs(fname);
+         REQUIRE(ifs.good());
+         Mesh mesh2(ifs);
+         CompareMeshes(mesh, mesh2);
+         GridFunction gf2(&mesh2, ifs);
+         Vector diff(gf2);
+         diff -= gf;
+         REQUIRE(diff.Normlinf() == 0.0);
+         // The values are used in place
+         REQUIRE(!gf2.OwnsData());
+      }
+      REQUIRE(std::remove(fname.c_str()) == 0);
+   }
+}
+
+TEST_CASE("Gmsh 4.1 binary format", "[Mesh]")
+{
+   // A 2x1 quadrilateral mesh with the bottom edges as boundary, with the
+   // nodes in two blocks with non-contiguous tags. With a large gap, the tags
+   // are too sparse for a flat tag-to-index array, and are looked up in a
+   // sorted array instead.
+   const uint64_t gap = GENERATE(0, 1000000);
+   CAPTURE(gap);
+   std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+   const auto write_size = [&ss](uint64_t v) { bin_io::write(ss, v); };
+   const auto write_int = [&ss](int32_t v) { bin_io::write(ss, v); };
+
+   ss << "$MeshFormat\n4.1 1 8\n";
+   write_int(1);
+   ss << "\n$EndMeshFormat\n";
+   ss << "$PhysicalNames\n2\n1 3 \"bottom\"\n2 7 \"domain\"\n$EndPhysicalNames\n";
+
+   ss << "$Entities\n";
+   write_size(0); write_size(1); write_size(1); write_size(0);
+   // curve 1 in physical group 3, bounded by no points
+   write_int(1);
+   for (int i = 0; i < 6; i++) { bin_io::write(ss, 0.0); }
+   write_size(1); write_int(3);
+   write_size(0);
+   // surface 1 in physical group 7, bounded by curve 1
+   write_int(1);
+   for (int i = 0; i < 6; i++) { bin_io::write(ss, 0.0); }
+   write_size(1); write_int(7);
+   write_size(1); write_int(1);
+   ss << "\n$EndEntities\n";
+
+   const uint64_t tags[2][3] = {{1, 2, 3}, {11+gap, 12+2*gap, 13+3*gap}};
+   ss << "$Nodes\n";
+   write_size(2); write_size(6); write_size(1); write_size(tags[1][2]);
+   for (int b = 0; b < 2; b++)
+   {
+      write_int(2); write_int(1); write_int(0); write_size(3);
+      for (int i = 0; i < 3; i++) { write_size(tags[b][i]); }
+      for (int i = 0; i < 3; i++)
+      {
+         bin_io::write(ss, double(i));
+         bin_io::write(ss, double(b));
+         bin_io::write(ss, 0.0);
+      }
+   }
+   ss << "\n$EndNodes\n";
+
+   ss << "$Elements\n";
+   write_size(2); write_size(4); write_size(1); write_size(4);
+   write_int(2); write_int(1); write_int(3); write_size(2);
+   write_size(1); write_size(1); write_size(2);
+   write_size(tags[1][1]); write_size(tags[1][0]);
+   write_size(2); write_size(2); write_size(3);
+   write_size(tags[1][2]); write_size(tags[1][1]);
+   write_int(1); write_int(1); write_int(1); write_size(2);
+   write_size(3); write_size(1); write_size(2);
+   write_size(4); write_size(2); write_size(3);
+   ss << "\n$EndElements\n";
+
+   Mesh mesh(ss);
+   REQUIRE(mesh.Dimension() == 2);
+   REQUIRE(mesh.SpaceDimension() == 2);
+   REQUIRE(mesh.GetNE() == 2);
+   REQUIRE(mesh.GetNBE() == 2);
+   REQUIRE(mesh.GetNV() == 6);
+   REQUIRE(mesh.GetElementGeometry(0) == Geometry::SQUARE);
+   REQUIRE(mesh.GetAttribute(1) == 7);
+   REQUIRE(mesh.GetBdrAttribute(0) == 3);
+   REQUIRE(mesh.attribute_sets.GetAttributeSet("domain")[0] == 7);
+   REQUIRE(mesh.bdr_attribute_sets.GetAttributeSet("bottom")[0] == 3);
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      REQUIRE(mesh.GetElementVolume(i) == MFEM_Approx(1.0));
+   }
+   Array<int> v;
+   mesh.GetElementVertices(1, v);
+   REQUIRE(mesh.GetVertex(v[2])[0] == 2.0);
+   REQUIRE(mesh.GetVertex(v[2])[1] == 1.0);
+}
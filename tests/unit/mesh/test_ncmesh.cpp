@@ -1693,6 +1693,99 @@ TEST_CASE("Parallel RP=I", "[Parallel], [NCMesh]")
    }
 }
 
+TEST_CASE("ParMeshRebalanceDiffusive", "[Parallel], [NCMesh]")
+{
+   const int nranks = Mpi::WorldSize();
+   if (nranks < 2) { return; }
+
+   Mesh smesh = Mesh::MakeCartesian2D(16, 16, Element::QUADRILATERAL);
+   smesh.EnsureNCMesh();
+   ParMesh pmesh(MPI_COMM_WORLD, smesh);
+
+   // Refine the elements of rank 0 twice to create an imbalance
+   for (int r = 0; r < 2; r++)
+   {
+      Array<int> refs;
+      if (Mpi::WorldRank() == 0)
+      {
+         for (int i = 0; i < pmesh.GetNE(); i++) { refs.Append(i); }
+      }
+      pmesh.GeneralRefinement(refs);
+   }
+
+   H1_FECollection fec(2, 2);
+   ParFiniteElementSpace fes(&pmesh, &fec);
+   FunctionCoefficient coeff([](const Vector &x) { return x(0)*x(0) + x(1); });
+   ParGridFunction x(&fes);
+   x.ProjectCoefficient(coeff);
+
+   auto Imbalance = [&]()
+   {
+      int ne = pmesh.GetNE(), max_ne;
+      MPI_Allreduce(&ne, &max_ne, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+      return real_t(max_ne)*nranks/pmesh.GetGlobalNE();
+   };
+
+   const long long global_ne = pmesh.GetGlobalNE();
+   const real_t max_migration = 0.2;
+   real_t imbalance = Imbalance();
+   for (int it = 0; it < 3; it++)
+   {
+      const int old_ne = pmesh.GetNE();
+      pmesh.RebalanceDiffusive(max_migration);
+      fes.Update();
+      x.Update();
+
+      REQUIRE(pmesh.GetGlobalNE() == global_ne);
+      // Elements kept by this rank
+      const Array<int> &old_index = pmesh.pncmesh->GetRebalanceOldIndex();
+      int kept = 0;
+      for (int i = 0; i < old_index.Size(); i++)
+      {
+         kept += (old_index[i] >= 0);
+      }
+      REQUIRE(old_ne - kept <= max_migration*old_ne);
+
+      const real_t new_imbalance = Imbalance();
+      REQUIRE(new_imbalance <= imbalance);
+      imbalance = new_imbalance;
+   }
+   REQUIRE(x.ComputeL2Error(coeff) == MFEM_Approx(0.0));
+}
+
+TEST_CASE("ParMeshRebalanceWeighted", "[Parallel], [NCMesh]")
+{
+   const int nranks = Mpi::WorldSize();
+
+   Mesh smesh = Mesh::MakeCartesian2D(16, 16, Element::QUADRILATERAL);
+   smesh.EnsureNCMesh();
+   ParMesh pmesh(MPI_COMM_WORLD, smesh);
+
+   // Elements in the left quarter are 10 times more expensive
+   auto Weights = [&]()
+   {
+      Vector weights(pmesh.GetNE()), center;
+      for (int i = 0; i < pmesh.GetNE(); i++)
+      {
+         pmesh.GetElementCenter(i, center);
+         weights(i) = (center(0) < 0.25) ? 10.0 : 1.0;
+      }
+      return weights;
+   };
+   Vector weights = Weights();
+   const long long global_ne = pmesh.GetGlobalNE();
+
+   pmesh.RebalanceWeighted(weights);
+   REQUIRE(pmesh.GetGlobalNE() == global_ne);
+
+   // Each part is within one element weight of the average
+   weights = Weights();
+   real_t local = weights.Sum(), total;
+   MPI_Allreduce(&local, &total, 1, MPITypeMap<real_t>::mpi_type, MPI_SUM,
+                 MPI_COMM_WORLD);
+   REQUIRE(std::abs(local - total/nranks) <= 10.0);
+}
+
 #endif // MFEM_USE_MPI
 
 TEST_CASE("ReferenceCubeInternalBoundaries", "[NCMesh]")
@@ -223,6 +223,79 @@ TEST_CASE("ParMeshMakeSimplicial", "[Parallel], [ParMesh]")
    REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("ParMeshCheckpoint", "[Parallel], [ParMesh]")
+{
+   const bool curved = GENERATE(false, true);
+   const bool face_nbr_data = GENERATE(false, true);
+   CAPTURE(curved, face_nbr_data);
+
+   Mesh mesh = Mesh::MakeCartesian3D(3, 3, 3, Element::TETRAHEDRON);
+   if (curved) { mesh.SetCurvature(2); }
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   if (face_nbr_data) { pmesh.ExchangeFaceNbrData(); }
+
+   const int rank = Mpi::WorldRank();
+   const std::string fname = "pmesh_checkpoint." + std::to_string(rank);
+   {
+      std::ofstream ofs(fname, std::ios::binary);
+      pmesh.SaveCheckpoint(ofs);
+   }
+
+   std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+   pmesh.SaveCheckpoint(ss);
+   mapped_ifstream ifs(fname);
+   std::istream &input = GENERATE(0, 1) ? static_cast<std::istream&>(ss) : ifs;
+
+   ParMesh pmesh2 = ParMesh::LoadCheckpoint(MPI_COMM_WORLD, input);
+   REQUIRE(pmesh2.GetNE() == pmesh.GetNE());
+   REQUIRE(pmesh2.GetNV() == pmesh.GetNV());
+   REQUIRE(pmesh2.GetNFaces() == pmesh.GetNFaces());
+   REQUIRE(pmesh2.GetNSharedFaces() == pmesh.GetNSharedFaces());
+   REQUIRE(pmesh2.GetNGroups() == pmesh.GetNGroups());
+   REQUIRE(pmesh2.GetNFaceNeighbors() == pmesh.GetNFaceNeighbors());
+   REQUIRE(pmesh2.GetNFaceNeighborElements() ==
+           pmesh.GetNFaceNeighborElements());
+   REQUIRE(pmesh2.GetGlobalNE() == pmesh.GetGlobalNE());
+
+   for (int sf = 0; sf < pmesh.GetNSharedFaces(); sf++)
+   {
+      REQUIRE(pmesh2.GetSharedFace(sf) == pmesh.GetSharedFace(sf));
+   }
+
+   // Grid functions are restarted with the binary GridFunction format
+   {
+      H1_FECollection fec(2, 3);
+      ParFiniteElementSpace fes(&pmesh, &fec);
+      ParGridFunction gf(&fes);
+      FunctionCoefficient coeff(simplicial::exact);
+      gf.ProjectCoefficient(coeff);
+      std::stringstream gf_ss(std::ios::in | std::ios::out | std::ios::binary);
+      gf.SaveBinary(gf_ss);
+      ParGridFunction gf2(&pmesh2, gf_ss);
+      REQUIRE(gf2.ParFESpace()->GlobalTrueVSize() == fes.GlobalTrueVSize());
+      gf2 -= gf;
+      REQUIRE(gf2.Normlinf() == 0.0);
+   }
+
+   Vector x, x2;
+   simplicial::SolveDiffusionProblem(pmesh, x);
+   simplicial::SolveDiffusionProblem(pmesh2, x2);
+   x -= x2;
+   REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
+
+   // The tetrahedra are refined consistently across the processors
+   pmesh.UniformRefinement();
+   pmesh2.UniformRefinement();
+   REQUIRE(pmesh2.GetNE() == pmesh.GetNE());
+   REQUIRE(pmesh2.GetNSharedFaces() == pmesh.GetNSharedFaces());
+   simplicial::SolveDiffusionProblem(pmesh, x);
+   simplicial::SolveDiffusionProblem(pmesh2, x2);
+   x -= x2;
+   REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
+
+   std::remove(fname.c_str());
+}
+
 #endif // MFEM_USE_MPI
 
 } // namespace mfem
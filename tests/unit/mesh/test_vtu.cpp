@@ -80,3 +80,121 @@ TEST_CASE("VTU XML Compressed Blocks", "[VTU][XML][MFEMData]")
    REQUIRE(mesh.GetNumGeometries(3) == 1);
 #endif
 }
+
+TEST_CASE("VTU Appended Output", "[Mesh][VTU][XML]")
+{
+   const bool curved = GENERATE(false, true);
+#ifdef MFEM_USE_ZLIB
+   const int compression_level = GENERATE(0, 6);
+#else
+   const int compression_level = 0;
+#endif
+   const VTKFormat format = GENERATE(VTKFormat::BINARY, VTKFormat::BINARY32);
+   CAPTURE(curved, compression_level);
+
+   Mesh mesh = Mesh::MakeCartesian2D(3, 2, Element::QUADRILATERAL, false,
+                                     2.0, 1.0);
+   if (curved)
+   {
+      mesh.SetCurvature(2);
+      mesh.Transform([](const Vector &x, Vector &y)
+      {
+         y = x;
+         y(1) += 0.1*x(0)*x(0);
+      });
+   }
+
+   std::stringstream vtu;
+   vtu << "<VTKFile type=\"UnstructuredGrid\" version=\"2.2\"";
+   if (compression_level != 0)
+   {
+      vtu << " compressor=\"vtkZLibDataCompressor\"";
+   }
+   vtu << " byte_order=\"" << VTKByteOrder() << "\">\n";
+   vtu << "<UnstructuredGrid>\n";
+   VTKAppendedData appended(compression_level);
+   mesh.PrintVTU(vtu, 1, format, false, compression_level, false, &appended);
+   vtu << "</Piece>\n";
+   vtu << "</UnstructuredGrid>\n";
+   appended.Write(vtu);
+   vtu << "</VTKFile>" << std::endl;
+   REQUIRE(vtu.str().find("format=\"appended\" offset=\"0\"") !=
+           std::string::npos);
+
+   // The vertices of the elements read back match the original ones
+   Mesh mesh_vtu(vtu);
+   REQUIRE(mesh_vtu.GetNE() == mesh.GetNE());
+   const real_t tol = (format == VTKFormat::BINARY32) ? 1e-6 : 1e-12;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      REQUIRE(mesh_vtu.GetAttribute(i) == mesh.GetAttribute(i));
+      Array<int> v, v_vtu;
+      mesh.GetElementVertices(i, v);
+      mesh_vtu.GetElementVertices(i, v_vtu);
+      REQUIRE(v.Size() == v_vtu.Size());
+      DenseMatrix pmat;
+      mesh.GetElementTransformation(i)->Transform(
+         *Geometries.GetVertices(mesh.GetElementBaseGeometry(i)), pmat);
+      for (int k = 0; k < v.Size(); k++)
+      {
+         const real_t *x = mesh_vtu.GetVertex(v_vtu[k]);
+         REQUIRE(x[0] == MFEM_Approx(pmat(0,k), tol));
+         REQUIRE(x[1] == MFEM_Approx(pmat(1,k), tol));
+      }
+   }
+}
+
+TEST_CASE("VTU Refined Field Evaluation", "[VTU]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(3, 2, Element::TRIANGLE);
+   H1_FECollection fec(3, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec, 2);
+   GridFunction u(&fes);
+   VectorFunctionCoefficient coeff(2, [](const Vector &x, Vector &y)
+   {
+      y(0) = x(0)*x(1)*x(1);
+      y(1) = x(0) - x(1)*x(1)*x(1);
+   });
+   u.ProjectCoefficient(coeff);
+
+   const int ref = 4;
+   std::vector<real_t> values;
+   const bool evaluated = EvalVTKRefinedField(
+                             mesh.GetNE(), ref, 2,
+                             [&](int i) { return mesh.GetElementBaseGeometry(i); },
+                             [&](int i) { return fes.GetFE(i); },
+                             [&](int i, Array<int> &vdofs, Vector &dofs)
+   {
+      fes.GetElementVDofs(i, vdofs);
+      u.GetSubVector(vdofs, dofs);
+   }, values);
+   REQUIRE(evaluated);
+
+   // Same values as GridFunction::GetVectorValues()
+   std::size_t pos = 0;
+   DenseMatrix vals, tr;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      const IntegrationRule &ir = GlobGeometryRefiner.Refine(
+                                     mesh.GetElementBaseGeometry(i), ref, 1)->RefPts;
+      u.GetVectorValues(i, ir, vals, tr);
+      for (int j = 0; j < ir.GetNPoints(); j++)
+      {
+         for (int c = 0; c < 2; c++)
+         {
+            REQUIRE(pos < values.size());
+            REQUIRE(values[pos++] == MFEM_Approx(vals(c,j)));
+         }
+      }
+   }
+   REQUIRE(pos == values.size());
+
+   // Vector finite elements are not supported
+   ND_FECollection nd_fec(1, mesh.Dimension());
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   REQUIRE_FALSE(EvalVTKRefinedField(
+                    mesh.GetNE(), ref, 2,
+                    [&](int i) { return mesh.GetElementBaseGeometry(i); },
+                    [&](int i) { return nd_fes.GetFE(i); },
+                    [](int, Array<int> &, Vector &) { }, values));
+}
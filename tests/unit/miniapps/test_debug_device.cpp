@@ -145,10 +145,104 @@ TEST_CASE("MemoryManager/DebugDevice", "[DebugDevice]")
    REQUIRE(mm.PrintAliases(dev_null) == n_alias);
 }
 
+TEST_CASE("MemoryManager/Pool", "[DebugDevice]")
+{
+   struct NullBuffer: public std::streambuf
+   {
+      int overflow(int c) override { return c; }
+   } null_buffer;
+   std::ostream dev_null(&null_buffer);
+   const auto n_ptr = mm.PrintPtrs(dev_null);
+   const auto n_alias = mm.PrintAliases(dev_null);
+
+   for (MemoryType mt : {MemoryType::HOST_POOL, MemoryType::DEVICE_POOL})
+   {
+      CAPTURE(MemoryTypeName[static_cast<int>(mt)]);
+      const MemoryPoolStats s0 = MemoryManager::GetPoolStats(mt);
+      // 1000 and 1024 doubles fall in the same size class
+      for (int i = 0; i < 4; i++)
+      {
+         TestMemoryTypes(mt, true, 1000 + 8*i);
+         TestMemoryTypes(mt, false, 1024);
+      }
+      MemoryPoolStats s = MemoryManager::GetPoolStats(mt);
+      const size_t n_alloc = s.allocations - s0.allocations;
+      REQUIRE(n_alloc >= 4);
+      REQUIRE(s.deallocations - s0.deallocations == n_alloc);
+      REQUIRE(s.hits - s0.hits >= n_alloc - 1);
+      REQUIRE(s.bytes_in_use == s0.bytes_in_use);
+      REQUIRE(s.bytes_cached >= 1024*sizeof(real_t));
+      REQUIRE(s.peak_bytes >= s.bytes_cached);
+
+      MemoryManager::ReleasePool(mt);
+      REQUIRE(MemoryManager::GetPoolStats(mt).bytes_cached == 0);
+
+      // With a zero cache limit, freed blocks are returned to the system
+      MemoryManager::SetPoolCacheLimit(mt, 0);
+      TestMemoryTypes(mt, true);
+      s = MemoryManager::GetPoolStats(mt);
+      REQUIRE(s.bytes_cached == 0);
+      REQUIRE(s.bytes_in_use == s0.bytes_in_use);
+      MemoryManager::SetPoolCacheLimit(mt, std::numeric_limits<size_t>::max());
+   }
+
+   REQUIRE(mm.PrintPtrs(dev_null) == n_ptr);
+   REQUIRE(mm.PrintAliases(dev_null) == n_alias);
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("GroupCommunicator Device Exchange", "[DebugDevice]")
+{
+   Mesh serial_mesh = Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   ParMesh pmesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   H1_FECollection fec(2, pmesh.Dimension());
+   ParFiniteElementSpace pfes(&pmesh, &fec, 2);
+   GroupCommunicator &gc = pfes.GroupComm();
+
+   const bool gpu_aware_mpi = Device::GetGPUAwareMPI();
+   const bool use_gpu_aware_mpi = GENERATE(false, true);
+   CAPTURE(use_gpu_aware_mpi);
+   Device::SetGPUAwareMPI(use_gpu_aware_mpi);
+
+   using OpType = void (*)(GroupCommunicator::OpData<real_t>);
+   const OpType ops[] = { nullptr, GroupCommunicator::Sum<real_t>,
+                          GroupCommunicator::Min<real_t>,
+                          GroupCommunicator::Max<real_t>
+                        };
+   Vector x(pfes.GetVSize());
+   x.Randomize(Mpi::WorldRank() + 1);
+   for (int op = 0; op < 4; op++)
+   {
+      CAPTURE(op);
+      // Reference on the host
+      Vector y_ref(x);
+      if (op == 0) { gc.Bcast<real_t>(y_ref.HostReadWrite()); }
+      else { gc.Reduce<real_t>(y_ref.HostReadWrite(), ops[op]); }
+
+      // Pack and unpack on the device, any host access is an error
+      Vector y(x);
+      y.UseDevice(true);
+      y.Read();
+      if (op == 0) { gc.Bcast(y); }
+      else { gc.Reduce(y, ops[op]); }
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == 0.0);
+   }
+   Device::SetGPUAwareMPI(gpu_aware_mpi);
+}
+
+#endif // MFEM_USE_MPI
+
 #endif // _WIN32
 
 int main(int argc, char *argv[])
 {
+#ifdef MFEM_USE_MPI
+   Mpi::Init(argc, argv);
+   Hypre::Init();
+#endif
    Device device("debug");
    return RunCatchSession(argc, argv, {"[DebugDevice]"});
 }